@@ -50,9 +50,9 @@ namespace Comp2D
 			int m_currentAnimationKeyframeIndex;
 			int m_lastAnimationKeyframeIndex;
 
-			Uint32 m_nextFrameTimeSinceSDLInitializationInMilliseconds;
-			Uint32 m_timeSinceSDLInitializationInMillisecondsOnPaused;
-			Uint32 m_timeSinceSDLInitializationInMillisecondsOnStarted;
+			Uint64 m_nextFrameTimeSinceSDLInitializationInNanoseconds;
+			Uint64 m_timeSinceSDLInitializationInNanosecondsOnPaused;
+			Uint64 m_timeSinceSDLInitializationInNanosecondsOnStarted;
 
 			std::string m_name;
 
@@ -85,7 +85,7 @@ namespace Comp2D
 			void start( int startingAnimationKeyframeIndex = 0 );
 			void stop();
 			void unpause();
-			void update( Uint32 currentTime );
+			void update( Uint64 currentTime );
 
 			bool hasStarted() const;
 			bool isLooping() const;
@@ -97,9 +97,9 @@ namespace Comp2D
 			int getCurrentAnimationKeyframeIndex() const;
 			int getLastAnimationKeyframeIndex() const;
 
-			Uint32 getNextFrameTimeSinceSDLInitializationInMilliseconds() const;
-			Uint32 getTimeSinceSDLInitializationInMillisecondsOnPaused() const;
-			Uint32 getTimeSinceSDLInitializationInMillisecondsOnStarted() const;
+			Uint64 getNextFrameTimeSinceSDLInitializationInNanoseconds() const;
+			Uint64 getTimeSinceSDLInitializationInNanosecondsOnPaused() const;
+			Uint64 getTimeSinceSDLInitializationInNanosecondsOnStarted() const;
 
 			const std::string& getName() const;
 
@@ -58,7 +58,7 @@ namespace Comp2D
 			void setCurrentAnimation( int animationIndex );
 			void setCurrentAnimation( const std::string& animationResourceName );
 			void setCurrentAnimation( const Comp2D::Animations::Animation& animation );
-			void update( Uint32 currentTime );
+			void update( Uint64 currentTime );
 
 			int getCurrentAnimationIndex() const;
 
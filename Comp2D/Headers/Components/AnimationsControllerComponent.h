@@ -78,7 +78,7 @@ namespace Comp2D
 			void setAnimationsControllerResource( Comp2D::Resources::GenericResource<Comp2D::Animations::AnimationsController>* animationsControllerResource );
 			void setAnimationsSpriteComponent( Comp2D::Components::SpriteComponent* animationsSpriteComponent );
 			void setPausable( bool pausable );
-			void update( Uint32 currentTime );
+			void update( Uint64 currentTime );
 
 			bool isPausable() const;
 
@@ -27,6 +27,11 @@
 #ifndef Comp2D_HEADERS_COMPONENTS_COMPONENT_H_
 #define Comp2D_HEADERS_COMPONENTS_COMPONENT_H_
 
+#include <cstddef>
+
+#include <SDL.h>
+
+#include "Comp2D/Headers/Components/ComponentType.h"
 #include "Comp2D/Headers/Objects/GameObject.h"
 
 namespace Comp2D
@@ -42,6 +47,10 @@ namespace Comp2D
 
 			unsigned int m_id;
 
+			// EComponentRole flags, set once the Component is added to its
+			// GameObject or becomes its transform
+			Uint32 m_roles;
+
 		public:
 			Comp2D::Objects::GameObject* gameObject;
 
@@ -53,6 +62,10 @@ namespace Comp2D
 
 			virtual ~Component();
 
+			// From the MemoryArena of its GameState when created by its setup
+			static void* operator new( size_t size );
+			static void operator delete( void* pointer );
+
 			bool operator==( const Component& rhs ) const;
 
 			bool operator!=( const Component& rhs ) const;
@@ -76,8 +89,14 @@ namespace Comp2D
 			bool executedOnInstantiated() const;
 			bool isActiveInHierarchy() const;
 			bool isEnabled() const;
+			bool hasRole( EComponentRole role ) const;
 
 			unsigned int getID() const;
+
+			Uint32 getRoles() const;
+
+			friend class Comp2D::Objects::GameObject;
+			friend class Comp2D::States::GameState;
 		};
 	}
 }
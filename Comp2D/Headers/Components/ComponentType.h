@@ -0,0 +1,90 @@
+/* ComponentType.h -- 'Comp2D' Game Engine 'ComponentType' class header file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#ifndef Comp2D_HEADERS_COMPONENTS_COMPONENTTYPE_H_
+#define Comp2D_HEADERS_COMPONENTS_COMPONENTTYPE_H_
+
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_atomic.h>
+
+namespace Comp2D
+{
+	namespace Components
+	{
+		class Component;
+
+		// Roles the engine dispatches on, combined as bit flags
+		enum class EComponentRole : Uint32
+		{
+			None = 0,
+			GameObjectBehavior = 1 << 0,
+			Renderable = 1 << 1,
+			ResourceComponent = 1 << 2,
+			AnimationsController = 1 << 3,
+			TimelinesController = 1 << 4,
+			PhysicsTransform = 1 << 5
+		};
+
+		// Gives every Component type looked up by a GameObject a compact ID,
+		// along with the test of whether a Component is of that type. The
+		// tests only run when a Component or a type is first indexed
+		class ComponentType
+		{
+		private:
+			ComponentType() = delete;
+
+			static SDL_SpinLock typesLock;
+
+			static std::vector<bool (*)( const Component* )> instanceTests;
+
+			static Uint32 registerType( bool (*instanceTest)( const Component* ) );
+
+			template <typename T>
+			static bool isInstanceOf( const Component* component )
+			{
+				return dynamic_cast<const T*>( component ) != nullptr;
+			}
+
+		public:
+			template <typename T>
+			static Uint32 getID()
+			{
+				static const Uint32 typeID = registerType( &isInstanceOf<T> );
+
+				return typeID;
+			}
+
+			static bool isInstance( Uint32 typeID, const Component* component );
+
+			static Uint32 getRoles( const Component* component );
+			static Uint32 getTypesCount();
+		};
+	}
+}
+
+#endif /* Comp2D_HEADERS_COMPONENTS_COMPONENTTYPE_H_ */
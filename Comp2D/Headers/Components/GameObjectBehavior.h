@@ -77,6 +77,19 @@ namespace Comp2D
 			virtual void endContact( b2Contact* contact, Comp2D::Objects::GameObject* otherGameObject );
 			virtual void postSolve( b2Contact* contact, const b2ContactImpulse* impulse, Comp2D::Objects::GameObject* otherGameObject );
 			virtual void preSolve( b2Contact* contact, const b2Manifold* oldManifold, Comp2D::Objects::GameObject* otherGameObject );
+
+			// A parallel safe behavior only writes to its own GameObject and
+			// makes no structural changes on update, so it may be updated on
+			// any thread, after the other behaviors of the frame. It may set
+			// its transform, but not translate or rotate it, as those notify
+			// the other behaviors and the child GameObjects. The behaviors of
+			// a GameObject with a PhysicsTransformComponent are never updated
+			// in parallel, since its body lives in the b2World
+			virtual bool isParallelSafe() const;
+
+			// onEvent only receives the subscribed event types
+			void subscribeToEvent( Uint32 eventType, SDL_Keycode key = SDLK_UNKNOWN );
+			void unsubscribeFromEvent( Uint32 eventType, SDL_Keycode key = SDLK_UNKNOWN );
 		};
 	}
 }
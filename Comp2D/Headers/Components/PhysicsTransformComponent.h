@@ -85,6 +85,15 @@ namespace Comp2D
 		protected:
 			b2Body* m_body = nullptr;
 
+			float32& previousWorldRotation() { return m_storage->previousWorldRotations[m_storageIndex]; }
+
+			b2Vec2& previousWorldPosition() { return m_storage->previousWorldPositions[m_storageIndex]; }
+
+			const float32& previousWorldRotation() const { return m_storage->previousWorldRotations[m_storageIndex]; }
+
+			const b2Vec2& previousWorldPosition() const { return m_storage->previousWorldPositions[m_storageIndex]; }
+
+			void savePreviousWorldTransform();
 			void updateTransform() override;
 
 		public:
@@ -134,12 +143,19 @@ namespace Comp2D
 
 			Comp2D::Utilities::Vector2D<int> getScreenPosition() const override;
 
+			float32 getInterpolatedWorldRotation() const override;
+
+			Comp2D::Utilities::Vector2D<int> getInterpolatedScreenPosition() const override;
+
 			void applyAngularImpulse( float32 impulse, bool wake );
 			void applyForce( const b2Vec2& force, const b2Vec2& point, bool wake );
 			void applyForceToCenter( const b2Vec2& force, bool wake );
 			void applyLinearImpulse( const b2Vec2& impulse, const b2Vec2& point, bool wake );
 			void applyLinearImpulseToCenter( const b2Vec2& impulse, bool wake );
 			void applyTorque( float32 torque, bool wake );
+			// Removes the body from its b2World, before a GameObject is
+			// destroyed while the b2World goes on
+			void destroyBody();
 			void destroyFixture( b2Fixture* fixture );
 			void dump();
 			void getMassData( b2MassData* data ) const;
@@ -212,6 +228,8 @@ namespace Comp2D
 			b2World* getWorld();
 
 			const b2World* getWorld() const;
+
+			friend class Comp2D::States::PhysicsGameState;
 		};
 	}
 }
@@ -40,6 +40,8 @@ namespace Comp2D
 			RenderLayersCount
 		};
 
+		class Component;
+
 		class Renderable
 		{
 		public:
@@ -47,6 +49,9 @@ namespace Comp2D
 
 			ERenderLayer renderLayer;
 
+			// Set when added to its GameObject
+			Component* component = nullptr;
+
 			Renderable( int orderInRenderLayer = 0, ERenderLayer renderLayer = ERenderLayer::Default );
 
 			virtual ~Renderable();
@@ -51,6 +51,15 @@ namespace Comp2D
 		class ScreenSpaceTransformComponent : public TransformComponent
 		{
 		protected:
+			// Its local position placed under the parent screen position, with
+			// the sine and cosine of the parent world rotation
+			b2Vec2 getWorldPositionUnderParent
+			(
+				const Comp2D::Utilities::Vector2D<int>& parentScreenPosition,
+				float32 parentWorldRotationCosine,
+				float32 parentWorldRotationSine
+			) const;
+
 			void updateTransform() override;
 
 		public:
@@ -81,6 +90,12 @@ namespace Comp2D
 			b2Vec2 getPhysicsWorldPosition() const override;
 
 			Comp2D::Utilities::Vector2D<int> getScreenPosition() const override;
+
+			// Under a parent, both follow the interpolated parent transform, so
+			// children of physics bodies are drawn where their parents are
+			float32 getInterpolatedWorldRotation() const override;
+
+			Comp2D::Utilities::Vector2D<int> getInterpolatedScreenPosition() const override;
 		};
 	}
 }
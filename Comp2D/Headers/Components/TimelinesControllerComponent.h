@@ -74,7 +74,7 @@ namespace Comp2D
 
 			void setTimelinesControllerResource( Comp2D::Resources::GenericResource<Comp2D::Timelines::TimelinesController>* timelinesControllerResource );
 			void setPausable( bool pausable );
-			void update( Uint32 currentTime );
+			void update( Uint64 currentTime );
 
 			bool isPausable() const;
 
@@ -27,11 +27,14 @@
 #ifndef Comp2D_HEADERS_COMPONENTS_TRANSFORMCOMPONENT_H_
 #define Comp2D_HEADERS_COMPONENTS_TRANSFORMCOMPONENT_H_
 
+#include <SDL.h>
+
 #include "Box2D/Common/b2Math.h"
 #include "Box2D/Common/b2Settings.h"
 
 #include "Comp2D/Headers/Components/Component.h"
 #include "Comp2D/Headers/Components/GameObjectBehaviors/ObjectPool.h"
+#include "Comp2D/Headers/Components/TransformComponentsStorage.h"
 #include "Comp2D/Headers/Objects/GameObject.h"
 #include "Comp2D/Headers/States/GameState.h"
 #include "Comp2D/Headers/States/PhysicsGameState.h"
@@ -44,13 +47,36 @@ namespace Comp2D
 		class TransformComponent : public Component
 		{
 		protected:
-			float32 m_localRotation;
-			float32 m_worldRotation;
+			// Whether m_storage was created for this TransformComponent alone,
+			// when its GameState has no TransformComponentsStorage to share
+			bool m_ownsStorage;
+
+			Uint32 m_storageIndex;
+
+			TransformComponentsStorage* m_storage;
+
+			// Facade over the TransformComponentsStorage entry. The references
+			// are only valid until the next TransformComponent is added
+			float32& localRotation() { return m_storage->localRotations[m_storageIndex]; }
+			float32& worldRotation() { return m_storage->worldRotations[m_storageIndex]; }
+
+			b2Vec2& localPosition() { return m_storage->localPositions[m_storageIndex]; }
+			b2Vec2& localScale() { return m_storage->localScales[m_storageIndex]; }
+			b2Vec2& worldPosition() { return m_storage->worldPositions[m_storageIndex]; }
+			b2Vec2& worldScale() { return m_storage->worldScales[m_storageIndex]; }
 
-			b2Vec2 m_localPosition;
-			b2Vec2 m_localScale;
-			b2Vec2 m_worldPosition;
-			b2Vec2 m_worldScale;
+			const float32& localRotation() const { return m_storage->localRotations[m_storageIndex]; }
+			const float32& worldRotation() const { return m_storage->worldRotations[m_storageIndex]; }
+
+			const b2Vec2& localPosition() const { return m_storage->localPositions[m_storageIndex]; }
+			const b2Vec2& localScale() const { return m_storage->localScales[m_storageIndex]; }
+			const b2Vec2& worldPosition() const { return m_storage->worldPositions[m_storageIndex]; }
+			const b2Vec2& worldScale() const { return m_storage->worldScales[m_storageIndex]; }
+
+			// Recomputes the world transform when it or an ancestor changed,
+			// caching the sine and cosine of the new world rotation for the
+			// children
+			void refreshTransform();
 
 			virtual void updateTransform() = 0;
 
@@ -74,6 +100,10 @@ namespace Comp2D
 
 			virtual Comp2D::Utilities::Vector2D<int> getScreenPosition() const = 0;
 
+			virtual float32 getInterpolatedWorldRotation() const;
+
+			virtual Comp2D::Utilities::Vector2D<int> getInterpolatedScreenPosition() const;
+
 			virtual void setLocalPosition( b2Vec2 position );
 			virtual void setLocalRotation( float32 rotation );
 			virtual void setLocalScale( b2Vec2 scale );
@@ -81,6 +111,7 @@ namespace Comp2D
 			virtual void setWorldRotation( float32 rotation );
 			virtual void setWorldScale( b2Vec2 scale );
 
+			void markDirty();
 			void rotate( float32 rotation );
 			void setLocalPosition( float32 x, float32 y );
 			void setLocalScale( float32 x, float32 y );
@@ -89,11 +120,15 @@ namespace Comp2D
 			void translate( b2Vec2 translation );
 			void translate( float32 x, float32 y );
 
+			bool isDirty() const;
+
 			float32 getLocalRotation() const;
 			float32 getLocalRotationInRadians() const;
 			//float32 getLocalRotationUpTo360() const;
 			float32 getWorldRotation() const;
 			float32 getWorldRotationInRadians() const;
+			float32 getWorldRotationCosine() const;
+			float32 getWorldRotationSine() const;
 			//float32 getWorldRotationUpTo360() const;
 
 			b2Vec2 getLocalPosition() const;
@@ -103,6 +138,7 @@ namespace Comp2D
 
 			friend class Comp2D::States::GameState;
 			friend class Comp2D::States::PhysicsGameState;
+			friend class Comp2D::Components::TransformComponentsStorage;
 			friend class Comp2D::Components::GameObjectBehaviors::ObjectPool;
 		};
 	}
@@ -0,0 +1,97 @@
+/* TransformComponentsStorage.h -- 'Comp2D' Game Engine 'TransformComponentsStorage' class header file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#ifndef Comp2D_HEADERS_COMPONENTS_TRANSFORMCOMPONENTSSTORAGE_H_
+#define Comp2D_HEADERS_COMPONENTS_TRANSFORMCOMPONENTSSTORAGE_H_
+
+#include <vector>
+
+#include <SDL.h>
+
+#include "Box2D/Common/b2Math.h"
+#include "Box2D/Common/b2Settings.h"
+
+class b2Body;
+
+namespace Comp2D
+{
+	namespace Components
+	{
+		class TransformComponent;
+
+		// Structure of arrays with the hot data of the TransformComponents of
+		// a GameState. Entry i of every array belongs to transformComponents[i];
+		// removals move the last entry into the freed slot, so the arrays stay
+		// dense and the passes over them are linear. Indices are only stable
+		// until the next removal
+		class TransformComponentsStorage
+		{
+		public:
+			std::vector<float32> localRotations;
+			std::vector<float32> previousWorldRotations;
+			std::vector<float32> worldRotations;
+			// Of the world rotations, cached when they are computed
+			std::vector<float32> worldRotationsCosines;
+			std::vector<float32> worldRotationsSines;
+
+			// Set on changes, cleared once the world transform is recomputed
+			std::vector<Uint8> dirtyFlags;
+
+			std::vector<b2Vec2> localPositions;
+			std::vector<b2Vec2> localScales;
+			std::vector<b2Vec2> previousWorldPositions;
+			std::vector<b2Vec2> worldPositions;
+			std::vector<b2Vec2> worldScales;
+
+			// nullptr for the non physics TransformComponents
+			std::vector<b2Body*> bodies;
+
+			std::vector<TransformComponent*> transformComponents;
+
+			TransformComponentsStorage();
+
+			~TransformComponentsStorage();
+
+			// After a physics step, for the bodies the solver may have moved
+			void markAwakeBodiesDirty();
+			void remove( Uint32 index );
+			void reserve( Uint32 count );
+			void savePreviousWorldTransforms();
+
+			Uint32 add
+			(
+				TransformComponent* transformComponent,
+				b2Vec2 localPosition,
+				float32 localRotation,
+				b2Vec2 localScale
+			);
+
+			Uint32 getCount() const;
+		};
+	}
+}
+
+#endif /* Comp2D_HEADERS_COMPONENTS_TRANSFORMCOMPONENTSSTORAGE_H_ */
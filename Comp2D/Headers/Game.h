@@ -30,6 +30,7 @@
 #include <functional>
 #include <list>
 #include <string>
+#include <vector>
 
 #include <SDL.h>
 #include <SDL_thread.h>
@@ -37,21 +38,38 @@
 #include "Box2D/Common/b2Math.h"
 
 #include "Comp2D/Headers/DataManagement/DataManager.h"
+#include "Comp2D/Headers/Jobs/JobCounter.h"
+#include "Comp2D/Headers/Jobs/JobSystem.h"
 #include "Comp2D/Headers/Random/RandomNumberGenerator.h"
+#include "Comp2D/Headers/Rendering/RenderPipeline.h"
 #include "Comp2D/Headers/Resources/ResourcesManager.h"
 #include "Comp2D/Headers/Settings/GameSettings.h"
+#include "Comp2D/Headers/Time/FrameStatistics.h"
+#include "Comp2D/Headers/Time/TimedProcedureHandle.h"
+#include "Comp2D/Headers/Time/TimedProceduresScheduler.h"
 #include "Comp2D/Headers/Utilities/Vector2D.h"
 
 // TODO: Mudar esquema de classe estática para Singleton do objeto game,
 // 		 para fins de segurança
 // TODO: Usar <iterator> std::begin, std::end, std::rbegin() e std::rend() para
 //		 iterar no array de GameState
-// TODO: BUG: updateFramesPerSecondThroughDeltaTime com FPS acima de 300 retorna 1000 ou 500
 // TODO: (OPCIONAL) Colocar get e set para cor de SDL_RenderClear no updateLoop
 // TODO: (OPCIONAL) Criar um medidor de Average State FPS
 
 namespace Comp2D
 {
+	class GameContext;
+
+	namespace Jobs
+	{
+		class ProceduresQueue;
+	}
+
+	namespace Quality
+	{
+		class QualityGovernor;
+	}
+
 	namespace States
 	{
 		class GameState;
@@ -59,9 +77,7 @@ namespace Comp2D
 
 	namespace Time
 	{
-		class TimedProcedure;
 		class TimeManager;
-		class Timer;
 	}
 
 	class Game
@@ -69,95 +85,141 @@ namespace Comp2D
 	private:
 		Game() = delete;
 
-		static bool inStateTransition;
-		static bool paused;
-		static bool pausedTimeScale;
-		static bool quit;
+		static bool contextsStarted;
+
+		static int commandLineArgumentsCount;
 
 		constexpr static Uint32 FIRST_STATE_ID = 0;
 		// Change this when adding States
 		constexpr static Uint32 NUMBER_OF_STATES = 1;
 
-		static unsigned int gameTimedProcedureID;
-
-		static Uint32 averageFramesPerSecond;
-		static Uint32 currentStateID;
-		static Uint32 framesPerSecond;
-		static Uint32 framesPerSecondThroughDeltaTime;
-		static Uint32 lastFPSUpdateTime;
-		static Uint32 nextStateID;
-		static Uint32 timeOnLastFrameStartedRendering;
-		static Uint32 timeOnLastFrameFinishedRendering;
-		static Uint32 totalRenderedFramesSinceLastFPSUpdate;
 		static Uint32 windowPixelFormat;
 
-		static Uint64 totalRenderedFrames;
-
-		static float timeScaleOnPaused;
+		// Time spent per frame completing the loading of the next GameState
+		// Resources during an asynchronous transition
+		constexpr static Uint64 ASYNC_STATE_TRANSITION_LOADING_BUDGET_IN_NANOSECONDS = 4000000;
 
-		static b2Vec2 cameraPosition;
+		// Render scale levels of the quality governor go 1, 0.85, 0.7 and 0.55
+		constexpr static Uint32 RENDER_SCALE_QUALITY_LEVELS_COUNT = 4;
+		constexpr static float RENDER_SCALE_QUALITY_LEVEL_STEP = 0.15f;
 
-		static std::list<SDL_TimerID> gameTimerFunctionsIDs;
+		// Pooled slots, so posting does not allocate unless it overflows
+		constexpr static Uint32 POSTED_PROCEDURES_QUEUE_CAPACITY = 1024;
 
-		static std::list<SDL_Thread*> gameSeparateThreadFunctions;
+		static std::vector<SDL_Event> pendingEvents;
 
-		static std::list<Comp2D::Time::TimedProcedure*> gameTimedProcedures;
-		static std::list<Comp2D::Time::TimedProcedure*> gamePausableTimedProcedures;
+		static Comp2D::Jobs::ProceduresQueue* postedProceduresQueue;
 
-		static Comp2D::States::GameState** gameStates;
+		static char** commandLineArguments;
 
-		static Comp2D::Time::Timer timeSinceFirstFrameTimer;
+		// The context of the simulation the calling thread is working on
+		static thread_local Comp2D::GameContext* context;
 
 		static bool initialize();
 		static void initializeGameSettings();
 		static bool initializeGameWindow();
 		static bool initializeRenderer();
+		static void initializeRenderPipeline();
 		static bool initializeImageLoader();
 		static bool initializeAudio();
 		static void initializeTimeManager();
+		static void initializeJobSystem();
+		static void initializePostedProceduresQueue();
 		static void initializeDataManager();
+		static void initializeInputsRecording();
 		static void initializeRandomNumberGenerator();
 		static void initializeResourcesManager();
 		static void initializeInputs();
+		static void initializeContext();
+		static void initializeQualityGovernor();
 		static void initializeStates();
+		// SDL_image, SDL_ttf, SDL_mixer and the saved data do not depend on
+		// the window, so they start on the job workers. The errors of the
+		// libraries that failed are left non empty
+		static void startLibrariesInitializations
+		(
+			Comp2D::Jobs::JobCounter& counter,
+			std::string& imageLoaderError,
+			std::string& fontsError,
+			std::string& audioError
+		);
 		static void startUpdateLoop();
+		static void startPipelinedUpdateLoop();
+		static void startHeadlessUpdateLoop();
+		static void startContextsUpdateLoop( const std::vector<Comp2D::GameContext*>& contexts );
 		static void finalize();
+		static void finalizeContext();
+		static void finalizeAsyncStateTransition();
 		static void finalizeGameTimerFunctions();
 		static void finalizeGameTimedProcedures();
 		static void finalizeGameSeparateThreadsFunctions();
 		static void finalizeStates();
 		static void finalizeInputs();
+		static void finalizeInputsRecording();
 		static void finalizeResourcesManager();
 		static void finalizeRandomNumberGenerator();
 		static void finalizeDataManager();
+		static void finalizeJobSystem();
+		static void finalizePostedProceduresQueue();
 		static void finalizeTimeManager();
 		static void finalizeAudio();
 		static void finalizeImageLoader();
+		static void finalizeRenderPipeline();
 		static void finalizeRenderer();
 		static void finalizeGameWindow();
 		static void finalizeGameSettings();
 
+		static bool updateStateTransitions();
+
+		static void beginAsyncStateTransition();
 		static void checkGameTimedProcedures();
+		static void completeAsyncStateTransition();
+		static void logInputsReplayReport();
 		static void pauseGameTimedProcedures();
+		static void performStateTransition();
+		static void resetFrameClock();
+		static void runContextTick();
+		static void runFixedUpdates();
+		static void runPostedProcedures();
+		static void runSimulationFrame();
 		static void unpauseGameTimedProcedures();
 		static void updateAverageFramePerSecond();
 		static void updateFramesPerSecond();
 		static void updateFramesPerSecondThroughDeltaTime();
+		static void updateQualityGovernor( Uint64 frameTimeInNanoseconds );
+		// Of the Game and the current GameState, so their handles do not
+		// pile up until finalize
+		static void waitForDoneSeparateThreadsFunctions();
+		static void waitForEventsUntil( Uint64 wakeUpTimeInNanoseconds );
+
+		// Paused games, hidden windows and, when enabled, unfocused ones run
+		// at the throttled tick rate, sleeping on the event queue in between
+		static bool isUpdateLoopThrottled( bool windowHidden );
+		// Minimized windows count as hidden
+		static bool isWindowHidden();
+
+		static Uint64 getThrottledTickIntervalInNanoseconds();
+
+		// Add States Here
+		static Comp2D::States::GameState* createState( Uint32 stateID );
+		// Creates the GameState on its first use, only the first one is
+		// created on initialization
+		static Comp2D::States::GameState* getState( Uint32 stateID );
 
 	public:
+		constexpr static Uint32 NO_STATE_ID = SDL_MAX_UINT32;
+
 		static SDL_Window* window;
 
 		static SDL_Renderer* renderer;
 
+		static Comp2D::Rendering::RenderPipeline* renderPipeline;
+
 		static Settings::GameSettings* gameSettings;
 
 		static Comp2D::DataManagement::DataManager* dataManager;
 
-		static Comp2D::Time::TimeManager* timeManager;
-
-		static Comp2D::Random::RandomNumberGenerator* randomNumberGenerator;
-
-		static Comp2D::Resources::ResourcesManager* resourcesManager;
+		static Comp2D::Jobs::JobSystem* jobSystem;
 
 		static void callFunctionAfterTimeOnSeparateThread
 		(
@@ -172,7 +234,8 @@ namespace Comp2D
 			void* data,
 			const std::string& threadName
 		);
-		static void callProcedureAfterTimeOnGameThread
+		// Game thread only, other threads should post a procedure that calls it
+		static Comp2D::Time::TimedProcedureHandle callProcedureAfterTimeOnGameThread
 		(
 			std::function<void()> timedProcedure,
 			Uint32 callbackTimeInMilliseconds,
@@ -181,7 +244,12 @@ namespace Comp2D
 			bool useDeltaTime = true*/
 		);
 		static void pause( bool pauseTimeScale = true );
+		// Safe from any thread, including SDL audio callbacks. The procedures
+		// run in order at the start of the next simulation frames, on the
+		// context of the posting thread when it has one
+		static void postProcedureToGameThread( std::function<void()> procedure );
 		static void quitGame();
+		static void resetFrameStatistics();
 		static void reportError
 		(
 			const std::string& errorTitle,
@@ -190,10 +258,20 @@ namespace Comp2D
 			bool quitGameAfterReport = true
 		);
 		static void setCameraPosition( const b2Vec2& position );
-		static void start();
+		static void start( int argc = 0, char* argv[] = nullptr );
+		// Runs contextsCount independent headless simulations, each one in its
+		// own GameContext, stepping them together on the job workers until
+		// every one of them has quit
+		static void startContexts( Uint32 contextsCount, int argc = 0, char* argv[] = nullptr );
 		static void startStateTransition( Uint32 nextStateID );
 		static void unpause();
 
+		// Sets the next GameState up and preloads its Resources on the job
+		// workers while the current GameState, or the optional loading one,
+		// keeps running. The switch only happens once everything is loaded
+		static bool startAsyncStateTransition( Uint32 nextStateID, Uint32 loadingStateID = NO_STATE_ID );
+
+		static bool isInAsyncStateTransition();
 		static bool isPaused();
 
 		static Uint32 getAverageFramesPerSecond();
@@ -202,12 +280,34 @@ namespace Comp2D
 		static Uint32 getFramesPerSecondThroughDeltaTime();
 		static Uint32 getWindowPixelFormat();
 
+		// Rolling over the most recent frames
+		static Uint64 getFrameTimePercentileInNanoseconds( float percentile );
+		static Uint64 getFrameTimeP50InNanoseconds();
+		static Uint64 getFrameTimeP95InNanoseconds();
+		static Uint64 getFrameTimeP99InNanoseconds();
+		static Uint64 getMaximumFrameTimeInNanoseconds();
+		// Cumulative since the last frame statistics reset
+		static Uint64 getFrameTimeHistogramBucketFramesCount( Uint32 bucketIndex );
+		static Uint64 getOverBudgetFramesCount();
+
 		static float getCameraPositionX();
 		static float getCameraPositionY();
+		// From 0 to 1, 1 when no asynchronous transition is in progress
+		static float getStateTransitionProgress();
 
 		static Comp2D::Utilities::Vector2D<int> getCameraScreenPosition();
 
 		static const b2Vec2& getCameraPosition();
+
+		static Comp2D::Quality::QualityGovernor* getQualityGovernor();
+
+		static Comp2D::Random::RandomNumberGenerator* getRandomNumberGenerator();
+
+		static Comp2D::Resources::ResourcesManager* getResourcesManager();
+
+		static Comp2D::Time::TimeManager* getTimeManager();
+
+		friend class Comp2D::GameContext;
 	};
 }
 
@@ -0,0 +1,150 @@
+/* GameContext.h -- 'Comp2D' Game Engine 'GameContext' class header file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#ifndef Comp2D_HEADERS_GAMECONTEXT_H_
+#define Comp2D_HEADERS_GAMECONTEXT_H_
+
+#include <list>
+
+#include <SDL.h>
+
+#include "Box2D/Common/b2Math.h"
+
+#include "Comp2D/Headers/Quality/QualityGovernor.h"
+#include "Comp2D/Headers/Time/FrameStatistics.h"
+#include "Comp2D/Headers/Time/TimedProceduresScheduler.h"
+#include "Comp2D/Headers/Time/Timer.h"
+
+namespace Comp2D
+{
+	namespace Inputs
+	{
+		class InputsRecording;
+	}
+
+	namespace Jobs
+	{
+		class SeparateThreadFunctionCall;
+	}
+
+	namespace Random
+	{
+		class RandomNumberGenerator;
+	}
+
+	namespace Resources
+	{
+		class ResourcesManager;
+		class ResourcesPreload;
+	}
+
+	namespace States
+	{
+		class GameState;
+	}
+
+	namespace Time
+	{
+		class TimeManager;
+	}
+
+	// Everything one simulation owns: its GameStates, clock, random number
+	// generator, Resources, timed procedures and state transitions. The
+	// window, renderer, settings and Job System are shared by the process.
+	//
+	// Game works on the context current to the calling thread. Jobs run with
+	// the context they were queued from, so several contexts can be stepped
+	// at once on the job workers, see Game::startContexts
+	class GameContext
+	{
+	public:
+		bool asyncStateTransitionRequested;
+		bool inStateTransition;
+		bool paused;
+		bool pausedTimeScale;
+		bool previousFrameThrottled;
+		bool quit;
+
+		Uint32 asyncStateTransitionLoadingStateID;
+		Uint32 asyncStateTransitionNextStateID;
+		Uint32 averageFramesPerSecond;
+		Uint32 currentStateID;
+		Uint32 framesPerSecond;
+		Uint32 framesPerSecondThroughDeltaTime;
+		Uint32 nextStateID;
+		Uint32 totalRenderedFramesSinceLastFPSUpdate;
+
+		Uint64 lastFPSUpdateTime;
+		Uint64 simulationFrameDurationInNanoseconds;
+		Uint64 timeOnLastFrameStarted;
+		Uint64 totalRenderedFrames;
+
+		float asyncStateTransitionNextStateFixedDeltaTimeInSeconds;
+		float fixedUpdatesAccumulatedTimeInSeconds;
+		float timeScaleOnPaused;
+
+		b2Vec2 cameraPosition;
+
+		std::list<SDL_TimerID> gameTimerFunctionsIDs;
+
+		std::list<Comp2D::Jobs::SeparateThreadFunctionCall*> gameSeparateThreadFunctions;
+
+		Comp2D::Quality::QualityGovernor qualityGovernor;
+
+		Comp2D::Time::FrameStatistics frameStatistics;
+
+		Comp2D::Time::TimedProceduresScheduler gameTimedProceduresScheduler;
+
+		Comp2D::Inputs::InputsRecording* inputsRecording;
+
+		Comp2D::Random::RandomNumberGenerator* randomNumberGenerator;
+
+		Comp2D::Resources::ResourcesManager* resourcesManager;
+
+		Comp2D::Resources::ResourcesPreload* asyncStateTransitionResourcesPreload;
+
+		Comp2D::States::GameState** gameStates;
+		// Set while a GameState runs its setup, which an async state
+		// transition does before that GameState becomes the current one
+		Comp2D::States::GameState* settingUpGameState;
+
+		Comp2D::Time::TimeManager* timeManager;
+
+		Comp2D::Time::Timer timeSinceFirstFrameTimer;
+
+		GameContext();
+
+		~GameContext();
+
+		GameContext( const GameContext& copiedGameContext ) = delete;
+
+		static void setCurrent( GameContext* gameContext );
+
+		static GameContext* getCurrent();
+	};
+}
+
+#endif /* Comp2D_HEADERS_GAMECONTEXT_H_ */
@@ -0,0 +1,118 @@
+/* InputsRecording.h -- 'Comp2D' Game Engine 'InputsRecording' class header file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#ifndef Comp2D_HEADERS_INPUTS_INPUTSRECORDING_H_
+#define Comp2D_HEADERS_INPUTS_INPUTSRECORDING_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+
+#include "Comp2D/Headers/Inputs/Keyboard.h"
+
+namespace Comp2D
+{
+	namespace Inputs
+	{
+		// Records, or replays, the keyboard and mouse states of every frame
+		// along with its delta time, the random seed and the fixed delta time,
+		// so a session can be replayed headlessly and always run the same way.
+		//
+		// Frames are kept in memory and written after a small header on
+		// finishRecording. Each one stores its delta time, the mouse state and
+		// only the keys that changed, as variable length integers
+		class InputsRecording
+		{
+		private:
+			bool m_recording;
+			bool m_replaying;
+
+			Uint8 m_keyboardState[Comp2D::Inputs::Keyboard::KEYBOARD_NUM_KEYS];
+
+			int m_mouseX;
+			int m_mouseY;
+
+			unsigned int m_randomSeed;
+
+			Uint32 m_mouseState;
+
+			Uint64 m_framesCount;
+
+			float m_fixedDeltaTimeInSeconds;
+
+			std::size_t m_replayPosition;
+
+			std::string m_recordingFilePath;
+
+			std::vector<Uint8> m_data;
+
+			std::vector<Uint16> m_changedKeysScancodes;
+
+			bool readUnsignedInteger( Uint64& value );
+			bool readSignedInteger( Sint64& value );
+
+			static void writeUnsignedInteger( Uint64 value, std::vector<Uint8>& data );
+			static void writeSignedInteger( Sint64 value, std::vector<Uint8>& data );
+
+		public:
+			// "C2DI" read as a little endian integer
+			static constexpr Uint32 FORMAT_MAGIC = 0x49443243;
+			static constexpr Uint32 FORMAT_VERSION = 1;
+
+			InputsRecording();
+			~InputsRecording();
+
+			InputsRecording( const InputsRecording& copiedInputsRecording ) = delete;
+
+			bool finishRecording();
+			bool loadReplay( const std::string& replayFilePath );
+			void startRecording( const std::string& recordingFilePath, float fixedDeltaTimeInSeconds );
+
+			// Call after the input devices states have been updated
+			void recordFrame( Uint64 deltaTimeInNanoseconds );
+
+			// Sets the input devices states of the next frame and returns its
+			// delta time, or false once every frame has been replayed
+			bool replayFrame( Uint64& deltaTimeInNanoseconds );
+
+			// Only kept while recording, since a replay brings its own
+			void setRandomSeed( unsigned int randomSeed );
+
+			bool isRecording() const;
+			bool isReplaying() const;
+
+			unsigned int getRandomSeed() const;
+
+			Uint64 getFramesCount() const;
+
+			float getFixedDeltaTimeInSeconds() const;
+		};
+	}
+}
+
+#endif /* Comp2D_HEADERS_INPUTS_INPUTSRECORDING_H_ */
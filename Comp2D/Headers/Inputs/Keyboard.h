@@ -49,6 +49,10 @@ namespace Comp2D
 			static bool isKeyHeld( int keyScancode );
 			static bool isKeyUp( int keyScancode );
 
+			static const Uint8* getKeyboardState();
+
+			// Takes KEYBOARD_NUM_KEYS states, e.g. the ones of a replayed frame
+			static void setKeyboardState( const Uint8* currentKeyboardState );
 			static void updateKeyboardState();
 		};
 	}
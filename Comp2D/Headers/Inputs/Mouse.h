@@ -53,6 +53,9 @@ namespace Comp2D
 			static bool isMouseButtonHeld( int mouseButtonValue );
 			static bool isMouseButtonUp( int mouseButtonValue );
 
+			static Uint32 getMouseState();
+
+			static void setMouseState( Uint32 currentMouseState, int currentMouseX, int currentMouseY );
 			static void updateMouseState();
 		};
 	}
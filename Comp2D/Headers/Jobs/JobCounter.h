@@ -0,0 +1,79 @@
+/* JobCounter.h -- 'Comp2D' Game Engine 'JobCounter' class header file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#ifndef Comp2D_HEADERS_JOBS_JOBCOUNTER_H_
+#define Comp2D_HEADERS_JOBS_JOBCOUNTER_H_
+
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_atomic.h>
+
+#include "Comp2D/Headers/Jobs/Job.h"
+
+namespace Comp2D
+{
+	namespace Jobs
+	{
+		class JobSystem;
+
+		// Counts the unfinished Jobs of a group. Jobs that depend on the group
+		// are parked here and released by the JobSystem when it reaches zero
+		class JobCounter
+		{
+		private:
+			SDL_atomic_t m_value;
+
+			SDL_SpinLock m_waitingJobsLock;
+
+			std::vector<Job> m_waitingJobs;
+
+			void increment( int amount = 1 );
+
+			// Takes the waiting Jobs in the same lock as the decrement reaching
+			// zero, so the counter is not touched anymore once isDone sees it
+			bool decrement( std::vector<Job>& releasedJobs );
+			bool addWaitingJob( const Job& job );
+
+		public:
+			JobCounter();
+
+			~JobCounter();
+
+			JobCounter( const JobCounter& copiedJobCounter ) = delete;
+
+			// Under the lock of the waiting Jobs, so a waiter may destroy the
+			// counter as soon as it returns true
+			bool isDone();
+
+			int getValue();
+
+			friend class Comp2D::Jobs::JobSystem;
+		};
+	}
+}
+
+#endif /* Comp2D_HEADERS_JOBS_JOBCOUNTER_H_ */
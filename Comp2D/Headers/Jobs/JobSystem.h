@@ -0,0 +1,104 @@
+/* JobSystem.h -- 'Comp2D' Game Engine 'JobSystem' class header file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#ifndef Comp2D_HEADERS_JOBS_JOBSYSTEM_H_
+#define Comp2D_HEADERS_JOBS_JOBSYSTEM_H_
+
+#include <deque>
+#include <functional>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_atomic.h>
+#include <SDL_thread.h>
+
+#include "Comp2D/Headers/Jobs/Job.h"
+#include "Comp2D/Headers/Jobs/JobCounter.h"
+
+namespace Comp2D
+{
+	namespace Jobs
+	{
+		// Fixed pool of worker threads. Every worker owns a deque: it pops its
+		// own Jobs from the back and, when it runs dry, steals from the front
+		// of the other workers' deques. Threads that wait on a JobCounter help
+		// running Jobs instead of blocking
+		class JobSystem
+		{
+		private:
+			SDL_atomic_t m_nextWorkerIndex;
+			SDL_atomic_t m_quit;
+			SDL_atomic_t m_startedWorkersCount;
+
+			Uint32 m_workersCount;
+
+			SDL_TLSID m_workerIndexTLSID;
+
+			SDL_sem* m_pendingJobsSemaphore;
+
+			std::vector<SDL_SpinLock> m_workersJobsLocks;
+
+			std::vector<SDL_Thread*> m_workersThreads;
+
+			std::vector<std::deque<Job>> m_workersJobs;
+
+			static int workerThreadFunction( void* data );
+
+			void finishJob( const Job& job );
+			void pushJob( const Job& job );
+			void runJob( const Job& job );
+
+			bool popJob( Uint32 workerIndex, Job& job );
+			bool stealJob( Uint32 firstVictimIndex, Job& job );
+			bool tryRunPendingJob();
+
+			int getCurrentWorkerIndex();
+
+		public:
+			JobSystem( Uint32 workersCount );
+
+			~JobSystem();
+
+			void parallelFor
+			(
+				Uint32 iterationsCount,
+				Uint32 batchSize,
+				std::function<void(Uint32, Uint32)> batchProcedure
+			);
+			void run
+			(
+				std::function<void()> procedure,
+				JobCounter* counter = nullptr,
+				JobCounter* dependency = nullptr
+			);
+			void waitForCounter( JobCounter* counter );
+
+			Uint32 getWorkersCount() const;
+		};
+	}
+}
+
+#endif /* Comp2D_HEADERS_JOBS_JOBSYSTEM_H_ */
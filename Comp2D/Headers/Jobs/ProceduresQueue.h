@@ -0,0 +1,101 @@
+/* ProceduresQueue.h -- 'Comp2D' Game Engine 'ProceduresQueue' class header file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+#ifndef Comp2D_HEADERS_JOBS_PROCEDURESQUEUE_H_
+#define Comp2D_HEADERS_JOBS_PROCEDURESQUEUE_H_
+
+#include <functional>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_atomic.h>
+
+namespace Comp2D
+{
+	class GameContext;
+
+	namespace Jobs
+	{
+		// Multiple producers, single consumer queue of procedures. Producers
+		// claim preallocated slots of a bounded ring with a compare and swap,
+		// so posting neither locks nor allocates while the ring has room. When
+		// it is full the procedures go to a locked overflow list, which keeps
+		// receiving every post until the consumer empties it, so the order of
+		// the procedures posted by each thread is kept
+		class ProceduresQueue
+		{
+		private:
+			class Entry
+			{
+			public:
+				std::function<void()> procedure;
+
+				Comp2D::GameContext* context;
+			};
+
+			class Slot
+			{
+			public:
+				SDL_atomic_t sequence;
+
+				Entry entry;
+			};
+
+			SDL_atomic_t m_enqueuePosition;
+			SDL_atomic_t m_overflowing;
+
+			Uint32 m_dequeuePosition;
+			Uint32 m_drainedOverflowIndex;
+			Uint32 m_slotsMask;
+
+			SDL_SpinLock m_overflowLock;
+
+			std::vector<Entry> m_drainedOverflowEntries;
+			std::vector<Entry> m_overflowEntries;
+
+			std::vector<Slot> m_slots;
+
+			bool tryPopFromOverflow( std::function<void()>& procedure, Comp2D::GameContext*& context );
+			bool tryPopFromSlots( std::function<void()>& procedure, Comp2D::GameContext*& context );
+			bool tryPushToSlots( std::function<void()>& procedure, Comp2D::GameContext* context );
+
+		public:
+			// The capacity is rounded up to a power of two
+			ProceduresQueue( Uint32 capacity );
+
+			~ProceduresQueue();
+
+			ProceduresQueue( const ProceduresQueue& copiedProceduresQueue ) = delete;
+
+			// Any thread
+			void push( std::function<void()> procedure, Comp2D::GameContext* context = nullptr );
+
+			// Consumer thread only
+			bool pop( std::function<void()>& procedure, Comp2D::GameContext*& context );
+		};
+	}
+}
+
+#endif /* Comp2D_HEADERS_JOBS_PROCEDURESQUEUE_H_ */
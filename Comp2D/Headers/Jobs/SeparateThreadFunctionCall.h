@@ -0,0 +1,75 @@
+/* SeparateThreadFunctionCall.h -- 'Comp2D' Game Engine 'SeparateThreadFunctionCall' class header file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+#ifndef Comp2D_HEADERS_JOBS_SEPARATETHREADFUNCTIONCALL_H_
+#define Comp2D_HEADERS_JOBS_SEPARATETHREADFUNCTIONCALL_H_
+
+#include <list>
+#include <string>
+
+#include <SDL.h>
+#include <SDL_atomic.h>
+#include <SDL_thread.h>
+
+namespace Comp2D
+{
+	class GameContext;
+
+	namespace Jobs
+	{
+		// A function given a dedicated SDL_Thread, kept apart from the
+		// JobSystem workers as it may block for as long as it needs. It runs
+		// with the GameContext it was called from. The call is kept by its
+		// caller until its thread is waited for, each frame once it is done
+		class SeparateThreadFunctionCall
+		{
+		private:
+			static int run( void* separateThreadFunctionCall );
+
+		public:
+			int (*separateThreadFunction)(void*);
+
+			void* data;
+
+			Comp2D::GameContext* context;
+
+			SDL_Thread* thread;
+
+			// Set by its thread once the function returned
+			SDL_atomic_t done;
+
+			// Returns nullptr when the thread could not be created
+			static SeparateThreadFunctionCall* start( int (*separateThreadFunction)(void*), void* data, const std::string& threadName );
+
+			// Waits for the threads of the done calls and deletes them, the
+			// others are left running
+			static void waitForDone( std::list<SeparateThreadFunctionCall*>& separateThreadFunctionCalls );
+			// Waits for every thread, the last started first, and deletes them
+			static void waitForAll( std::list<SeparateThreadFunctionCall*>& separateThreadFunctionCalls );
+		};
+	}
+}
+
+#endif /* Comp2D_HEADERS_JOBS_SEPARATETHREADFUNCTIONCALL_H_ */
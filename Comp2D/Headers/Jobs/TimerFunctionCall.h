@@ -0,0 +1,73 @@
+/* TimerFunctionCall.h -- 'Comp2D' Game Engine 'TimerFunctionCall' class header file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#ifndef Comp2D_HEADERS_JOBS_TIMERFUNCTIONCALL_H_
+#define Comp2D_HEADERS_JOBS_TIMERFUNCTIONCALL_H_
+
+#include <unordered_map>
+
+#include <SDL.h>
+#include <SDL_atomic.h>
+
+namespace Comp2D
+{
+	class GameContext;
+
+	namespace Jobs
+	{
+		// A function called back on the SDL timer thread, with the
+		// GameContext it was called from. The calls are kept by an ID of
+		// their own, as the SDL timer may still be running one when it is
+		// removed
+		class TimerFunctionCall
+		{
+		private:
+			static SDL_TimerID lastTimerFunctionCallID;
+
+			static SDL_SpinLock timerFunctionCallsLock;
+
+			static std::unordered_map<SDL_TimerID, TimerFunctionCall> timerFunctionCalls;
+
+			static Uint32 run( Uint32 interval, void* timerFunctionCallID );
+
+		public:
+			Uint32 (*timerFunction)(Uint32, void*);
+
+			void* param;
+
+			Comp2D::GameContext* context;
+
+			SDL_TimerID timerID;
+
+			// Returns 0 when the timer could not be added
+			static SDL_TimerID start( Uint32 (*timerFunction)(Uint32, void*), void* param, Uint32 callbackTimeInMilliseconds );
+
+			static void stop( SDL_TimerID timerFunctionCallID );
+		};
+	}
+}
+
+#endif /* Comp2D_HEADERS_JOBS_TIMERFUNCTIONCALL_H_ */
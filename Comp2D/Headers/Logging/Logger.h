@@ -0,0 +1,106 @@
+/* Logger.h -- 'Comp2D' Game Engine 'Logger' class header file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+#ifndef Comp2D_HEADERS_LOGGING_LOGGER_H_
+#define Comp2D_HEADERS_LOGGING_LOGGER_H_
+
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_atomic.h>
+#include <SDL_mutex.h>
+#include <SDL_thread.h>
+
+#include "Comp2D/Headers/Logging/LogRecord.h"
+
+// Build-time floor applied to every category on initialization, messages
+// below it are discarded by SDL before being formatted
+#ifndef COMP2D_LOG_MINIMUM_PRIORITY
+	#define COMP2D_LOG_MINIMUM_PRIORITY SDL_LOG_PRIORITY_VERBOSE
+#endif
+
+namespace Comp2D
+{
+	namespace Logging
+	{
+		// Replaces the SDL log output. The logging thread only copies the
+		// message into a preallocated record of a ring, and a writer thread
+		// adds the timestamp, priority and category and appends it to the
+		// console and to a log file that stays open. Messages below warnings
+		// logged while the ring is full are dropped and counted
+		class Logger
+		{
+		private:
+			Logger() = delete;
+
+			constexpr static Uint32 RECORDS_COUNT = 4096;
+			constexpr static Uint32 WRITER_WAKE_UP_INTERVAL_IN_MILLISECONDS = 10;
+
+			static SDL_atomic_t droppedRecordsCount;
+			static SDL_atomic_t enqueuePosition;
+			static SDL_atomic_t quit;
+
+			// Only touched by the writer thread
+			static Uint32 dequeuePosition;
+			static Uint32 reportedDroppedRecordsCount;
+
+			static Uint64 performanceCounterFrequency;
+			static Uint64 performanceCounterOnInitialization;
+
+			static void* previousOutputFunctionUserData;
+
+			static SDL_LogOutputFunction previousOutputFunction;
+
+			static SDL_RWops* logFile;
+
+			static SDL_sem* pendingRecordsSemaphore;
+
+			static SDL_Thread* writerThread;
+
+			static std::vector<LogRecord> records;
+
+			static int writerThreadFunction( void* data );
+
+			static void outputFunction( void* userdata, int category, SDL_LogPriority priority, const char* message );
+			static void writePendingRecords();
+
+			static const char* getCategoryName( int category );
+			static const char* getPriorityName( SDL_LogPriority priority );
+
+		public:
+			// An empty path only logs to the console
+			static bool initialize( const std::string& logFilePath );
+			// Writes every pending message and restores the previous output
+			static void finalize();
+			// Messages below the priority are discarded before being formatted
+			static void setCategoryPriority( int category, SDL_LogPriority priority );
+
+			static Uint32 getDroppedRecordsCount();
+		};
+	}
+}
+
+#endif /* Comp2D_HEADERS_LOGGING_LOGGER_H_ */
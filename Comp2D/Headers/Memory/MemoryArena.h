@@ -0,0 +1,89 @@
+/* MemoryArena.h -- 'Comp2D' Game Engine 'MemoryArena' class header file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#ifndef Comp2D_HEADERS_MEMORY_MEMORYARENA_H_
+#define Comp2D_HEADERS_MEMORY_MEMORYARENA_H_
+
+#include <cstddef>
+#include <vector>
+
+#include <SDL.h>
+
+namespace Comp2D
+{
+	namespace Memory
+	{
+		// Bump allocator whose memory is only given back all at once, on its
+		// reset. The blocks are kept by the reset, so what is allocated next
+		// reuses them instead of fragmenting the heap
+		class MemoryArena
+		{
+		private:
+			// Ahead of every allocation made through allocate, holding the
+			// MemoryArena it came from, or nullptr for the global heap
+			constexpr static size_t ALLOCATION_HEADER_SIZE = alignof( std::max_align_t );
+
+			static thread_local MemoryArena* current;
+
+			size_t m_blockSize;
+			size_t m_currentBlockOffset;
+			size_t m_openedBlocksCount = 0;
+			size_t m_usedSize = 0;
+
+			std::vector<Uint8*> m_blocks;
+			// Larger than a block, given back on reset
+			std::vector<Uint8*> m_largeAllocations;
+
+			void* allocateFromBlocks( size_t size );
+
+		public:
+			constexpr static size_t DEFAULT_BLOCK_SIZE = 65536;
+
+			MemoryArena( size_t blockSize = DEFAULT_BLOCK_SIZE );
+
+			~MemoryArena();
+
+			MemoryArena( const MemoryArena& copiedMemoryArena ) = delete;
+
+			// For the class specific operator new and delete. Allocates from
+			// the current MemoryArena of the calling thread, or from the
+			// global heap without one. Deallocating arena memory does nothing
+			static void* allocate( size_t size );
+			static void deallocate( void* pointer );
+
+			static void setCurrent( MemoryArena* memoryArena );
+
+			static MemoryArena* getCurrent();
+
+			// Everything allocated from it must be destroyed by then
+			void reset();
+
+			size_t getUsedSize() const;
+		};
+	}
+}
+
+#endif /* Comp2D_HEADERS_MEMORY_MEMORYARENA_H_ */
@@ -27,6 +27,7 @@
 #ifndef Comp2D_HEADERS_OBJECTS_DEPENDENCY_H_
 #define Comp2D_HEADERS_OBJECTS_DEPENDENCY_H_
 
+#include <cstddef>
 #include <string>
 #include <typeindex>
 #include <typeinfo>
@@ -72,6 +73,10 @@ namespace Comp2D
 			);
 
 			~Dependency();
+
+			// From the MemoryArena of its GameState when created by its setup
+			static void* operator new( size_t size );
+			static void operator delete( void* pointer );
 		};
 	}
 }
@@ -27,9 +27,11 @@
 #ifndef Comp2D_HEADERS_OBJECTS_GAMEOBJECT_H_
 #define Comp2D_HEADERS_OBJECTS_GAMEOBJECT_H_
 
+#include <cstddef>
 #include <list>
 #include <string>
 #include <typeinfo>
+#include <unordered_map>
 #include <vector>
 
 #include <SDL.h>
@@ -38,19 +40,23 @@
 #include "Box2D/Dynamics/b2WorldCallbacks.h"
 #include "Box2D/Dynamics/Contacts/b2Contact.h"
 
+#include "Comp2D/Headers/Components/ComponentType.h"
 #include "Comp2D/Headers/Objects/Dependency.h"
 #include "Comp2D/Headers/States/GameState.h"
 
-// TODO: Utilizar Binary Search nos métodos de get por ID ou por Name
 // TODO: BUG: objetoNãoActiveInHierarchy.setChildGameObjectActiveInHierarchy e
 //		 	  setChildGameObjectActive
-// TODO: (OPCIONAL) removeChildGameObject
 
 namespace Comp2D
 {
 	namespace Components
 	{
+		class AnimationsControllerComponent;
 		class Component;
+		class GameObjectBehavior;
+		class Renderable;
+		class ResourceComponent;
+		class TimelinesControllerComponent;
 		class TransformComponent;
 	}
 
@@ -71,6 +77,9 @@ namespace Comp2D
 
 		class GameObject
 		{
+		private:
+			constexpr static Uint32 NOT_CREATED_CREATION_ORDER = SDL_MAX_UINT32;
+
 		protected:
 			bool m_active;
 			bool m_activeInHierarchy;
@@ -81,6 +90,37 @@ namespace Comp2D
 
 			EGameObjectTag m_tag;
 
+			// Kept by the GameState to patch its active GameObjects arrays in
+			// creation order
+			bool m_activityChangePending = false;
+			bool m_destroyPending = false;
+			bool m_inActiveGameObjects = false;
+			bool m_inActiveRootGameObjects = false;
+
+			Uint32 m_creationOrder = NOT_CREATED_CREATION_ORDER;
+			// Range of the GameState updatable behaviors array
+			Uint32 m_parallelUpdatableBehaviorsCount = 0;
+			Uint32 m_parallelUpdatableBehaviorsIndex = 0;
+			Uint32 m_updatableBehaviorsCount = 0;
+			Uint32 m_updatableBehaviorsIndex = 0;
+
+			// Components of every looked up type, by compact type ID. Types
+			// first looked up after the Components were added are indexed then
+			mutable std::vector<std::vector<Comp2D::Components::Component*>> m_componentsByType;
+
+			// A name shared by several child GameObjects refers to the first
+			// one added
+			std::unordered_map<unsigned int, GameObject*> m_childGameObjectsByID;
+			std::unordered_map<std::string, GameObject*> m_childGameObjectsByName;
+
+			void notifyActivityChanged();
+			void notifyBehaviorRemoved( Comp2D::Components::GameObjectBehavior* behavior );
+			void notifyBehaviorsChanged();
+
+			void indexComponent( Comp2D::Components::Component* component );
+			void indexComponentTypes() const;
+			void unindexComponent( Comp2D::Components::Component* component );
+
 			virtual void setComponentActiveInHierarchy( Comp2D::Components::Component* component, bool activeInHierarchy );
 			virtual void setSelfActiveInHierarchy( bool activeInHierarchy );
 
@@ -95,6 +135,14 @@ namespace Comp2D
 
 			std::vector<Comp2D::Components::Component*> components;
 
+			// Components by role, in the order they were added, so dispatching
+			// to them needs no RTTI
+			std::vector<Comp2D::Components::AnimationsControllerComponent*> animationsControllerComponents;
+			std::vector<Comp2D::Components::GameObjectBehavior*> behaviors;
+			std::vector<Comp2D::Components::Renderable*> renderables;
+			std::vector<Comp2D::Components::ResourceComponent*> resourceComponents;
+			std::vector<Comp2D::Components::TimelinesControllerComponent*> timelinesControllerComponents;
+
 			std::list<GameObject*> activeChildGameObjects;
 			//std::list<GameObject*> activeInHierarchyChildGameObjects;
 
@@ -115,6 +163,10 @@ namespace Comp2D
 
 			virtual ~GameObject();
 
+			// From the MemoryArena of its GameState when created by its setup
+			static void* operator new( size_t size );
+			static void operator delete( void* pointer );
+
 			bool operator==( const GameObject& rhs ) const;
 
 			bool operator!=( const GameObject& rhs ) const;
@@ -139,6 +191,8 @@ namespace Comp2D
 
 			virtual bool isActive() const;
 			virtual bool isActiveInHierarchy() const;
+			// Set once its destroy is recorded, until the sync point deletes it
+			bool isDestroyPending() const;
 
 			unsigned int getID() const;
 
@@ -151,6 +205,8 @@ namespace Comp2D
 			virtual Comp2D::Components::Component* removeComponent( unsigned int id );
 			virtual Comp2D::Components::Component* removeComponent( Comp2D::Components::Component* component );
 
+			// T must be a Component. Looking up a type the first time indexes
+			// it, which must not happen concurrently on the same GameObject
 			template <typename T>
 			T* getComponent() const
 			{
@@ -167,19 +223,21 @@ namespace Comp2D
 					*/
 				#endif
 
-				T* currentComponent = nullptr;
+				Uint32 typeID = Comp2D::Components::ComponentType::getID<T>();
 
-				for( unsigned int i = 0; i < components.size(); ++i )
+				if( typeID >= m_componentsByType.size() )
 				{
-					currentComponent = dynamic_cast<T*>( components[i] );
+					indexComponentTypes();
+				}
+
+				const std::vector<Comp2D::Components::Component*>& typeComponents = m_componentsByType[typeID];
 
-					if( currentComponent )
-					{
-						return currentComponent;
-					}
+				if( typeComponents.empty() )
+				{
+					return nullptr;
 				}
 
-				return nullptr;
+				return static_cast<T*>( typeComponents.front() );
 			}
 
 			virtual GameObject* addChildGameObject( GameObject* childGameObject, bool active = true, bool activeInHierarchy = true );
@@ -207,20 +265,30 @@ namespace Comp2D
 
 				std::list<T*> searchedComponents;
 
-				T* currentComponent = nullptr;
+				Uint32 typeID = Comp2D::Components::ComponentType::getID<T>();
 
-				for( unsigned int i = 0; i < components.size(); ++i )
+				if( typeID >= m_componentsByType.size() )
 				{
-					currentComponent = dynamic_cast<T*>( components[i] );
+					indexComponentTypes();
+				}
+
+				const std::vector<Comp2D::Components::Component*>& typeComponents = m_componentsByType[typeID];
 
-					if( currentComponent )
-					{
-						searchedComponents.push_back( currentComponent );
-					}
+				for
+				(
+					std::vector<Comp2D::Components::Component*>::const_iterator typeComponentConstIt = typeComponents.cbegin();
+					typeComponentConstIt != typeComponents.cend();
+					++typeComponentConstIt
+				)
+				{
+					searchedComponents.push_back( static_cast<T*>( *typeComponentConstIt ) );
 				}
 
 				return searchedComponents;
 			}
+
+			friend class Comp2D::Components::Component;
+			friend class Comp2D::States::GameState;
 		};
 	}
 }
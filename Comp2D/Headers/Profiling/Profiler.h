@@ -0,0 +1,81 @@
+/* Profiler.h -- 'Comp2D' Game Engine 'Profiler' class header file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#ifndef Comp2D_HEADERS_PROFILING_PROFILER_H_
+#define Comp2D_HEADERS_PROFILING_PROFILER_H_
+
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_mutex.h>
+#include <SDL_thread.h>
+
+#include "Comp2D/Headers/Profiling/ProfilerThreadZones.h"
+
+namespace Comp2D
+{
+	class Game;
+
+	namespace Profiling
+	{
+		// Collects the zones recorded by every thread, each one into its own
+		// ring, and exports them in the Chrome trace event format, which
+		// chrome://tracing and Perfetto open. Zones are only recorded when the
+		// engine is built with PROFILING defined, see ProfilerZone.h
+		class Profiler
+		{
+		private:
+			Profiler() = delete;
+
+			static Uint64 performanceCounterFrequency;
+			static Uint64 performanceCounterOnInitialization;
+
+			static SDL_TLSID threadZonesTLSID;
+
+			static SDL_mutex* threadsZonesMutex;
+
+			static std::vector<ProfilerThreadZones*> threadsZones;
+
+			static void initialize();
+			static void finalize();
+
+			static ProfilerThreadZones* getCurrentThreadZones();
+
+		public:
+			// Zones added while the Profiler is not initialized are dropped
+			static void addZone( const char* name, Uint64 beginCounter, Uint64 endCounter );
+			static void clear();
+			static void setCurrentThreadName( const std::string& threadName );
+
+			static bool writeChromeTrace( const std::string& traceFilePath );
+
+			friend class Comp2D::Game;
+		};
+	}
+}
+
+#endif /* Comp2D_HEADERS_PROFILING_PROFILER_H_ */
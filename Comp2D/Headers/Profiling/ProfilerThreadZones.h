@@ -0,0 +1,83 @@
+/* ProfilerThreadZones.h -- 'Comp2D' Game Engine 'ProfilerThreadZones' class header file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#ifndef Comp2D_HEADERS_PROFILING_PROFILERTHREADZONES_H_
+#define Comp2D_HEADERS_PROFILING_PROFILERTHREADZONES_H_
+
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_atomic.h>
+#include <SDL_thread.h>
+
+#include "Comp2D/Headers/Profiling/ProfilerZoneRecord.h"
+
+namespace Comp2D
+{
+	namespace Profiling
+	{
+		// Ring of the most recent zones recorded by one thread. Only that
+		// thread adds zones, the lock is there for copying them out
+		class ProfilerThreadZones
+		{
+		public:
+			constexpr static Uint32 ZONES_RING_CAPACITY = 16384;
+
+		private:
+			Uint32 m_nextZoneIndex;
+
+			Uint64 m_recordedZonesCount;
+
+			SDL_threadID m_threadID;
+
+			SDL_SpinLock m_zonesLock;
+
+			std::string m_threadName;
+
+			std::vector<ProfilerZoneRecord> m_zones;
+
+		public:
+			ProfilerThreadZones( SDL_threadID threadID );
+
+			~ProfilerThreadZones();
+
+			ProfilerThreadZones( const ProfilerThreadZones& copiedProfilerThreadZones ) = delete;
+
+			void addZone( const char* name, Uint64 beginCounter, Uint64 endCounter );
+			void clear();
+			// Oldest first
+			void copyZones( std::vector<ProfilerZoneRecord>& zones );
+			void setThreadName( const std::string& threadName );
+
+			SDL_threadID getThreadID() const;
+
+			const std::string& getThreadName() const;
+		};
+	}
+}
+
+#endif /* Comp2D_HEADERS_PROFILING_PROFILERTHREADZONES_H_ */
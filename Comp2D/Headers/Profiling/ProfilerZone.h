@@ -0,0 +1,83 @@
+/* ProfilerZone.h -- 'Comp2D' Game Engine 'ProfilerZone' class header file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#ifndef Comp2D_HEADERS_PROFILING_PROFILERZONE_H_
+#define Comp2D_HEADERS_PROFILING_PROFILERZONE_H_
+
+#include <SDL.h>
+
+#include "Comp2D/Headers/Profiling/Profiler.h"
+
+#define COMP2D_PROFILER_CONCATENATE_IMPLEMENTATION( a, b ) a##b
+#define COMP2D_PROFILER_CONCATENATE( a, b ) COMP2D_PROFILER_CONCATENATE_IMPLEMENTATION( a, b )
+
+// Without PROFILING defined both expand to nothing
+#ifdef PROFILING
+	#define COMP2D_PROFILE_ZONE( zoneName ) Comp2D::Profiling::ProfilerZone COMP2D_PROFILER_CONCATENATE( profilerZone, __LINE__ )( zoneName )
+	#define COMP2D_PROFILE_THREAD( threadName ) Comp2D::Profiling::Profiler::setCurrentThreadName( threadName )
+#else
+	#define COMP2D_PROFILE_ZONE( zoneName )
+	#define COMP2D_PROFILE_THREAD( threadName )
+#endif
+
+namespace Comp2D
+{
+	namespace Profiling
+	{
+		// Records the time between its construction and destruction
+		class ProfilerZone
+		{
+		private:
+			Uint64 m_beginCounter;
+
+			const char* m_name;
+
+		public:
+			ProfilerZone( const char* name )
+				:
+				m_beginCounter{ SDL_GetPerformanceCounter() },
+				m_name{ name }
+			{
+				#ifdef DEBUG
+					//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ProfilerZone named %s Constructor\n", m_name );
+				#endif
+			}
+
+			~ProfilerZone()
+			{
+				#ifdef DEBUG
+					//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ProfilerZone named %s Destroying\n", m_name );
+				#endif
+
+				Comp2D::Profiling::Profiler::addZone( m_name, m_beginCounter, SDL_GetPerformanceCounter() );
+			}
+
+			ProfilerZone( const ProfilerZone& copiedProfilerZone ) = delete;
+		};
+	}
+}
+
+#endif /* Comp2D_HEADERS_PROFILING_PROFILERZONE_H_ */
@@ -0,0 +1,109 @@
+/* QualityGovernor.h -- 'Comp2D' Game Engine 'QualityGovernor' class header file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+#ifndef Comp2D_HEADERS_QUALITY_QUALITYGOVERNOR_H_
+#define Comp2D_HEADERS_QUALITY_QUALITYGOVERNOR_H_
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+
+#include "Comp2D/Headers/Quality/QualityFeature.h"
+
+namespace Comp2D
+{
+	namespace Quality
+	{
+		// Averages the frame work time over windows of frames and compares it
+		// against the frame budget. A window over budget degrades one level of
+		// the registered feature with the lowest degradation order, and
+		// several windows in a row with plenty of headroom restore the most
+		// recently degraded one. The gap between both thresholds and the
+		// window skipped after every change keep it from oscillating
+		class QualityGovernor
+		{
+		private:
+			constexpr static Uint32 EVALUATION_WINDOW_FRAMES_COUNT = 30;
+			constexpr static Uint32 RESTORE_WINDOWS_COUNT = 4;
+
+			// Fractions of the frame budget
+			constexpr static double DEGRADE_THRESHOLD = 1.0;
+			constexpr static double RESTORE_THRESHOLD = 0.7;
+
+			unsigned int m_nextFeatureID;
+
+			Uint32 m_windowFramesCount;
+			Uint32 m_windowsToSkipCount;
+			Uint32 m_windowsUnderRestoreThresholdCount;
+
+			Uint64 m_frameBudgetInNanoseconds;
+			Uint64 m_windowWorkTimeInNanoseconds;
+
+			// Every degraded level pushes its feature, restoring pops it
+			std::vector<unsigned int> m_degradedFeaturesIDs;
+
+			std::vector<QualityFeature> m_features;
+
+			void degrade();
+			void evaluateWindow();
+			void restore();
+
+			QualityFeature* getFeature( unsigned int featureID );
+
+		public:
+			QualityGovernor();
+
+			~QualityGovernor();
+
+			QualityGovernor( const QualityGovernor& copiedQualityGovernor ) = delete;
+
+			// Work time excludes waiting for the display, so a frame capped by
+			// vertical sync still shows its headroom
+			void addFrameWorkTime( Uint64 frameWorkTimeInNanoseconds );
+			// Restores every feature to its full quality
+			void reset();
+			void setFrameBudget( Uint64 frameBudgetInNanoseconds );
+			// The feature is dropped without restoring it, so its callback is
+			// not called anymore
+			void unregisterFeature( unsigned int featureID );
+
+			Uint32 getDegradedLevelsCount() const;
+			Uint32 getFeatureLevel( unsigned int featureID ) const;
+
+			// Called on the game thread with the new level whenever it changes
+			unsigned int registerFeature
+			(
+				const std::string& name,
+				Uint32 levelsCount,
+				std::function<void(Uint32)> onLevelChanged,
+				int degradationOrder = 0
+			);
+		};
+	}
+}
+
+#endif /* Comp2D_HEADERS_QUALITY_QUALITYGOVERNOR_H_ */
@@ -38,13 +38,19 @@ namespace Comp2D
 		class MersenneTwisterRNG : public RandomNumberGenerator
 		{
 		private:
+			unsigned int seed;
+
 			std::mt19937 mersenne;
 
 		public:
 			MersenneTwisterRNG();
+			// A given seed gives the same sequence on every run, e.g. when replaying
+			MersenneTwisterRNG( unsigned int seed );
 
 			~MersenneTwisterRNG();
 
+			unsigned int getSeed() const;
+
 			bool getRandomBoolean() override;
 
 			int getRandomInteger() override;
@@ -0,0 +1,77 @@
+/* RenderCommand.h -- 'Comp2D' Game Engine 'RenderCommand' class header file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#ifndef Comp2D_HEADERS_RENDERING_RENDERCOMMAND_H_
+#define Comp2D_HEADERS_RENDERING_RENDERCOMMAND_H_
+
+#include <SDL.h>
+
+namespace Comp2D
+{
+	namespace Rendering
+	{
+		enum class ERenderCommandType
+		{
+			CopyTexture,
+			DrawLines,
+			DrawPoints,
+			RenderCommandTypesCount
+		};
+
+		// Plain draw data recorded from a Renderable, so that it can be
+		// submitted to SDL after the GameState has moved on to the next frame.
+		// Lines and points commands index into the owning RenderPacket points
+		class RenderCommand
+		{
+		public:
+			bool hasCenter;
+			bool hasDestinationRect;
+			bool hasSourceRect;
+
+			int layer;
+
+			Uint32 firstPointIndex;
+			Uint32 pointsCount;
+
+			double angle;
+
+			ERenderCommandType type;
+
+			SDL_RendererFlip flip;
+
+			SDL_Point center;
+
+			SDL_Rect destinationRect;
+			SDL_Rect sourceRect;
+
+			SDL_Color color;
+
+			SDL_Texture* texture;
+		};
+	}
+}
+
+#endif /* Comp2D_HEADERS_RENDERING_RENDERCOMMAND_H_ */
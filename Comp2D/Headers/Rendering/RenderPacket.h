@@ -0,0 +1,83 @@
+/* RenderPacket.h -- 'Comp2D' Game Engine 'RenderPacket' class header file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#ifndef Comp2D_HEADERS_RENDERING_RENDERPACKET_H_
+#define Comp2D_HEADERS_RENDERING_RENDERPACKET_H_
+
+#include <cstddef>
+#include <vector>
+
+#include <SDL.h>
+
+#include "Comp2D/Headers/Rendering/RenderCommand.h"
+
+namespace Comp2D
+{
+	namespace Rendering
+	{
+		// A frame worth of RenderCommands. Cleared packets keep their capacity,
+		// so recording does not allocate once the packet has grown to the size
+		// of a typical frame
+		class RenderPacket
+		{
+		private:
+			bool m_sortRequired;
+
+			int m_lastCommandLayer;
+
+			std::vector<SDL_Point> m_points;
+
+			std::vector<RenderCommand> m_commands;
+
+			RenderCommand& addCommand( ERenderCommandType type, int layer );
+
+		public:
+			RenderPacket();
+
+			~RenderPacket();
+
+			void addCopyTextureCommand
+			(
+				int layer,
+				SDL_Texture* texture,
+				const SDL_Rect* sourceRect,
+				const SDL_Rect* destinationRect,
+				double angle = 0.0,
+				const SDL_Point* center = nullptr,
+				SDL_RendererFlip flip = SDL_FLIP_NONE
+			);
+			void addDrawLinesCommand( int layer, SDL_Color color, const SDL_Point* points, int pointsCount );
+			void addDrawPointsCommand( int layer, SDL_Color color, const SDL_Point* points, int pointsCount );
+			void clear();
+			void submit( SDL_Renderer* renderer );
+
+			std::size_t getCommandsCount() const;
+			std::size_t getPointsCount() const;
+		};
+	}
+}
+
+#endif /* Comp2D_HEADERS_RENDERING_RENDERPACKET_H_ */
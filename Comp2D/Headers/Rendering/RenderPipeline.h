@@ -0,0 +1,143 @@
+/* RenderPipeline.h -- 'Comp2D' Game Engine 'RenderPipeline' class header file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#ifndef Comp2D_HEADERS_RENDERING_RENDERPIPELINE_H_
+#define Comp2D_HEADERS_RENDERING_RENDERPIPELINE_H_
+
+#include <functional>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_thread.h>
+
+#include "Comp2D/Headers/Rendering/RenderPacket.h"
+
+namespace Comp2D
+{
+	namespace Rendering
+	{
+		// Entry point for every draw call made by Renderables.
+		// Outside of a recording the calls go straight to SDL. Between
+		// beginRecording and endRecording they are stored in one of two
+		// RenderPackets instead, so the Game can submit frame N while the
+		// simulation thread is already updating frame N + 1
+		class RenderPipeline
+		{
+		private:
+			constexpr static Uint32 RENDER_PACKETS_COUNT = 2;
+
+			bool m_recording;
+			bool m_renderingScaledFrame;
+			bool m_simulationThreadRunning;
+			bool m_simulationThreadStopRequested;
+
+			int m_currentRenderLayer;
+			int m_scaledRenderTargetHeight;
+			int m_scaledRenderTargetWidth;
+
+			Uint32 m_recordingRenderPacketIndex;
+
+			float m_renderScale;
+
+			SDL_Color m_drawColor;
+
+			SDL_Renderer* m_renderer;
+
+			SDL_Texture* m_scaledRenderTarget;
+
+			SDL_mutex* m_pendingTexturesDestructionMutex;
+
+			SDL_sem* m_simulationFrameFinishedSemaphore;
+			SDL_sem* m_simulationFrameRequestedSemaphore;
+
+			SDL_Thread* m_simulationThread;
+
+			std::function<void()> m_simulationFrameProcedure;
+
+			std::vector<SDL_Texture*> m_pendingTexturesDestruction;
+
+			RenderPacket m_renderPackets[RENDER_PACKETS_COUNT];
+
+			static int simulationThreadFunction( void* data );
+
+			void destroyPendingTextures();
+
+			bool prepareScaledRenderTarget( int outputWidth, int outputHeight );
+
+		public:
+			constexpr static float MINIMUM_RENDER_SCALE = 0.25f;
+
+			RenderPipeline( SDL_Renderer* renderer );
+
+			~RenderPipeline();
+
+			// Clears the frame. Below a render scale of 1 the frame is drawn to
+			// a smaller target and stretched over the window by endFrame
+			void beginFrame();
+			void beginRecording();
+			void copyTexture
+			(
+				SDL_Texture* texture,
+				const SDL_Rect* sourceRect,
+				const SDL_Rect* destinationRect
+			);
+			void copyTexture
+			(
+				SDL_Texture* texture,
+				const SDL_Rect* sourceRect,
+				const SDL_Rect* destinationRect,
+				double angle,
+				const SDL_Point* center,
+				SDL_RendererFlip flip
+			);
+			void destroyTexture( SDL_Texture* texture );
+			void drawLine( int x1, int y1, int x2, int y2 );
+			void drawLines( const SDL_Point* points, int pointsCount );
+			void drawPoints( const SDL_Point* points, int pointsCount );
+			void endFrame();
+			void endRecording();
+			void requestSimulationFrame();
+			void setCurrentRenderLayer( int renderLayer );
+			void setDrawColor( Uint8 r, Uint8 g, Uint8 b, Uint8 a );
+			// From MINIMUM_RENDER_SCALE to 1, applied from the next frame on
+			void setRenderScale( float renderScale );
+			void stopSimulationThread();
+			void submitRecordedRenderPacket();
+			void waitForSimulationFrame();
+
+			bool startSimulationThread( std::function<void()> simulationFrameProcedure );
+
+			bool isRecording() const;
+			bool isSimulationThreadRunning() const;
+
+			float getRenderScale() const;
+
+			const RenderPacket& getRecordedRenderPacket() const;
+		};
+	}
+}
+
+#endif /* Comp2D_HEADERS_RENDERING_RENDERPIPELINE_H_ */
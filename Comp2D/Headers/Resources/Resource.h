@@ -29,6 +29,8 @@
 
 #include <string>
 
+#include <SDL_mutex.h>
+
 namespace Comp2D
 {
 	namespace Resources
@@ -40,6 +42,10 @@ namespace Comp2D
 
 			bool m_loaded;
 
+			// Held by the overrides of preload, load and free, as a preload
+			// running on a job worker may meet a load from the game thread
+			SDL_mutex* m_loadMutex;
+
 		public:
 			Resource( const std::string& name );
 
@@ -51,6 +57,10 @@ namespace Comp2D
 
 			virtual void load() = 0;
 			virtual void free() = 0;
+			// Optional part of load that neither touches the renderer nor
+			// reports errors, so it can run ahead on a job worker. load then
+			// completes it on the game thread, or does everything if it failed
+			virtual void preload();
 		};
 	}
 }
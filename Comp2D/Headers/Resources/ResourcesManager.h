@@ -32,6 +32,7 @@
 #include <vector>
 
 #include "Comp2D/Headers/Resources/Resource.h"
+#include "Comp2D/Headers/Resources/ResourcesPreload.h"
 
 // TODO: Realizar binary search nos métodos de load, free e get Resource
 
@@ -53,6 +54,9 @@ namespace Comp2D
 			Resource* loadResource( const std::string& resourceName, bool appendWithLoaded = true );
 			void loadResources( const std::set<std::string>& resourcesNames, bool appendWithLoaded = true );
 			void loadAllResources();
+			// Starts loading the not yet loaded Resources among the given ones,
+			// the caller updates and deletes the returned ResourcesPreload
+			ResourcesPreload* preloadResources( const std::set<std::string>& resourcesNames );
 			void freeResource( const std::string& resourceName );
 			void freeResources( const std::set<std::string>& resourcesNames );
 			void freeAllResources();
@@ -0,0 +1,77 @@
+/* ResourcesPreload.h -- 'Comp2D' Game Engine 'ResourcesPreload' class header file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#ifndef Comp2D_HEADERS_RESOURCES_RESOURCESPRELOAD_H_
+#define Comp2D_HEADERS_RESOURCES_RESOURCESPRELOAD_H_
+
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_atomic.h>
+
+#include "Comp2D/Headers/Jobs/JobCounter.h"
+#include "Comp2D/Headers/Resources/Resource.h"
+
+namespace Comp2D
+{
+	namespace Resources
+	{
+		// Loads a set of Resources in two steps: their preload runs on the job
+		// workers, then update completes their load on the game thread, a few
+		// at a time so no frame takes much longer than the given time budget
+		class ResourcesPreload
+		{
+		private:
+			SDL_atomic_t m_preloadedResourcesCount;
+
+			Uint32 m_loadedResourcesCount;
+
+			std::vector<Resource*> m_resources;
+
+			Comp2D::Jobs::JobCounter m_preloadsCounter;
+
+		public:
+			ResourcesPreload( const std::vector<Resource*>& resources );
+
+			~ResourcesPreload();
+
+			ResourcesPreload( const ResourcesPreload& copiedResourcesPreload ) = delete;
+
+			void start();
+			// Blocks, helping the job workers, until every Resource is loaded
+			void complete();
+
+			bool update( Uint64 timeBudgetInNanoseconds );
+
+			bool isDone();
+
+			// From 0 to 1, preloading and loading weighting the same
+			float getProgress();
+		};
+	}
+}
+
+#endif /* Comp2D_HEADERS_RESOURCES_RESOURCESPRELOAD_H_ */
@@ -53,6 +53,7 @@ namespace Comp2D
 
 			void load() override;
 			void free() override;
+			void preload() override;
 
 			Mix_Chunk* getSoundEffect() const;
 		};
@@ -47,8 +47,12 @@ namespace Comp2D
 
 			SDL_Color m_modColor;
 
+			SDL_Surface* m_preloadedSurface = nullptr;
+
 			SDL_Texture* m_texture = nullptr;
 
+			SDL_Surface* loadSurface() const;
+
 		public:
 			TextureResource
 			(
@@ -60,6 +64,7 @@ namespace Comp2D
 
 			void load() override;
 			void free() override;
+			void preload() override;
 
 			void setModColor( Uint8 r, Uint8 g, Uint8 b );
 
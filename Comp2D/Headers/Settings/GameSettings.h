@@ -33,6 +33,7 @@
 
 #include "Comp2D/Headers/Settings/AudioSettings.h"
 #include "Comp2D/Headers/Settings/GraphicsSettings.h"
+#include "Comp2D/Headers/Settings/TimeSettings.h"
 
 namespace Comp2D
 {
@@ -41,12 +42,18 @@ namespace Comp2D
 		class GameSettings
 		{
 		private:
+			bool m_adaptiveQuality;
+			bool m_headless;
+
 			int m_imageLoadingFlags;
 			int m_windowInitXPos;
 			int m_windowInitYPos;
 
+			Uint32 m_jobWorkersCount;
 			Uint32 m_windowFlags;
 
+			std::string m_inputsRecordingFilePath;
+			std::string m_inputsReplayFilePath;
 			std::string m_windowTitle;
 
 		public:
@@ -54,16 +61,40 @@ namespace Comp2D
 
 			GraphicsSettings graphicsSettings;
 
+			TimeSettings timeSettings;
+
 			GameSettings();
 
 			~GameSettings();
 
+			// Recognizes "--adaptive-quality", "--headless",
+			// "--headless-simulation-speed=<speed>", "--record-inputs=<file path>"
+			// and "--replay-inputs=<file path>", the last one also turning
+			// headless on
+			void parseCommandLineArguments( int argc, char* argv[] );
+			// Lets the quality governor lower the registered features when the
+			// frames go over the frame budget, never while headless
+			void setAdaptiveQuality( bool adaptiveQuality );
+			// Runs without window, renderer nor audio device, only simulating
+			void setHeadless( bool headless );
+
+			bool isAdaptiveQualityEnabled() const;
+			bool isHeadless() const;
+
+			// Empty, the default, for no recording
+			void setInputsRecordingFilePath( const std::string& inputsRecordingFilePath );
+			// Only replayed when headless, empty, the default, for no replay
+			void setInputsReplayFilePath( const std::string& inputsReplayFilePath );
+
 			int getImageLoadingFlags() const;
 			int getWindowInitXPos() const;
 			int getWindowInitYPos() const;
 
+			Uint32 getJobWorkersCount() const;
 			Uint32 getWindowFlags() const;
 
+			const std::string& getInputsRecordingFilePath() const;
+			const std::string& getInputsReplayFilePath() const;
 			const std::string& getWindowTitle() const;
 		};
 	}
@@ -34,6 +34,7 @@
 
 #define DEFAULT_SCREEN_WIDTH 720
 #define DEFAULT_SCREEN_HEIGHT 480
+#define DEFAULT_PIPELINED_RENDERING false
 
 namespace Comp2D
 {
@@ -42,6 +43,8 @@ namespace Comp2D
 		class GraphicsSettings
 		{
 		private:
+			bool m_pipelinedRendering;
+
 			int m_screenWidth;
 			int m_screenHeight;
 			int m_screenHalfWidth;
@@ -60,6 +63,9 @@ namespace Comp2D
 			void setScreenWidth( int width );
 			void setScreenHeight( int height );
 			void setScreenDimensions( int width, int height );
+			void setPipelinedRendering( bool pipelinedRendering );
+
+			bool isPipelinedRenderingEnabled() const;
 
 			int getScreenWidth() const;
 			int getScreenHeight() const;
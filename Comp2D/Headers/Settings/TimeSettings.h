@@ -0,0 +1,94 @@
+/* TimeSettings.h -- 'Comp2D' Game Engine 'TimeSettings' class header file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#ifndef Comp2D_HEADERS_SETTINGS_TIMESETTINGS_H_
+#define Comp2D_HEADERS_SETTINGS_TIMESETTINGS_H_
+
+#include <SDL.h>
+
+#define DEFAULT_DELTA_TIME_SMOOTHING_FACTOR 0.1f
+#define DEFAULT_FIXED_DELTA_TIME_IN_SECONDS ( 1.0f / 60.0f )
+#define DEFAULT_FRAME_BUDGET_IN_SECONDS ( 1.0f / 60.0f )
+#define DEFAULT_HEADLESS_SIMULATION_SPEED 0.0f
+#define DEFAULT_MAXIMUM_FIXED_UPDATES_PER_FRAME 5
+#define DEFAULT_MAXIMUM_POSTED_PROCEDURES_PER_FRAME 256
+#define DEFAULT_THROTTLE_WHEN_UNFOCUSED true
+#define DEFAULT_THROTTLED_TICKS_PER_SECOND 10.0f
+
+namespace Comp2D
+{
+	namespace Settings
+	{
+		class TimeSettings
+		{
+		private:
+			bool m_throttleWhenUnfocused;
+
+			Uint32 m_maximumFixedUpdatesPerFrame;
+			Uint32 m_maximumPostedProceduresPerFrame;
+
+			float m_deltaTimeSmoothingFactor;
+			float m_fixedDeltaTimeInSeconds;
+			float m_frameBudgetInSeconds;
+			float m_headlessSimulationSpeed;
+			float m_throttledTicksPerSecond;
+
+		public:
+			TimeSettings();
+
+			~TimeSettings();
+
+			// Weight of the newest frame on the smoothed delta time, between 0 (exclusive) and 1
+			void setDeltaTimeSmoothingFactor( float deltaTimeSmoothingFactor );
+			void setFixedDeltaTimeInSeconds( float fixedDeltaTimeInSeconds );
+			// Frames taking longer than this are counted as over budget by the frame statistics
+			void setFrameBudgetInSeconds( float frameBudgetInSeconds );
+			// Simulated seconds per real second while headless, 0 runs as fast as possible
+			void setHeadlessSimulationSpeed( float headlessSimulationSpeed );
+			// Caps the catch-up steps after a long frame, the remaining time is dropped
+			void setMaximumFixedUpdatesPerFrame( Uint32 maximumFixedUpdatesPerFrame );
+			// Procedures posted to the game thread beyond this wait for the next frame
+			void setMaximumPostedProceduresPerFrame( Uint32 maximumPostedProceduresPerFrame );
+			// Paused games and hidden windows are always throttled
+			void setThrottleWhenUnfocused( bool throttleWhenUnfocused );
+			// Frames per second while throttled, the loop sleeps waiting for events in between
+			void setThrottledTicksPerSecond( float throttledTicksPerSecond );
+
+			bool isThrottleWhenUnfocusedEnabled() const;
+
+			Uint32 getMaximumFixedUpdatesPerFrame() const;
+			Uint32 getMaximumPostedProceduresPerFrame() const;
+
+			float getDeltaTimeSmoothingFactor() const;
+			float getFixedDeltaTimeInSeconds() const;
+			float getFrameBudgetInSeconds() const;
+			float getHeadlessSimulationSpeed() const;
+			float getThrottledTicksPerSecond() const;
+		};
+	}
+}
+
+#endif /* Comp2D_HEADERS_SETTINGS_TIMESETTINGS_H_ */
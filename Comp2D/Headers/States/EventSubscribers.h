@@ -0,0 +1,56 @@
+/* EventSubscribers.h -- 'Comp2D' Game Engine 'EventSubscribers' class header file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#ifndef Comp2D_HEADERS_STATES_EVENTSUBSCRIBERS_H_
+#define Comp2D_HEADERS_STATES_EVENTSUBSCRIBERS_H_
+
+#include <vector>
+
+namespace Comp2D
+{
+	namespace Components
+	{
+		class GameObjectBehavior;
+	}
+
+	namespace States
+	{
+		class GameStateBehavior;
+
+		// Behaviors subscribed to one event type, or to one key of it, in
+		// subscription order. Unsubscribed entries are set to nullptr while
+		// events are being dispatched and removed afterwards
+		class EventSubscribers
+		{
+		public:
+			std::vector<Comp2D::States::GameStateBehavior*> gameStateBehaviors;
+
+			std::vector<Comp2D::Components::GameObjectBehavior*> gameObjectBehaviors;
+		};
+	}
+}
+
+#endif /* Comp2D_HEADERS_STATES_EVENTSUBSCRIBERS_H_ */
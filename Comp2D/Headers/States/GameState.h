@@ -31,20 +31,27 @@
 #include <list>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <SDL.h>
+#include <SDL_atomic.h>
 #include <SDL_thread.h>
 
 #include "Comp2D/Headers/Game.h"
 //#include "Comp2D/Headers/Components/AnimationsControllerComponent.h"
 //#include "Comp2D/Headers/Components/Component.h"
 #include "Comp2D/Headers/Components/Renderable.h"
+#include "Comp2D/Headers/Components/TransformComponentsStorage.h"
+#include "Comp2D/Headers/Memory/MemoryArena.h"
 //#include "Comp2D/Headers/Components/TimelinesControllerComponent.h"
 #include "Comp2D/Headers/Objects/Dependency.h"
 //#include "Comp2D/Headers/Objects/GameObject.h"
-#include "Comp2D/Headers/Time/TimedProcedure.h"
+#include "Comp2D/Headers/States/EventSubscribers.h"
+#include "Comp2D/Headers/States/GameStateCommand.h"
+#include "Comp2D/Headers/Time/TimedProcedureHandle.h"
+#include "Comp2D/Headers/Time/TimedProceduresScheduler.h"
 
-// TODO: Utilizar Binary Search no metodo solveGameObjectComponentDependency
 // TODO: (OPCIONAL) Modularizar mais com base nos comentários em GameState.cpp
 
 namespace Comp2D
@@ -53,10 +60,16 @@ namespace Comp2D
 	{
 		class AnimationsControllerComponent;
 		class Component;
+		class GameObjectBehavior;
 		class TimelinesControllerComponent;
 		class TransformComponent;
 	}
 
+	namespace Jobs
+	{
+		class SeparateThreadFunctionCall;
+	}
+
 	namespace Objects
 	{
 		class GameObject;
@@ -71,29 +84,56 @@ namespace Comp2D
 		class GameState
 		{
 		private:
-			static unsigned int currentGameStateTimedProcedureID;
-
-			static std::list<SDL_TimerID> currentGameStateTimerFunctionsIDs;
-
-			static std::list<SDL_Thread*> currentGameStateSeparateThreadFunctions;
-
-			static std::list<Comp2D::Time::TimedProcedure*> currentGameStateTimedProcedures;
-			static std::list<Comp2D::Time::TimedProcedure*> currentGameStatePausableTimedProcedures;
+			// Below it, a phase runs on the calling thread, as queuing the
+			// jobs would cost more than what they would save
+			constexpr static Uint32 PARALLEL_PHASE_MIN_COUNT = 256;
 
+			// On the timed procedures of the current GameState
 			static void checkGameStateTimedProcedures();
 			static void pauseGameStateTimedProcedures();
 			static void unpauseGameStateTimedProcedures();
 
+			// The one setting up if any, the current one otherwise. It keeps
+			// the timer functions, separate thread functions and timed
+			// procedures until it is finalized
+			static GameState* getSchedulingGameState();
+
+			static bool canCoalesceMotionEvents( const SDL_Event& pendingMotionEvent, const SDL_Event& motionEvent );
+			static bool isMotionEvent( const SDL_Event& e );
+			static bool isRenderedBefore( const Comp2D::Components::Renderable* renderableA, const Comp2D::Components::Renderable* renderableB );
+
+			static Uint64 getEventSubscribersKey( Uint32 eventType, SDL_Keycode key );
+
 			virtual void beforeSetup();
 			virtual void finalize();
+			virtual void fixedUpdate();
 			virtual void initialize();
 			virtual void onEvent( SDL_Event e );
 			virtual void render();
 			virtual void update();
 
+			// Called at the frame sync points, never while the arrays of
+			// active GameObjects or updatable behaviors are being walked
+			void applyGameObjectsActivityChanges();
+			// The sync point of the deferred structural changes, at the end
+			// of update and before the GameState is initialized or finalized
+			void applyGameStateCommands();
+			void collectDestroyedGameObject( Comp2D::Objects::GameObject* gameObject );
+			void collectResourcesNamesFromAnimationsControllerComponent( Comp2D::Components::AnimationsControllerComponent* animationsControllerComponent );
+			// Run again once the collected Resources are loaded, as the
+			// animations and timelines ones come from their loaded controllers
+			void collectResourcesNamesFromResourceComponents();
+			void collectResourcesNamesFromTimelinesControllerComponent( Comp2D::Components::TimelinesControllerComponent* timelinesControllerComponent );
 			void deleteComponents();
+			void deleteDestroyedGameObjects();
 			void deleteGameObjects();
 			void deleteGameStateBehaviors();
+			void dispatchEvent( const SDL_Event& e );
+			void dispatchEventToGameObjectBehaviors( const SDL_Event& e, Comp2D::States::EventSubscribers* eventSubscribers );
+			void dispatchEventToGameStateBehaviors( const SDL_Event& e, Comp2D::States::EventSubscribers* eventSubscribers );
+			// Motion events are coalesced until an event of another kind
+			// arrives or the frame updates, so their order is kept
+			void dispatchPendingMotionEvent();
 			void finalizeComponents();
 			void finalizeGameSeparateThreadsFunctions();
 			void finalizeGameStateBehaviors();
@@ -101,14 +141,25 @@ namespace Comp2D
 			void finalizeGameStateTimerFunctions();
 			void freeResourcesFromResourceComponents();
 			void initializeComponents();
+			void initializeCreatedGameObjects();
 			void initializeGameStateBehaviors();
-			void loadResourcesFromAnimationsControllerComponent( Comp2D::Components::AnimationsControllerComponent* animationsControllerComponent );
+			void keepResourcesLoaded( const std::set<std::string>& resourcesNames );
 			void loadResourcesFromResourceComponents();
-			void loadResourcesFromTimelinesControllerComponent( Comp2D::Components::TimelinesControllerComponent* timelinesControllerComponent );
+			void onGameObjectActivityChanged( Comp2D::Objects::GameObject* gameObject );
+			// Clears its entry right away, it is deleted before the next sync
+			void onGameObjectBehaviorRemoved( Comp2D::Components::GameObjectBehavior* behavior );
+			void onGameObjectBehaviorsChanged();
 			void pause();
 			void pauseGameObjectComponents( Comp2D::Objects::GameObject* gameObject );
 			void pauseGameObjectsComponents();
 			void pauseGameStateBehaviors();
+			void pendMotionEvent( const SDL_Event& e );
+			void pushGameStateCommand( const Comp2D::States::GameStateCommand& gameStateCommand );
+			void removeUnsubscribedEventSubscribers();
+			void reparentGameObject( Comp2D::Objects::GameObject* gameObject, Comp2D::Objects::GameObject* parentGameObject );
+			// Runs beforeSetup and setup with the MemoryArena set, so what they
+			// create is released at once when the GameState is finalized
+			void runSetup();
 			void solveGameObjectComponentDependency( Comp2D::Objects::Dependency* componentDependency );
 			void solveGameObjectComponentsDependencies( Comp2D::Objects::GameObject* gameObject );
 			void solveGameObjectsComponentsDependencies();
@@ -116,12 +167,23 @@ namespace Comp2D
 			void unpauseGameObjectComponents( Comp2D::Objects::GameObject* gameObject );
 			void unpauseGameObjectsComponents();
 			void unpauseGameStateBehaviors();
-			void updateGameObjectAnimationsControllerComponent( Comp2D::Objects::GameObject* gameObject, Uint32 currentTime );
-			void updateGameObjectBehaviors( Comp2D::Objects::GameObject* gameObject );
+			// The update phases, in the order they run. Only the transforms
+			// and the parallel safe behaviors phases are spread over the jobs
+			void updateGameObjectsAnimationsControllerComponent( Uint64 currentTime );
+			void updateGameObjectsTimelinesControllerComponent( Uint64 currentTime );
 			void updateGameObjectsTransformComponent();
-			void updateGameObjectTimelinesControllerComponent( Comp2D::Objects::GameObject* gameObject, Uint32 currentTime );
-			void updateGameObjectTransformComponent( Comp2D::Objects::GameObject* gameObject );
+			void updateGameObjectsBehaviors();
+			void updateGameObjectAnimationsControllerComponent( Comp2D::Objects::GameObject* gameObject, Uint64 currentTime );
+			void updateGameObjectBehaviors( Comp2D::Objects::GameObject* gameObject );
+			void updateGameObjectTimelinesControllerComponent( Comp2D::Objects::GameObject* gameObject, Uint64 currentTime );
 			void updateGameStateBehaviors();
+			void updateHierarchyTransforms( Uint32 firstPosition, Uint32 endPosition );
+			void updateParallelUpdatableBehaviors( Uint32 firstIndex, Uint32 endIndex );
+			void updateUpdatableBehaviors();
+
+			// Tells whether a PhysicsTransformComponent was found, as those
+			// move bodies in the shared b2World
+			bool flattenGameObjectTransforms( Comp2D::Objects::GameObject* gameObject, Sint32 parentTransformPosition );
 
 		protected:
 			Uint32 m_componentID = 0;
@@ -129,8 +191,81 @@ namespace Comp2D
 			Uint32 m_gameStateBehaviorID = 0;
 			Uint32 m_id;
 
+			// Derived GameStates may turn it off in their constructor, giving
+			// each TransformComponent a storage of its own
+			bool m_transformComponentsStorageEnabled = true;
+			bool m_componentsInitialized = false;
+			bool m_motionEventPending = false;
+			bool m_unsubscribedEventSubscribers = false;
+			bool m_transformsHierarchyChanged = false;
+			bool m_updatableBehaviorsChanged = false;
+			// While the parallel safe behaviors update, checked by GameObject
+			// in debug builds
+			bool m_parallelUpdatableBehaviorsUpdating = false;
+
+			Uint32 m_createdGameObjectsCount = 0;
+
+			SDL_Event m_pendingMotionEvent;
+
+			// Guards the recorded commands, as parallel safe behaviors may
+			// record them from the jobs
+			SDL_SpinLock m_gameStateCommandsLock = 0;
+
 			std::set<std::string> m_resourceComponentsResourcesNames;
 
+			std::list<SDL_TimerID> m_timerFunctionsIDs;
+
+			std::list<Comp2D::Jobs::SeparateThreadFunctionCall*> m_separateThreadFunctions;
+
+			Comp2D::Time::TimedProceduresScheduler m_timedProceduresScheduler;
+
+			Comp2D::Components::TransformComponentsStorage m_transformComponentsStorage;
+
+			// Its blocks are kept across the GameState resets
+			Comp2D::Memory::MemoryArena m_memoryArena;
+
+			// By getEventSubscribersKey, SDLK_UNKNOWN for every key
+			std::unordered_map<Uint64, Comp2D::States::EventSubscribers> m_eventSubscribers;
+
+			// Every created GameObject by ID and by name. A name shared by
+			// several GameObjects refers to the first one created
+			std::unordered_map<unsigned int, Comp2D::Objects::GameObject*> m_gameObjectsByID;
+			std::unordered_map<std::string, Comp2D::Objects::GameObject*> m_gameObjectsByName;
+
+			// Patched at the frame sync points and kept in creation order, so
+			// the per frame work only goes through the live GameObjects
+			std::vector<Comp2D::Objects::GameObject*> m_activeGameObjects;
+			std::vector<Comp2D::Objects::GameObject*> m_activeRootGameObjects;
+			std::vector<Comp2D::Objects::GameObject*> m_activityChangedGameObjects;
+
+			// Enabled and active in hierarchy behaviors of the active
+			// GameObjects, contiguous for each one of them, split by whether
+			// they are parallel safe
+			std::vector<Comp2D::Components::GameObjectBehavior*> m_parallelUpdatableBehaviors;
+			std::vector<Comp2D::Components::GameObjectBehavior*> m_updatableBehaviors;
+
+			// TransformComponents of the active GameObjects, parent before
+			// child, with the position of the parent one or -1. Rebuilt when
+			// the hierarchy or activity of the GameObjects changes
+			std::vector<Comp2D::Components::TransformComponent*> m_hierarchyTransforms;
+			std::vector<Sint32> m_hierarchyTransformsParentPositions;
+			std::vector<Uint8> m_hierarchyTransformsRefreshed;
+			// Each root hierarchy is a contiguous range of those arrays, ended
+			// by the begin of the next one. The ones without physics bodies
+			// are independent of each other and refreshed in parallel
+			std::vector<Uint32> m_hierarchyTransformsRootsBegins;
+			std::vector<Uint32> m_parallelHierarchyTransformsRoots;
+			std::vector<Uint32> m_serialHierarchyTransformsRoots;
+
+			// Recorded during the frame, swapped out when applied so the
+			// commands recorded while applying them wait for the next sync
+			std::vector<Comp2D::States::GameStateCommand> m_appliedGameStateCommands;
+			std::vector<Comp2D::States::GameStateCommand> m_gameStateCommands;
+
+			// Gathered while the commands are applied, then handled in bulk
+			std::vector<Comp2D::Objects::GameObject*> m_commandCreatedGameObjects;
+			std::vector<Comp2D::Objects::GameObject*> m_commandDestroyedGameObjects;
+
 			std::list<Comp2D::Components::Renderable*> m_renderableComponents;
 
 			std::list<Comp2D::States::GameStateBehavior*> m_gameStateBehaviors;
@@ -161,7 +296,7 @@ namespace Comp2D
 				void* data,
 				const std::string& threadName
 			);
-			static void callProcedureAfterTimeOnGameThread
+			static Comp2D::Time::TimedProcedureHandle callProcedureAfterTimeOnGameThread
 			(
 				std::function<void()> timedProcedure,
 				Uint32 callbackTimeInMilliseconds,
@@ -173,8 +308,25 @@ namespace Comp2D
 			virtual void resetState();
 			virtual void setup();
 
+			// Only the subscribed behaviors receive an event, GameStateBehaviors
+			// first. Subscribing to a key only applies to keyboard events, and
+			// subscribing to both a key and its whole event type delivers
+			// that key twice
+			void subscribeToEvent( Comp2D::Components::GameObjectBehavior* gameObjectBehavior, Uint32 eventType, SDL_Keycode key = SDLK_UNKNOWN );
+			void subscribeToEvent( Comp2D::States::GameStateBehavior* gameStateBehavior, Uint32 eventType, SDL_Keycode key = SDLK_UNKNOWN );
+			void unsubscribeFromEvent( Comp2D::Components::GameObjectBehavior* gameObjectBehavior, Uint32 eventType, SDL_Keycode key = SDLK_UNKNOWN );
+			void unsubscribeFromEvent( Comp2D::States::GameStateBehavior* gameStateBehavior, Uint32 eventType, SDL_Keycode key = SDLK_UNKNOWN );
+			void unsubscribeFromEvents( Comp2D::Components::GameObjectBehavior* gameObjectBehavior );
+			void unsubscribeFromEvents( Comp2D::States::GameStateBehavior* gameStateBehavior );
+
 			Uint32 getID() const;
 
+			Comp2D::Objects::GameObject* getGameObject( unsigned int id ) const;
+			Comp2D::Objects::GameObject* getGameObject( const std::string& name ) const;
+
+			// nullptr when the storage is disabled
+			Comp2D::Components::TransformComponentsStorage* getTransformComponentsStorage();
+
 			Comp2D::Components::Component* createComponent
 			(
 				Comp2D::Components::Component* component,
@@ -189,7 +341,20 @@ namespace Comp2D
 
 			Comp2D::Objects::GameObject* createGameObject( Comp2D::Objects::GameObject* gameObject );
 
+			// Structural changes recorded during the frame and applied together
+			// at its sync point, so nothing being walked by update, render or
+			// the contacts dispatch changes under it. A deferred GameObject may
+			// be built with its components before being recorded, with its
+			// resources already loaded by the GameState. A destroyed one is
+			// deleted along with its children and components
+			void deferCreateGameObject( Comp2D::Objects::GameObject* gameObject, Comp2D::Objects::GameObject* parentGameObject = nullptr );
+			void deferDestroyGameObject( Comp2D::Objects::GameObject* gameObject );
+			void deferReparentGameObject( Comp2D::Objects::GameObject* gameObject, Comp2D::Objects::GameObject* parentGameObject );
+			void deferSetComponentEnabled( Comp2D::Components::Component* component, bool enabled );
+			void deferSetGameObjectActive( Comp2D::Objects::GameObject* gameObject, bool active );
+
 			friend class Comp2D::Game;
+			friend class Comp2D::Objects::GameObject;
 			friend class Comp2D::States::PhysicsGameState;
 			friend class Comp2D::States::LightsGameState;
 		};
@@ -96,6 +96,10 @@ namespace Comp2D
 			virtual void update();
 
 			void setEnabled( bool enabled );
+			// onEvent only receives the subscribed event types, once attached
+			// to the GameState
+			void subscribeToEvent( Uint32 eventType, SDL_Keycode key = SDLK_UNKNOWN );
+			void unsubscribeFromEvent( Uint32 eventType, SDL_Keycode key = SDLK_UNKNOWN );
 
 			bool isEnabled() const;
 
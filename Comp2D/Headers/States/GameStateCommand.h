@@ -0,0 +1,72 @@
+/* GameStateCommand.h -- 'Comp2D' Game Engine 'GameStateCommand' class header file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#ifndef Comp2D_HEADERS_STATES_GAMESTATECOMMAND_H_
+#define Comp2D_HEADERS_STATES_GAMESTATECOMMAND_H_
+
+namespace Comp2D
+{
+	namespace Components
+	{
+		class Component;
+	}
+
+	namespace Objects
+	{
+		class GameObject;
+	}
+
+	namespace States
+	{
+		enum class EGameStateCommandType
+		{
+			CreateGameObject,
+			DestroyGameObject,
+			ReparentGameObject,
+			SetComponentEnabled,
+			SetGameObjectActive
+		};
+
+		// A structural change recorded by the GameState during the frame and
+		// applied with the others at its sync point. parentGameObject is the
+		// new parent of a created or reparented GameObject, nullptr for a
+		// root, and value is the active or enabled state to set
+		class GameStateCommand
+		{
+		public:
+			EGameStateCommandType type;
+
+			bool value = false;
+
+			Comp2D::Components::Component* component = nullptr;
+
+			Comp2D::Objects::GameObject* gameObject = nullptr;
+			Comp2D::Objects::GameObject* parentGameObject = nullptr;
+		};
+	}
+}
+
+#endif /* Comp2D_HEADERS_STATES_GAMESTATECOMMAND_H_ */
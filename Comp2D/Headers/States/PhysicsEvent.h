@@ -27,6 +27,7 @@
 #ifndef Comp2D_HEADERS_STATES_PHYSICSEVENT_H_
 #define Comp2D_HEADERS_STATES_PHYSICSEVENT_H_
 
+#include <cstddef>
 #include <list>
 
 #include "Box2D/Collision/b2Collision.h"
@@ -67,6 +68,10 @@ namespace Comp2D
 
 			virtual ~PhysicsEvent();
 
+			// From the MemoryArena of the step that raised it
+			static void* operator new( size_t size );
+			static void operator delete( void* pointer );
+
 			virtual void triggerEvent() = 0;
 		};
 	}
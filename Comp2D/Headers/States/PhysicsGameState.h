@@ -38,6 +38,7 @@
 #include "Box2D/Dynamics/b2WorldCallbacks.h"
 #include "Box2D/Dynamics/Contacts/b2Contact.h"
 
+#include "Comp2D/Headers/Memory/MemoryArena.h"
 #include "Comp2D/Headers/States/GameState.h"
 
 // TODO: Considerar encapsular o atributo estático scaleFactor
@@ -51,14 +52,32 @@ namespace Comp2D
 		class PhysicsGameState : public GameState, public b2ContactListener
 		{
 		private:
+			// Full, three quarters, half and a quarter of the iterations
+			constexpr static Uint32 PHYSICS_QUALITY_LEVELS_COUNT = 4;
+
+			unsigned int m_physicsQualityFeatureID;
+
+			// The iterations actually stepped, lowered by the quality governor
+			int32 m_governedVelocityIterations;
+			int32 m_governedPositionIterations;
+
 			std::list<PhysicsEvent*> m_physicsEvents;
 
+			// The events raised by a step, released once they are triggered
+			Comp2D::Memory::MemoryArena m_physicsEventsMemoryArena;
+
 			void beforeSetup() override;
 			void finalize() override;
-			void update() override;
+			void fixedUpdate() override;
+
+			#ifdef PROFILING
+				void addPhysicsWorldStepZones( Uint64 stepBeginCounter, Uint64 stepEndCounter );
+			#endif
 
+			void endContactGameStateBehaviors( b2Contact* contact, Comp2D::Objects::GameObject* gameObjectA, Comp2D::Objects::GameObject* gameObjectB );
 			void finalizePhysicsWorld();
 			void initializePhysicsWorld();
+			void setPhysicsQualityLevel( Uint32 physicsQualityLevel );
 			void triggerPhysicsEvents();
 
 		protected:
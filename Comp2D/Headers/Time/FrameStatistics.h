@@ -0,0 +1,93 @@
+/* FrameStatistics.h -- 'Comp2D' Game Engine 'FrameStatistics' class header file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#ifndef Comp2D_HEADERS_TIME_FRAMESTATISTICS_H_
+#define Comp2D_HEADERS_TIME_FRAMESTATISTICS_H_
+
+#include <vector>
+
+#include <SDL.h>
+
+namespace Comp2D
+{
+	namespace Time
+	{
+		// Keeps the most recent frame times in a fixed ring, for rolling
+		// percentiles and maximum, plus a histogram and an over budget count
+		// covering every frame since the last reset. The histogram buckets
+		// are powers of two in microseconds: bucket i holds frames from 2^i
+		// up to 2^(i + 1) microseconds, with the last one open ended
+		class FrameStatistics
+		{
+		public:
+			constexpr static Uint32 FRAME_TIMES_RING_CAPACITY = 512;
+			constexpr static Uint32 HISTOGRAM_BUCKETS_COUNT = 24;
+
+		private:
+			bool m_rollingStatisticsOutdated;
+
+			Uint32 m_frameTimesRingNextIndex;
+			Uint32 m_frameTimesRingSize;
+
+			Uint64 m_frameBudgetInNanoseconds;
+			Uint64 m_maximumFrameTimeInNanoseconds;
+			Uint64 m_overBudgetFramesCount;
+			Uint64 m_recordedFramesCount;
+
+			Uint64 m_frameTimesRingInNanoseconds[FRAME_TIMES_RING_CAPACITY];
+			Uint64 m_histogramBucketsFramesCounts[HISTOGRAM_BUCKETS_COUNT];
+
+			std::vector<Uint64> m_sortedFrameTimesInNanoseconds;
+
+			void updateRollingStatistics();
+
+			static Uint32 getHistogramBucketIndex( Uint64 frameTimeInNanoseconds );
+
+		public:
+			FrameStatistics();
+
+			~FrameStatistics();
+
+			void addFrameTime( Uint64 frameTimeInNanoseconds );
+			void reset();
+			void setFrameBudget( Uint64 frameBudgetInNanoseconds );
+
+			Uint32 getRecentFramesCount() const;
+
+			Uint64 getFrameBudgetInNanoseconds() const;
+			Uint64 getHistogramBucketFramesCount( Uint32 bucketIndex ) const;
+			Uint64 getOverBudgetFramesCount() const;
+			Uint64 getRecordedFramesCount() const;
+
+			Uint64 getFrameTimePercentileInNanoseconds( float percentile );
+			Uint64 getMaximumFrameTimeInNanoseconds();
+
+			static Uint64 getHistogramBucketLowerBoundInNanoseconds( Uint32 bucketIndex );
+		};
+	}
+}
+
+#endif /* Comp2D_HEADERS_TIME_FRAMESTATISTICS_H_ */
@@ -0,0 +1,79 @@
+/* StartupReport.h -- 'Comp2D' Game Engine 'StartupReport' class header file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#ifndef Comp2D_HEADERS_TIME_STARTUPREPORT_H_
+#define Comp2D_HEADERS_TIME_STARTUPREPORT_H_
+
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_atomic.h>
+
+#include "Comp2D/Headers/Time/StartupReportEntry.h"
+
+namespace Comp2D
+{
+	namespace Time
+	{
+		// Collects the time spent initializing every subsystem and loading
+		// every Resource from the start of the game to its first frame, from
+		// any thread, and logs it once ended. Nothing is recorded afterwards
+		class StartupReport
+		{
+		private:
+			StartupReport() = delete;
+
+			constexpr static Uint64 COLD_START_TARGET_IN_NANOSECONDS = 1000000000;
+
+			static SDL_atomic_t recording;
+
+			static Uint64 performanceCounterFrequency;
+			static Uint64 performanceCounterOnBegin;
+
+			static SDL_SpinLock entriesLock;
+
+			static std::vector<StartupReportEntry> entries;
+
+			static void addEntry( const std::string& name, bool resource, Uint64 startCounter );
+
+			static Uint64 counterToNanoseconds( Uint64 counter );
+
+		public:
+			static void begin();
+			// Logs the report and stops recording
+			static void end();
+
+			// The start counters come from SDL_GetPerformanceCounter
+			static void addResourceTime( const std::string& resourceName, Uint64 startCounter );
+			static void addSubsystemTime( const std::string& subsystemName, Uint64 startCounter );
+
+			static bool isRecording();
+		};
+	}
+}
+
+#endif /* Comp2D_HEADERS_TIME_STARTUPREPORT_H_ */
@@ -0,0 +1,61 @@
+/* TimeConversions.h -- 'Comp2D' Game Engine Time Conversions data and functions file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#ifndef Comp2D_HEADERS_TIME_TIMECONVERSIONS_H_
+#define Comp2D_HEADERS_TIME_TIMECONVERSIONS_H_
+
+#include <SDL.h>
+
+namespace Comp2D
+{
+	namespace Time
+	{
+		constexpr Uint64 NANOSECONDS_IN_MILLISECOND = 1000000;
+		constexpr Uint64 NANOSECONDS_IN_SECOND = 1000000000;
+
+		inline Uint64 millisecondsToNanoseconds( Uint32 timeInMilliseconds )
+		{
+			return static_cast<Uint64>( timeInMilliseconds ) * NANOSECONDS_IN_MILLISECOND;
+		}
+
+		inline Uint32 nanosecondsToMilliseconds( Uint64 timeInNanoseconds )
+		{
+			return static_cast<Uint32>( timeInNanoseconds / NANOSECONDS_IN_MILLISECOND );
+		}
+
+		inline float nanosecondsToSeconds( Uint64 timeInNanoseconds )
+		{
+			return static_cast<float>( static_cast<double>( timeInNanoseconds ) / static_cast<double>( NANOSECONDS_IN_SECOND ) );
+		}
+
+		inline Uint64 secondsToNanoseconds( float timeInSeconds )
+		{
+			return static_cast<Uint64>( static_cast<double>( timeInSeconds ) * static_cast<double>( NANOSECONDS_IN_SECOND ) );
+		}
+	}
+}
+
+#endif /* Comp2D_HEADERS_TIME_TIMECONVERSIONS_H_ */
@@ -37,23 +37,47 @@ namespace Comp2D
 {
 	namespace Time
 	{
+		enum class EFramePhase
+		{
+			Events,
+			Update,
+			Render,
+			Present,
+			FramePhaseCount
+		};
+
 		class TimeManager
 		{
 		private:
-			Uint32 m_currentStateInitializedTime;
+			bool m_clockSimulated;
+
 			Uint32 m_deltaTimeInMilliseconds;
+			Uint32 m_fixedDeltaTimeInMilliseconds;
 			Uint32 m_scaledDeltaTimeInMilliseconds;
 
+			Uint64 m_currentStateInitializedTimeInNanoseconds;
+			Uint64 m_deltaTimeInNanoseconds;
+			Uint64 m_framePhasesDurationsInNanoseconds[static_cast<int>( EFramePhase::FramePhaseCount )];
+			Uint64 m_performanceCounterFrequency;
+			Uint64 m_performanceCounterOnSDLInitialization;
+			Uint64 m_simulatedTimeSinceSDLInitializationInNanoseconds;
+
 			float m_deltaTimeInSeconds;
+			float m_fixedDeltaTimeInSeconds;
+			float m_fixedTimeStepInterpolationFactor;
 			float m_scaledDeltaTimeInSeconds;
+			float m_smoothedDeltaTimeInSeconds;
 			float m_timeScale;
 
 			Comp2D::Time::Timer pausableTimeSinceSDLInitializationTimer;
 			Comp2D::Time::Timer pausableTimeSinceStateInitializedTimer;
 
+			void advanceSimulatedClock( Uint64 timeInNanoseconds );
 			void pause();
-			void setCurrentStateInitializedTime( Uint32 currentStateInitializedTime );
-			void setDeltaTime( Uint32 deltaTime );
+			void setCurrentStateInitializedTime( Uint64 currentStateInitializedTimeInNanoseconds );
+			void setDeltaTime( Uint64 deltaTimeInNanoseconds );
+			void setFixedTimeStepInterpolationFactor( float fixedTimeStepInterpolationFactor );
+			void setFramePhaseDuration( EFramePhase framePhase, Uint64 durationInNanoseconds );
 			void unpause();
 
 		public:
@@ -61,19 +85,39 @@ namespace Comp2D
 
 			~TimeManager();
 
+			void setFixedDeltaTime( float fixedDeltaTimeInSeconds );
 			void setTimeScale( float timeScale );
 
+			// While headless the game time follows the simulated clock, which
+			// only advances by the simulated steps
+			bool isClockSimulated() const;
+
 			Uint32 getDeltaTimeInMilliseconds();
+			Uint32 getFixedDeltaTimeInMilliseconds();
 			Uint32 getPausableTimeSinceSDLInitializationInMilliseconds();
 			Uint32 getPausableTimeSinceStateInitializedInMilliseconds();
 			Uint32 getScaledDeltaTimeInMilliseconds();
 			Uint32 getTimeSinceSDLInitializationInMilliseconds();
 			Uint32 getTimeSinceStateInitializedInMilliseconds();
 
+			Uint64 getDeltaTimeInNanoseconds();
+			Uint64 getFramePhaseDurationInNanoseconds( EFramePhase framePhase );
+			Uint64 getPausableTimeSinceSDLInitializationInNanoseconds();
+			Uint64 getPausableTimeSinceStateInitializedInNanoseconds();
+			// Wall clock time, even when the clock is simulated
+			Uint64 getRealTimeSinceSDLInitializationInNanoseconds();
+			Uint64 getTimeSinceSDLInitializationInNanoseconds();
+			Uint64 getTimeSinceStateInitializedInNanoseconds();
+
 			float getDeltaTimeInSeconds();
+			float getFixedDeltaTimeInSeconds();
+			float getFixedTimeStepInterpolationFactor();
+			float getFramePhaseDurationInSeconds( EFramePhase framePhase );
 			float getPausableTimeSinceSDLInitializationInSeconds();
 			float getPausableTimeSinceStateInitializedInSeconds();
 			float getScaledDeltaTimeInSeconds();
+			float getScaledSmoothedDeltaTimeInSeconds();
+			float getSmoothedDeltaTimeInSeconds();
 			float getTimeScale();
 			float getTimeSinceSDLInitializationInSeconds();
 			float getTimeSinceStateInitializedInSeconds();
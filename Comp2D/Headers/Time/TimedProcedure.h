@@ -39,53 +39,58 @@ namespace Comp2D
 {
 	namespace Time
 	{
+		// Pooled node of a TimedProceduresScheduler. The callback time is
+		// measured in the scheduler time domain it was scheduled on, which for
+		// pausable procedures does not advance while paused. The generation
+		// changes every time the node is released, invalidating old handles
 		class TimedProcedure
 		{
 		private:
 			bool m_pausable;
-			bool m_paused;
+			bool m_pending;
 			/*bool m_useDeltaTime;
 			bool m_useTimeScale;*/
 
 			unsigned int m_id;
 
-			Uint32 m_callbackTimeInMilliseconds;
-			Uint32 m_timeSinceSDLInitializationInMillisecondsOnPaused;
+			Uint32 m_generation;
+
+			Uint64 m_callbackTimeInNanoseconds;
 
 			std::function<void()> m_timedProcedure;
 
 		public:
-			TimedProcedure
+			TimedProcedure();
+
+			~TimedProcedure();
+
+			bool operator==( const TimedProcedure& rhs ) const;
+
+			bool operator!=( const TimedProcedure& rhs ) const;
+
+			void reset
 			(
 				unsigned int id,
 				std::function<void()> timedProcedure,
-				Uint32 callbackTimeInMilliseconds,
+				Uint64 callbackTimeInNanoseconds,
 				bool pausable
 				/*bool useTimeScale,
 				bool useDeltaTime*/
 			);
 
-			~TimedProcedure();
-
-			bool operator==( const TimedProcedure& rhs ) const;
-
-			bool operator!=( const TimedProcedure& rhs ) const;
-
-			void pause();
-			void unpause();
+			std::function<void()> release();
 
 			bool isPausable() const;
-			bool isPaused() const;
-
-			bool checkCallbackTime( Uint32 currentTime );
+			bool isPending() const;
 
 			unsigned int getID() const;
 
-			Uint32 getCallbackTimeInMilliseconds();
-			Uint32 getTimeSinceSDLInitializationInMillisecondsOnPaused();
+			Uint32 getCallbackTimeInMilliseconds() const;
+			Uint32 getGeneration() const;
+
+			Uint64 getCallbackTimeInNanoseconds() const;
 
-			float getCallbackTimeInSeconds();
-			float getTimeSinceSDLInitializationInSecondsOnPaused();
+			float getCallbackTimeInSeconds() const;
 		};
 	}
 }
@@ -0,0 +1,118 @@
+/* TimedProceduresScheduler.h -- 'Comp2D' Game Engine 'TimedProceduresScheduler' class header file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#ifndef Comp2D_HEADERS_TIME_TIMEDPROCEDURESSCHEDULER_H_
+#define Comp2D_HEADERS_TIME_TIMEDPROCEDURESSCHEDULER_H_
+
+#include <functional>
+#include <vector>
+
+#include <SDL.h>
+
+#include "Comp2D/Headers/Time/TimedProcedure.h"
+#include "Comp2D/Headers/Time/TimedProcedureHandle.h"
+
+namespace Comp2D
+{
+	namespace Time
+	{
+		// Keeps TimedProcedures in two min-heaps ordered by callback time, one
+		// per time domain. The pausable domain is the scheduler time minus
+		// every paused interval, so pausing and unpausing do not touch the
+		// procedures. Cancelled procedures are released right away and their
+		// stale heap entries are skipped when they reach the top
+		class TimedProceduresScheduler
+		{
+		private:
+			class HeapEntry
+			{
+			public:
+				Uint32 generation;
+				Uint32 nodeIndex;
+				Uint32 sequence;
+
+				Uint64 callbackTimeInNanoseconds;
+
+				bool operator>( const HeapEntry& rhs ) const;
+			};
+
+			bool m_paused;
+
+			unsigned int m_nextID;
+
+			Uint32 m_nextSequence;
+			Uint32 m_pendingCount;
+
+			Uint64 m_pausedTimeInNanoseconds;
+			Uint64 m_timeOnPausedInNanoseconds;
+
+			std::vector<Uint32> m_freeNodesIndices;
+
+			std::vector<HeapEntry> m_deferredHeapEntries;
+			std::vector<HeapEntry> m_pausableHeap;
+			std::vector<HeapEntry> m_unpausableHeap;
+
+			std::vector<TimedProcedure> m_nodes;
+
+			void callDueProcedures( std::vector<HeapEntry>& heap, Uint64 domainTimeInNanoseconds, Uint32 firstDeferredSequence );
+			void compactHeap( std::vector<HeapEntry>& heap );
+			void pushHeapEntry( std::vector<HeapEntry>& heap, const HeapEntry& heapEntry );
+
+			bool isHeapEntryStale( const HeapEntry& heapEntry ) const;
+
+			Uint32 acquireNode();
+
+			Uint64 getPausableTimeInNanoseconds( Uint64 currentTimeInNanoseconds ) const;
+
+		public:
+			TimedProceduresScheduler();
+
+			~TimedProceduresScheduler();
+
+			void clear();
+			void pause( Uint64 currentTimeInNanoseconds );
+			void unpause( Uint64 currentTimeInNanoseconds );
+			void update( Uint64 currentTimeInNanoseconds );
+
+			bool cancel( const TimedProcedureHandle& handle );
+
+			bool isPaused() const;
+			bool isPending( const TimedProcedureHandle& handle ) const;
+
+			Uint32 getPendingCount() const;
+
+			TimedProcedureHandle schedule
+			(
+				std::function<void()> timedProcedure,
+				Uint64 delayInNanoseconds,
+				bool pausable,
+				Uint64 currentTimeInNanoseconds
+			);
+		};
+	}
+}
+
+#endif /* Comp2D_HEADERS_TIME_TIMEDPROCEDURESSCHEDULER_H_ */
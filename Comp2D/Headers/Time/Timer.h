@@ -39,21 +39,18 @@ namespace Comp2D
 			bool m_paused;
 			bool m_started;
 
-			Uint32 m_timeOnPausedInMilliseconds;
-			Uint32 m_timeOnStartInMilliseconds;
-
-			float m_timeOnPausedInSeconds;
-			float m_timeOnStartInSeconds;
+			Uint64 m_timeOnPausedInNanoseconds;
+			Uint64 m_timeOnStartInNanoseconds;
 
 		public:
-			Timer( Uint32 timeOnStartInMilliseconds = 0 );
+			Timer( Uint64 timeOnStartInNanoseconds = 0 );
 
 			~Timer();
 
 			void pause();
-			void setTimeOnStart( Uint32 timeOnStartInMilliseconds );
+			void setTimeOnStart( Uint64 timeOnStartInNanoseconds );
 			void start();
-			void start( Uint32 timeOnStartInMilliseconds );
+			void start( Uint64 timeOnStartInNanoseconds );
 			void stop();
 			void unpause();
 
@@ -64,6 +61,10 @@ namespace Comp2D
 			Uint32 getTimeOnPausedInMilliseconds() const;
 			Uint32 getTimeOnStartInMilliseconds() const;
 
+			Uint64 getElapsedTimeInNanoseconds() const;
+			Uint64 getTimeOnPausedInNanoseconds() const;
+			Uint64 getTimeOnStartInNanoseconds() const;
+
 			float getElapsedTimeInSeconds() const;
 			float getTimeOnPausedInSeconds() const;
 			float getTimeOnStartInSeconds() const;
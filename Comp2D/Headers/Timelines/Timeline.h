@@ -51,9 +51,9 @@ namespace Comp2D
 			int m_currentTimelineEventIndex;
 			int m_lastTimelineEventIndex;
 
-			Uint32 m_nextEventTimeSinceSDLInitializationInMilliseconds;
-			Uint32 m_timeSinceSDLInitializationInMillisecondsOnPaused;
-			Uint32 m_timeSinceSDLInitializationInMillisecondsOnStarted;
+			Uint64 m_nextEventTimeSinceSDLInitializationInNanoseconds;
+			Uint64 m_timeSinceSDLInitializationInNanosecondsOnPaused;
+			Uint64 m_timeSinceSDLInitializationInNanosecondsOnStarted;
 
 			std::string m_name;
 
@@ -86,7 +86,7 @@ namespace Comp2D
 			void start( Comp2D::Objects::GameObject* timelinesControllerComponentGameObject, int startingTimelineEventIndex = 0 );
 			void stop();
 			void unpause();
-			void update( Uint32 currentTime, Comp2D::Objects::GameObject* timelinesControllerComponentGameObject );
+			void update( Uint64 currentTime, Comp2D::Objects::GameObject* timelinesControllerComponentGameObject );
 
 			bool hasStarted() const;
 			bool isLooping() const;
@@ -98,9 +98,9 @@ namespace Comp2D
 			int getCurrentTimelineEventIndex() const;
 			int getLastTimelineEventIndex() const;
 
-			Uint32 getNextEventTimeSinceSDLInitializationInMilliseconds() const;
-			Uint32 getTimeSinceSDLInitializationInMillisecondsOnPaused() const;
-			Uint32 getTimeSinceSDLInitializationInMillisecondsOnStarted() const;
+			Uint64 getNextEventTimeSinceSDLInitializationInNanoseconds() const;
+			Uint64 getTimeSinceSDLInitializationInNanosecondsOnPaused() const;
+			Uint64 getTimeSinceSDLInitializationInNanosecondsOnStarted() const;
 
 			const std::string& getName() const;
 
@@ -59,7 +59,7 @@ namespace Comp2D
 			void setCurrentTimeline( int timelineIndex );
 			void setCurrentTimeline( const std::string& timelineResourceName );
 			void setCurrentTimeline( const Comp2D::Timelines::Timeline& timeline );
-			void update( Uint32 currentTime, Comp2D::Objects::GameObject* timelinesControllerComponentGameObject );
+			void update( Uint64 currentTime, Comp2D::Objects::GameObject* timelinesControllerComponentGameObject );
 
 			int getCurrentTimelineIndex() const;
 
@@ -32,6 +32,7 @@
 
 #include "Comp2D/Headers/Game.h"
 #include "Comp2D/Headers/Animations/AnimationKeyframe.h"
+#include "Comp2D/Headers/Time/TimeConversions.h"
 #include "Comp2D/Headers/Time/TimeManager.h"
 
 Comp2D::Animations::Animation::Animation
@@ -46,9 +47,9 @@ Comp2D::Animations::Animation::Animation
 	m_playing( false ),
 	m_started( false ),
 	m_animationKeyframeCount( animationKeyframeCount ),
-	m_nextFrameTimeSinceSDLInitializationInMilliseconds( 0 ),
-	m_timeSinceSDLInitializationInMillisecondsOnPaused( 0 ),
-	m_timeSinceSDLInitializationInMillisecondsOnStarted( 0 )/*,
+	m_nextFrameTimeSinceSDLInitializationInNanoseconds( 0 ),
+	m_timeSinceSDLInitializationInNanosecondsOnPaused( 0 ),
+	m_timeSinceSDLInitializationInNanosecondsOnStarted( 0 )/*,
 	m_name( name )*/
 {
 	#ifdef DEBUG
@@ -108,7 +109,7 @@ void Comp2D::Animations::Animation::pause()
 		m_paused = true;
 		m_playing = false;
 
-		m_timeSinceSDLInitializationInMillisecondsOnPaused = Comp2D::Game::timeManager->getTimeSinceSDLInitializationInMilliseconds();
+		m_timeSinceSDLInitializationInNanosecondsOnPaused = Comp2D::Game::getTimeManager()->getTimeSinceSDLInitializationInNanoseconds();
 	}
 }
 
@@ -133,10 +134,10 @@ void Comp2D::Animations::Animation::start( int startingAnimationKeyframeIndex )
 
 	setCurrentAnimationKeyframe( startingAnimationKeyframeIndex );
 
-	m_timeSinceSDLInitializationInMillisecondsOnStarted = Comp2D::Game::timeManager->getTimeSinceSDLInitializationInMilliseconds();
+	m_timeSinceSDLInitializationInNanosecondsOnStarted = Comp2D::Game::getTimeManager()->getTimeSinceSDLInitializationInNanoseconds();
 
-	m_nextFrameTimeSinceSDLInitializationInMilliseconds = getTimeSinceSDLInitializationInMillisecondsOnStarted() +
-														  getCurrentAnimationKeyframe().getDurationInMilliseconds();
+	m_nextFrameTimeSinceSDLInitializationInNanoseconds = getTimeSinceSDLInitializationInNanosecondsOnStarted() +
+														  Comp2D::Time::millisecondsToNanoseconds( getCurrentAnimationKeyframe().getDurationInMilliseconds() );
 }
 
 void Comp2D::Animations::Animation::stop()
@@ -161,44 +162,44 @@ void Comp2D::Animations::Animation::unpause()
 		m_paused = false;
 		m_playing = true;
 
-		Uint32 timeLeftToNextFrameInMilliseconds = getNextFrameTimeSinceSDLInitializationInMilliseconds() -
-												   getTimeSinceSDLInitializationInMillisecondsOnPaused();
+		Uint64 timeLeftToNextFrameInNanoseconds = getNextFrameTimeSinceSDLInitializationInNanoseconds() -
+												   getTimeSinceSDLInitializationInNanosecondsOnPaused();
 
-		m_nextFrameTimeSinceSDLInitializationInMilliseconds = Comp2D::Game::timeManager->getTimeSinceSDLInitializationInMilliseconds() +
-															  timeLeftToNextFrameInMilliseconds;
+		m_nextFrameTimeSinceSDLInitializationInNanoseconds = Comp2D::Game::getTimeManager()->getTimeSinceSDLInitializationInNanoseconds() +
+															  timeLeftToNextFrameInNanoseconds;
 	}
 }
 
-void Comp2D::Animations::Animation::update( Uint32 currentTime )
+void Comp2D::Animations::Animation::update( Uint64 currentTime )
 {
 	#ifdef DEBUG
-		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Animation named %s update: currentTime = %u\n", m_name.c_str(), currentTime );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Animation named %s update: currentTime = %" SDL_PRIu64 "\n", m_name.c_str(), currentTime );
 
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Animation named %s isPlaying() = %i\n", m_name.c_str(), isPlaying() );
-		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Animation named %s SDL_TICKS_PASSED() = %i\n", m_name.c_str(), SDL_TICKS_PASSED( currentTime, getNextFrameTimeSinceSDLInitializationInMilliseconds() ) );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Animation named %s next frame time passed = %i\n", m_name.c_str(), currentTime >= getNextFrameTimeSinceSDLInitializationInNanoseconds() );
 	#endif
 
 	if
 	(
 		isPlaying() &&
-		SDL_TICKS_PASSED( currentTime, getNextFrameTimeSinceSDLInitializationInMilliseconds() )
+		currentTime >= getNextFrameTimeSinceSDLInitializationInNanoseconds()
 	)
 	{
 		if( getCurrentAnimationKeyframeIndex() < getLastAnimationKeyframeIndex() )
 		{
 			advanceToNextAnimationKeyframe();
 
-			m_nextFrameTimeSinceSDLInitializationInMilliseconds = Comp2D::Game::timeManager->getTimeSinceSDLInitializationInMilliseconds() +
-																  getCurrentAnimationKeyframe().getDurationInMilliseconds();
+			m_nextFrameTimeSinceSDLInitializationInNanoseconds = Comp2D::Game::getTimeManager()->getTimeSinceSDLInitializationInNanoseconds() +
+																  Comp2D::Time::millisecondsToNanoseconds( getCurrentAnimationKeyframe().getDurationInMilliseconds() );
 		}
 		else if( isLooping() )
 		{
 			setCurrentAnimationKeyframe( 0 );
 
-			m_timeSinceSDLInitializationInMillisecondsOnStarted = Comp2D::Game::timeManager->getTimeSinceSDLInitializationInMilliseconds();
+			m_timeSinceSDLInitializationInNanosecondsOnStarted = Comp2D::Game::getTimeManager()->getTimeSinceSDLInitializationInNanoseconds();
 
-			m_nextFrameTimeSinceSDLInitializationInMilliseconds = getTimeSinceSDLInitializationInMillisecondsOnStarted() +
-																  getCurrentAnimationKeyframe().getDurationInMilliseconds();
+			m_nextFrameTimeSinceSDLInitializationInNanoseconds = getTimeSinceSDLInitializationInNanosecondsOnStarted() +
+																  Comp2D::Time::millisecondsToNanoseconds( getCurrentAnimationKeyframe().getDurationInMilliseconds() );
 		}
 		else
 		{
@@ -270,31 +271,31 @@ int Comp2D::Animations::Animation::getLastAnimationKeyframeIndex() const
 	return m_lastAnimationKeyframeIndex;
 }
 
-Uint32 Comp2D::Animations::Animation::getNextFrameTimeSinceSDLInitializationInMilliseconds() const
+Uint64 Comp2D::Animations::Animation::getNextFrameTimeSinceSDLInitializationInNanoseconds() const
 {
 	#ifdef DEBUG
-		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Animation named %s getNextFrameTimeSinceSDLInitializationInMilliseconds\n", m_name.c_str() );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Animation named %s getNextFrameTimeSinceSDLInitializationInNanoseconds\n", m_name.c_str() );
 	#endif
 
-	return m_nextFrameTimeSinceSDLInitializationInMilliseconds;
+	return m_nextFrameTimeSinceSDLInitializationInNanoseconds;
 }
 
-Uint32 Comp2D::Animations::Animation::getTimeSinceSDLInitializationInMillisecondsOnPaused() const
+Uint64 Comp2D::Animations::Animation::getTimeSinceSDLInitializationInNanosecondsOnPaused() const
 {
 	#ifdef DEBUG
-		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Animation named %s getTimeSinceSDLInitializationInMillisecondsOnPaused\n", m_name.c_str() );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Animation named %s getTimeSinceSDLInitializationInNanosecondsOnPaused\n", m_name.c_str() );
 	#endif
 
-	return m_timeSinceSDLInitializationInMillisecondsOnPaused;
+	return m_timeSinceSDLInitializationInNanosecondsOnPaused;
 }
 
-Uint32 Comp2D::Animations::Animation::getTimeSinceSDLInitializationInMillisecondsOnStarted() const
+Uint64 Comp2D::Animations::Animation::getTimeSinceSDLInitializationInNanosecondsOnStarted() const
 {
 	#ifdef DEBUG
-		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Animation named %s getTimeSinceSDLInitializationInMillisecondsOnStarted\n", m_name.c_str() );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Animation named %s getTimeSinceSDLInitializationInNanosecondsOnStarted\n", m_name.c_str() );
 	#endif
 
-	return m_timeSinceSDLInitializationInMillisecondsOnStarted;
+	return m_timeSinceSDLInitializationInNanosecondsOnStarted;
 }
 
 const std::string& Comp2D::Animations::Animation::getName() const
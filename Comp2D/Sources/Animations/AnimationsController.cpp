@@ -76,7 +76,7 @@ void Comp2D::Animations::AnimationsController::setCurrentAnimation( int animatio
 
 	m_currentAnimation = static_cast<Comp2D::Resources::GenericResource<Comp2D::Animations::Animation>*>
 	(
-		Comp2D::Game::resourcesManager->getResource( m_animationsResourcesNames[m_currentAnimationIndex] )
+		Comp2D::Game::getResourcesManager()->getResource( m_animationsResourcesNames[m_currentAnimationIndex] )
 	)->getGenericResource();
 
 	#ifdef DEBUG
@@ -108,9 +108,9 @@ void Comp2D::Animations::AnimationsController::setCurrentAnimation( const Comp2D
 	setCurrentAnimation( animation.getName() );
 }
 
-void Comp2D::Animations::AnimationsController::update( Uint32 currentTime )
+void Comp2D::Animations::AnimationsController::update( Uint64 currentTime )
 {
-	SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "AnimationsController update: currentTime = %u\n", currentTime );
+	SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "AnimationsController update: currentTime = %" SDL_PRIu64 "\n", currentTime );
 
 	m_currentAnimation->update( currentTime );
 }
@@ -143,7 +143,7 @@ std::list<Comp2D::Animations::Animation> Comp2D::Animations::AnimationsControlle
 		(
 			*static_cast<Comp2D::Resources::GenericResource<Comp2D::Animations::Animation>*>
 			(
-				Comp2D::Game::resourcesManager->getResource( *animationResourceNameIt )
+				Comp2D::Game::getResourcesManager()->getResource( *animationResourceNameIt )
 			)->getGenericResource()
 		);
 	}
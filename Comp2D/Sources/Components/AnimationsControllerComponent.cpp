@@ -374,14 +374,14 @@ void Comp2D::Components::AnimationsControllerComponent::setPausable( bool pausab
 	}
 }
 
-void Comp2D::Components::AnimationsControllerComponent::update( Uint32 currentTime )
+void Comp2D::Components::AnimationsControllerComponent::update( Uint64 currentTime )
 {
 	#ifdef DEBUG
 		/*
 		SDL_LogDebug
 		(
 			SDL_LOG_CATEGORY_TEST,
-			"AnimationsControllerComponent with ID %u (From GameObject with ID %u named %s) update: currentTime = %u\n",
+			"AnimationsControllerComponent with ID %u (From GameObject with ID %u named %s) update: currentTime = %" SDL_PRIu64 "\n",
 			m_id,
 			gameObject->getID(),
 			gameObject->getName().c_str(),
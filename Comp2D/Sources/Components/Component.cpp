@@ -28,6 +28,9 @@
 
 #include <SDL.h>
 
+#include "Comp2D/Headers/Components/ComponentType.h"
+#include "Comp2D/Headers/Memory/MemoryArena.h"
+
 Comp2D::Components::Component::Component
 (
 	unsigned int id,
@@ -38,6 +41,7 @@ Comp2D::Components::Component::Component
 	m_enabled( false ),
 	m_executedOnInstantiated( false ),
 	m_id( id ),
+	m_roles( static_cast<Uint32>( EComponentRole::None ) ),
 	gameObject( gameObject )
 {
 	#ifdef DEBUG
@@ -88,6 +92,24 @@ Comp2D::Components::Component::~Component()
 	#endif
 }
 
+void* Comp2D::Components::Component::operator new( size_t size )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Component operator new: size = %u\n", static_cast<unsigned int>( size ) );
+	#endif
+
+	return Comp2D::Memory::MemoryArena::allocate( size );
+}
+
+void Comp2D::Components::Component::operator delete( void* pointer )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Component operator delete\n" );
+	#endif
+
+	Comp2D::Memory::MemoryArena::deallocate( pointer );
+}
+
 bool Comp2D::Components::Component::operator==( const Component& rhs ) const
 {
 	#ifdef DEBUG
@@ -142,11 +164,21 @@ void Comp2D::Components::Component::setActiveInHierarchy( bool activeInHierarchy
 	{
 		onActivateInHierarchy();
 		m_activeInHierarchy = activeInHierarchy;
+
+		if( hasRole( EComponentRole::GameObjectBehavior ) )
+		{
+			gameObject->notifyBehaviorsChanged();
+		}
 	}
 	else if( m_activeInHierarchy && !activeInHierarchy )
 	{
 		onDeactivateInHierarchy();
 		m_activeInHierarchy = activeInHierarchy;
+
+		if( hasRole( EComponentRole::GameObjectBehavior ) )
+		{
+			gameObject->notifyBehaviorsChanged();
+		}
 	}
 }
 
@@ -170,11 +202,21 @@ void Comp2D::Components::Component::setEnabled( bool enabled )
 	{
 		onEnable();
 		m_enabled = enabled;
+
+		if( hasRole( EComponentRole::GameObjectBehavior ) )
+		{
+			gameObject->notifyBehaviorsChanged();
+		}
 	}
 	else if( m_enabled && !enabled )
 	{
 		onDisable();
 		m_enabled = enabled;
+
+		if( hasRole( EComponentRole::GameObjectBehavior ) )
+		{
+			gameObject->notifyBehaviorsChanged();
+		}
 	}
 }
 
@@ -232,6 +274,24 @@ bool Comp2D::Components::Component::isEnabled() const
 	return m_enabled;
 }
 
+bool Comp2D::Components::Component::hasRole( EComponentRole role ) const
+{
+	#ifdef DEBUG
+		/*
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"Component with ID %u (From GameObject with ID %u named %s) hasRole\n",
+			m_id,
+			gameObject->getID(),
+			gameObject->getName().c_str()
+		);
+		*/
+	#endif
+
+	return ( m_roles & static_cast<Uint32>( role ) ) != 0;
+}
+
 unsigned int Comp2D::Components::Component::getID() const
 {
 	#ifdef DEBUG
@@ -249,3 +309,21 @@ unsigned int Comp2D::Components::Component::getID() const
 
 	return m_id;
 }
+
+Uint32 Comp2D::Components::Component::getRoles() const
+{
+	#ifdef DEBUG
+		/*
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"Component with ID %u (From GameObject with ID %u named %s) getRoles\n",
+			m_id,
+			gameObject->getID(),
+			gameObject->getName().c_str()
+		);
+		*/
+	#endif
+
+	return m_roles;
+}
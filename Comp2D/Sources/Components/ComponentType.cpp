@@ -0,0 +1,132 @@
+/* ComponentType.cpp -- 'Comp2D' Game Engine 'ComponentType' class source file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#include "Comp2D/Headers/Components/ComponentType.h"
+
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_atomic.h>
+
+#include "Comp2D/Headers/Components/AnimationsControllerComponent.h"
+#include "Comp2D/Headers/Components/Component.h"
+#include "Comp2D/Headers/Components/GameObjectBehavior.h"
+#include "Comp2D/Headers/Components/PhysicsTransformComponent.h"
+#include "Comp2D/Headers/Components/Renderable.h"
+#include "Comp2D/Headers/Components/ResourceComponent.h"
+#include "Comp2D/Headers/Components/TimelinesControllerComponent.h"
+
+SDL_SpinLock Comp2D::Components::ComponentType::typesLock = 0;
+
+std::vector<bool (*)( const Comp2D::Components::Component* )> Comp2D::Components::ComponentType::instanceTests;
+
+Uint32 Comp2D::Components::ComponentType::registerType( bool (*instanceTest)( const Component* ) )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ComponentType registerType\n" );
+	#endif
+
+	SDL_AtomicLock( &typesLock );
+
+	Uint32 typeID = static_cast<Uint32>( instanceTests.size() );
+
+	instanceTests.push_back( instanceTest );
+
+	SDL_AtomicUnlock( &typesLock );
+
+	return typeID;
+}
+
+bool Comp2D::Components::ComponentType::isInstance( Uint32 typeID, const Component* component )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ComponentType isInstance: typeID = %u\n", typeID );
+	#endif
+
+	SDL_AtomicLock( &typesLock );
+
+	bool (*instanceTest)( const Component* ) = instanceTests[typeID];
+
+	SDL_AtomicUnlock( &typesLock );
+
+	return instanceTest( component );
+}
+
+Uint32 Comp2D::Components::ComponentType::getRoles( const Component* component )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ComponentType getRoles: component with ID %u\n", component->getID() );
+	#endif
+
+	Uint32 roles = static_cast<Uint32>( EComponentRole::None );
+
+	if( dynamic_cast<const GameObjectBehavior*>( component ) )
+	{
+		roles |= static_cast<Uint32>( EComponentRole::GameObjectBehavior );
+	}
+
+	if( dynamic_cast<const Renderable*>( component ) )
+	{
+		roles |= static_cast<Uint32>( EComponentRole::Renderable );
+	}
+
+	if( dynamic_cast<const ResourceComponent*>( component ) )
+	{
+		roles |= static_cast<Uint32>( EComponentRole::ResourceComponent );
+	}
+
+	if( dynamic_cast<const AnimationsControllerComponent*>( component ) )
+	{
+		roles |= static_cast<Uint32>( EComponentRole::AnimationsController );
+	}
+
+	if( dynamic_cast<const TimelinesControllerComponent*>( component ) )
+	{
+		roles |= static_cast<Uint32>( EComponentRole::TimelinesController );
+	}
+
+	if( dynamic_cast<const PhysicsTransformComponent*>( component ) )
+	{
+		roles |= static_cast<Uint32>( EComponentRole::PhysicsTransform );
+	}
+
+	return roles;
+}
+
+Uint32 Comp2D::Components::ComponentType::getTypesCount()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ComponentType getTypesCount\n" );
+	#endif
+
+	SDL_AtomicLock( &typesLock );
+
+	Uint32 typesCount = static_cast<Uint32>( instanceTests.size() );
+
+	SDL_AtomicUnlock( &typesLock );
+
+	return typesCount;
+}
@@ -36,6 +36,7 @@
 
 #include "Comp2D/Headers/Components/Component.h"
 #include "Comp2D/Headers/Objects/GameObject.h"
+#include "Comp2D/Headers/States/GameState.h"
 
 Comp2D::Components::GameObjectBehavior::GameObjectBehavior
 (
@@ -384,3 +385,57 @@ void Comp2D::Components::GameObjectBehavior::preSolve( b2Contact* contact, const
 		*/
 	#endif
 }
+
+bool Comp2D::Components::GameObjectBehavior::isParallelSafe() const
+{
+	#ifdef DEBUG
+		/*
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"GameObjectBehavior with ID %u (From GameObject with ID %u named %s) isParallelSafe\n",
+			m_id,
+			gameObject->getID(),
+			gameObject->getName().c_str()
+		);
+		*/
+	#endif
+
+	return false;
+}
+
+void Comp2D::Components::GameObjectBehavior::subscribeToEvent( Uint32 eventType, SDL_Keycode key )
+{
+	#ifdef DEBUG
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"GameObjectBehavior with ID %u (From GameObject with ID %u named %s) subscribeToEvent: eventType = %u; key = %i\n",
+			m_id,
+			gameObject->getID(),
+			gameObject->getName().c_str(),
+			eventType,
+			key
+		);
+	#endif
+
+	gameObject->gameState->subscribeToEvent( this, eventType, key );
+}
+
+void Comp2D::Components::GameObjectBehavior::unsubscribeFromEvent( Uint32 eventType, SDL_Keycode key )
+{
+	#ifdef DEBUG
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"GameObjectBehavior with ID %u (From GameObject with ID %u named %s) unsubscribeFromEvent: eventType = %u; key = %i\n",
+			m_id,
+			gameObject->getID(),
+			gameObject->getName().c_str(),
+			eventType,
+			key
+		);
+	#endif
+
+	gameObject->gameState->unsubscribeFromEvent( this, eventType, key );
+}
@@ -112,7 +112,7 @@ void Comp2D::Components::GameObjectBehaviors::ObjectPool::updateGameObjectTransf
 
 	if( gameObject->transform )
 	{
-		gameObject->transform->updateTransform();
+		gameObject->transform->refreshTransform();
 	}
 
 	Comp2D::Objects::GameObject* currentChildGameObject = nullptr;
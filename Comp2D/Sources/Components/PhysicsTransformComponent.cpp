@@ -47,6 +47,7 @@
 #include "Comp2D/Headers/Components/TransformComponent.h"
 #include "Comp2D/Headers/Objects/GameObject.h"
 #include "Comp2D/Headers/States/PhysicsGameState.h"
+#include "Comp2D/Headers/Time/TimeManager.h"
 #include "Comp2D/Headers/Utilities/Math.h"
 #include "Comp2D/Headers/Utilities/Vector2D.h"
 
@@ -73,14 +74,18 @@ Comp2D::Components::PhysicsTransformComponent::PhysicsTransformComponent
 
 	m_body = world->CreateBody( &def );
 	m_body->SetUserData( gameObject );
+	m_storage->bodies[m_storageIndex] = m_body;
 
-	m_localRotation = m_body->GetAngle() * Comp2D::Utilities::RAD_IN_DEGREES;
-	m_worldRotation = m_localRotation;
+	localRotation() = m_body->GetAngle() * Comp2D::Utilities::RAD_IN_DEGREES;
+	worldRotation() = localRotation();
 
-	m_localPosition = m_body->GetPosition();
-	m_localScale = b2Vec2( 1.0f, 1.0f );
-	m_worldPosition = m_localPosition;
-	m_worldScale = b2Vec2( 1.0f, 1.0f );
+	localPosition() = m_body->GetPosition();
+	localScale() = b2Vec2( 1.0f, 1.0f );
+	worldPosition() = localPosition();
+	worldScale() = b2Vec2( 1.0f, 1.0f );
+
+	previousWorldRotation() = worldRotation();
+	previousWorldPosition() = worldPosition();
 
 	#ifdef DEBUG
 		SDL_LogDebug
@@ -144,14 +149,18 @@ Comp2D::Components::PhysicsTransformComponent::PhysicsTransformComponent
 	bodyDef.gravityScale = gravityScale;
 
 	m_body = world->CreateBody( &bodyDef );
+	m_storage->bodies[m_storageIndex] = m_body;
+
+	localRotation() = m_body->GetAngle() * Comp2D::Utilities::RAD_IN_DEGREES;
+	worldRotation() = localRotation();
 
-	m_localRotation = m_body->GetAngle() * Comp2D::Utilities::RAD_IN_DEGREES;
-	m_worldRotation = m_localRotation;
+	localPosition() = m_body->GetPosition();
+	localScale() = b2Vec2( 1.0f, 1.0f );
+	worldPosition() = localPosition();
+	worldScale() = b2Vec2( 1.0f, 1.0f );
 
-	m_localPosition = m_body->GetPosition();
-	m_localScale = b2Vec2( 1.0f, 1.0f );
-	m_worldPosition = m_localPosition;
-	m_worldScale = b2Vec2( 1.0f, 1.0f );
+	previousWorldRotation() = worldRotation();
+	previousWorldPosition() = worldPosition();
 
 	#ifdef DEBUG
 		SDL_LogDebug
@@ -179,6 +188,7 @@ Comp2D::Components::PhysicsTransformComponent::~PhysicsTransformComponent()
 	#endif
 
 	m_body = nullptr;
+	m_storage->bodies[m_storageIndex] = nullptr;
 
 	#ifdef DEBUG
 		SDL_LogDebug
@@ -192,6 +202,25 @@ Comp2D::Components::PhysicsTransformComponent::~PhysicsTransformComponent()
 	#endif
 }
 
+void Comp2D::Components::PhysicsTransformComponent::savePreviousWorldTransform()
+{
+	#ifdef DEBUG
+		/*
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"PhysicsTransformComponent with ID %u (From GameObject with ID %u named %s) savePreviousWorldTransform\n",
+			m_id,
+			gameObject->getID(),
+			gameObject->getName().c_str()
+		);
+		*/
+	#endif
+
+	previousWorldRotation() = getAngle();
+	previousWorldPosition() = getPosition();
+}
+
 void Comp2D::Components::PhysicsTransformComponent::updateTransform()
 {
 	#ifdef DEBUG
@@ -243,32 +272,32 @@ void Comp2D::Components::PhysicsTransformComponent::updateTransform()
 
 		if( parentGameObjectPhysicsTransform )
 		{
-			parentGameObjectWorldPosition =  parentGameObjectPhysicsTransform->m_worldPosition;
+			parentGameObjectWorldPosition =  parentGameObjectPhysicsTransform->worldPosition();
 
 			updatedLocalPosition = getPosition() - parentGameObjectWorldPosition;
 			if
 			(
-				abs( m_localPosition.x - updatedLocalPosition.x ) > FLT_EPSILON ||
-				abs( m_localPosition.y - updatedLocalPosition.y ) > FLT_EPSILON
+				abs( localPosition().x - updatedLocalPosition.x ) > FLT_EPSILON ||
+				abs( localPosition().y - updatedLocalPosition.y ) > FLT_EPSILON
 			)
 			{
-				m_localPosition = updatedLocalPosition;
+				localPosition() = updatedLocalPosition;
 			}
-			//m_worldPosition = parentGameObjectWorldPosition + m_localPosition;
+			//worldPosition() = parentGameObjectWorldPosition + localPosition();
 
 			updatedLocalPosition = b2Vec2
 			(
-				m_localPosition.x * parentGameObjectPhysicsTransform->m_worldScale.x,
-				m_localPosition.y * parentGameObjectPhysicsTransform->m_worldScale.y
+				localPosition().x * parentGameObjectPhysicsTransform->worldScale().x,
+				localPosition().y * parentGameObjectPhysicsTransform->worldScale().y
 			);
 
-			float32 parentGameObjectWorldRotation = parentGameObjectPhysicsTransform->m_worldRotation;
+			float32 parentGameObjectWorldRotation = parentGameObjectPhysicsTransform->worldRotation();
 			updatedLocalRotation = getAngle() - parentGameObjectWorldRotation;
-			if(	abs( m_localRotation - updatedLocalRotation ) > FLT_EPSILON )
+			if(	abs( localRotation() - updatedLocalRotation ) > FLT_EPSILON )
 			{
-				m_localRotation = updatedLocalRotation;
+				localRotation() = updatedLocalRotation;
 			}
-			m_worldRotation = parentGameObjectWorldRotation + m_localRotation;
+			worldRotation() = parentGameObjectWorldRotation + localRotation();
 
 			float32 parentGameObjectWorldRotationInRadians = parentGameObjectWorldRotation * Comp2D::Utilities::DEGREE_IN_RAD;
 			cosParentGameObjectWorldRotationAngle = static_cast<float>
@@ -287,28 +316,28 @@ void Comp2D::Components::PhysicsTransformComponent::updateTransform()
 			updatedLocalPosition = getPosition() - parentGameObjectWorldPosition;
 			if
 			(
-				abs( m_localPosition.x - updatedLocalPosition.x ) > FLT_EPSILON ||
-				abs( m_localPosition.y - updatedLocalPosition.y ) > FLT_EPSILON
+				abs( localPosition().x - updatedLocalPosition.x ) > FLT_EPSILON ||
+				abs( localPosition().y - updatedLocalPosition.y ) > FLT_EPSILON
 			)
 			{
-				m_localPosition = updatedLocalPosition;
+				localPosition() = updatedLocalPosition;
 			}
-			//m_worldPosition = parentGameObjectWorldPosition + m_localPosition;
+			//worldPosition() = parentGameObjectWorldPosition + localPosition();
 
 			b2Vec2 parentGameObjectWorldScale = parentGameObjectScreenSpaceTransform->getWorldScale();
 			updatedLocalPosition = b2Vec2
 			(
-				m_localPosition.x * parentGameObjectWorldScale.x,
-				m_localPosition.y * parentGameObjectWorldScale.y
+				localPosition().x * parentGameObjectWorldScale.x,
+				localPosition().y * parentGameObjectWorldScale.y
 			);
 
 			float32 parentGameObjectWorldRotation = parentGameObjectScreenSpaceTransform->getWorldRotation();
 			updatedLocalRotation = getAngle() - parentGameObjectWorldRotation;
-			if(	abs( m_localRotation - updatedLocalRotation ) > FLT_EPSILON )
+			if(	abs( localRotation() - updatedLocalRotation ) > FLT_EPSILON )
 			{
-				m_localRotation = updatedLocalRotation;
+				localRotation() = updatedLocalRotation;
 			}
-			m_worldRotation = parentGameObjectWorldRotation + m_localRotation;
+			worldRotation() = parentGameObjectWorldRotation + localRotation();
 
 			float32 parentGameObjectWorldRotationInRadians = parentGameObjectWorldRotation * Comp2D::Utilities::DEGREE_IN_RAD;
 			cosParentGameObjectWorldRotationAngle = static_cast<float>
@@ -333,24 +362,24 @@ void Comp2D::Components::PhysicsTransformComponent::updateTransform()
 		updatedLocalPosition = b2Mul( rotationMatrix, updatedLocalPosition );
 
 		//setTransform( parentGameObjectWorldPosition + updatedLocalPosition, getAngleInRadians() );
-		//setTransform( m_worldPosition, getWorldRotationInRadians() );
+		//setTransform( worldPosition(), getWorldRotationInRadians() );
 
-		m_localPosition = updatedLocalPosition;
-		m_localRotation = updatedLocalRotation;
-		m_worldPosition = parentGameObjectWorldPosition + updatedLocalPosition;
+		localPosition() = updatedLocalPosition;
+		localRotation() = updatedLocalRotation;
+		worldPosition() = parentGameObjectWorldPosition + updatedLocalPosition;
 	}
 	else
 	{
-		m_worldPosition = getPosition();
-		m_worldRotation = getAngle();
+		worldPosition() = getPosition();
+		worldRotation() = getAngle();
 
-		m_localPosition = m_worldPosition;
-		m_localRotation = m_worldRotation;
+		localPosition() = worldPosition();
+		localRotation() = worldRotation();
 
-		//setTransform( m_worldPosition, getWorldRotationInRadians() );
+		//setTransform( worldPosition(), getWorldRotationInRadians() );
 	}
 
-	setTransform( m_worldPosition, getWorldRotationInRadians() );
+	setTransform( worldPosition(), getWorldRotationInRadians() );
 	*/
 
 	if
@@ -372,32 +401,32 @@ void Comp2D::Components::PhysicsTransformComponent::updateTransform()
 		updatedLocalPosition = getPosition() - parentGameObjectWorldPosition;
 		if
 		(
-			abs( m_localPosition.x - updatedLocalPosition.x ) > FLT_EPSILON ||
-			abs( m_localPosition.y - updatedLocalPosition.y ) > FLT_EPSILON
+			abs( localPosition().x - updatedLocalPosition.x ) > FLT_EPSILON ||
+			abs( localPosition().y - updatedLocalPosition.y ) > FLT_EPSILON
 		)
 		{
 			SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "PhysicsTransformComponent with ID %u updateLocalPosition EPSILON\n", m_id );
 
-			m_localPosition = updatedLocalPosition;
+			localPosition() = updatedLocalPosition;
 		}
-		//m_worldPosition = parentGameObjectWorldPosition + m_localPosition;
+		//worldPosition() = parentGameObjectWorldPosition + localPosition();
 
 		b2Vec2 parentGameObjectWorldScale = gameObject->parentGameObject->transform->getWorldScale();
 		updatedLocalPosition = b2Vec2
 		(
-			m_localPosition.x * parentGameObjectWorldScale.x,
-			m_localPosition.y * parentGameObjectWorldScale.y
+			localPosition().x * parentGameObjectWorldScale.x,
+			localPosition().y * parentGameObjectWorldScale.y
 		);
 
 		float32 parentGameObjectWorldRotation = gameObject->parentGameObject->transform->getWorldRotation();
 		updatedLocalRotation = getAngle() - parentGameObjectWorldRotation;
-		if(	abs( m_localRotation - updatedLocalRotation ) > FLT_EPSILON )
+		if(	abs( localRotation() - updatedLocalRotation ) > FLT_EPSILON )
 		{
 			SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "PhysicsTransformComponent with ID %u updateLocalRotation EPSILON\n", m_id );
 
-			m_localRotation = updatedLocalRotation;
+			localRotation() = updatedLocalRotation;
 		}
-		m_worldRotation = parentGameObjectWorldRotation + m_localRotation;
+		worldRotation() = parentGameObjectWorldRotation + localRotation();
 
 		float32 parentGameObjectWorldRotationInRadians = gameObject->parentGameObject->transform->getWorldRotationInRadians();
 		cosParentGameObjectWorldRotationAngle = static_cast<float>
@@ -419,32 +448,32 @@ void Comp2D::Components::PhysicsTransformComponent::updateTransform()
 		updatedLocalPosition = b2Mul( rotationMatrix, updatedLocalPosition );
 
 		//setTransform( parentGameObjectWorldPosition + updatedLocalPosition, getAngleInRadians() );
-		//setTransform( m_worldPosition, getWorldRotationInRadians() );
+		//setTransform( worldPosition(), getWorldRotationInRadians() );
 
-		m_localPosition = updatedLocalPosition;
-		m_localRotation = updatedLocalRotation;
-		m_worldPosition = parentGameObjectWorldPosition + updatedLocalPosition;
+		localPosition() = updatedLocalPosition;
+		localRotation() = updatedLocalRotation;
+		worldPosition() = parentGameObjectWorldPosition + updatedLocalPosition;
 		*/
 
 		// SOLUÇÃO TEMPORÁRIA
-		m_worldPosition = getPosition();
-		m_worldRotation = getAngle();
+		worldPosition() = getPosition();
+		worldRotation() = getAngle();
 
-		m_localPosition = getWorldPosition();
-		m_localRotation = getWorldRotation();
+		localPosition() = getWorldPosition();
+		localRotation() = getWorldRotation();
 	}
 	else
 	{
-		m_worldPosition = getPosition();
-		m_worldRotation = getAngle();
+		worldPosition() = getPosition();
+		worldRotation() = getAngle();
 
-		m_localPosition = getWorldPosition();
-		m_localRotation = getWorldRotation();
+		localPosition() = getWorldPosition();
+		localRotation() = getWorldRotation();
 
-		//setTransform( m_worldPosition, getWorldRotationInRadians() );
+		//setTransform( worldPosition(), getWorldRotationInRadians() );
 	}
 
-	setTransform( m_worldPosition, getWorldRotationInRadians() );
+	setTransform( worldPosition(), getWorldRotationInRadians() );
 }
 
 void Comp2D::Components::PhysicsTransformComponent::debugLogComponentData() const
@@ -470,23 +499,23 @@ void Comp2D::Components::PhysicsTransformComponent::debugLogComponentData() cons
 			SDL_LOG_CATEGORY_TEST,
 			"PhysicsTransformComponent with ID %u m_localPosition = ( %f, %f )\n",
 			m_id,
-			m_localPosition.x,
-			m_localPosition.y
+			localPosition().x,
+			localPosition().y
 		);
 		SDL_LogDebug
 		(
 			SDL_LOG_CATEGORY_TEST,
 			"PhysicsTransformComponent with ID %u m_localRotation = %f degrees\n",
 			m_id,
-			m_localRotation
+			localRotation()
 		);
 		SDL_LogDebug
 		(
 			SDL_LOG_CATEGORY_TEST,
 			"PhysicsTransformComponent with ID %u m_localScale = ( %f, %f )\n",
 			m_id,
-			m_localScale.x,
-			m_localScale.y
+			localScale().x,
+			localScale().y
 		);
 
 		SDL_LogDebug
@@ -494,23 +523,23 @@ void Comp2D::Components::PhysicsTransformComponent::debugLogComponentData() cons
 			SDL_LOG_CATEGORY_TEST,
 			"PhysicsTransformComponent with ID %u m_worldPosition = ( %f, %f )\n",
 			m_id,
-			m_worldPosition.x,
-			m_worldPosition.y
+			worldPosition().x,
+			worldPosition().y
 		);
 		SDL_LogDebug
 		(
 			SDL_LOG_CATEGORY_TEST,
 			"PhysicsTransformComponent with ID %u m_worldRotation = %f degrees\n",
 			m_id,
-			m_worldRotation
+			worldRotation()
 		);
 		SDL_LogDebug
 		(
 			SDL_LOG_CATEGORY_TEST,
 			"PhysicsTransformComponent with ID %u m_worldScale = ( %f, %f )\n",
 			m_id,
-			m_worldScale.x,
-			m_worldScale.y
+			worldScale().x,
+			worldScale().y
 		);
 
 		Comp2D::Utilities::Vector2D<int> screenPosition = getScreenPosition();
@@ -776,7 +805,7 @@ b2Vec2 Comp2D::Components::PhysicsTransformComponent::getPhysicsWorldPosition()
 		*/
 	#endif
 
-	return m_worldPosition;
+	return worldPosition();
 }
 
 Comp2D::Utilities::Vector2D<int> Comp2D::Components::PhysicsTransformComponent::getScreenPosition() const
@@ -795,7 +824,50 @@ Comp2D::Utilities::Vector2D<int> Comp2D::Components::PhysicsTransformComponent::
 	#endif
 
 	//return Comp2D::Components::TransformComponent::getScreenPosition( m_body->GetPosition() );
-	return Comp2D::Components::TransformComponent::getScreenPosition( m_worldPosition );
+	return Comp2D::Components::TransformComponent::getScreenPosition( worldPosition() );
+}
+
+float32 Comp2D::Components::PhysicsTransformComponent::getInterpolatedWorldRotation() const
+{
+	#ifdef DEBUG
+		/*
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"PhysicsTransformComponent with ID %u (From GameObject with ID %u named %s) getInterpolatedWorldRotation\n",
+			m_id,
+			gameObject->getID(),
+			gameObject->getName().c_str()
+		);
+		*/
+	#endif
+
+	float32 interpolationFactor = Comp2D::Game::getTimeManager()->getFixedTimeStepInterpolationFactor();
+
+	return previousWorldRotation() + ( getAngle() - previousWorldRotation() ) * interpolationFactor;
+}
+
+Comp2D::Utilities::Vector2D<int> Comp2D::Components::PhysicsTransformComponent::getInterpolatedScreenPosition() const
+{
+	#ifdef DEBUG
+		/*
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"PhysicsTransformComponent with ID %u (From GameObject with ID %u named %s) getInterpolatedScreenPosition\n",
+			m_id,
+			gameObject->getID(),
+			gameObject->getName().c_str()
+		);
+		*/
+	#endif
+
+	float32 interpolationFactor = Comp2D::Game::getTimeManager()->getFixedTimeStepInterpolationFactor();
+
+	return Comp2D::Components::TransformComponent::getScreenPosition
+	(
+		previousWorldPosition() + interpolationFactor * ( getPosition() - previousWorldPosition() )
+	);
 }
 
 void Comp2D::Components::PhysicsTransformComponent::applyAngularImpulse( float32 impulse, bool wake )
@@ -918,6 +990,30 @@ void Comp2D::Components::PhysicsTransformComponent::applyTorque( float32 torque,
 	m_body->ApplyTorque( torque, wake );
 }
 
+void Comp2D::Components::PhysicsTransformComponent::destroyBody()
+{
+	#ifdef DEBUG
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"PhysicsTransformComponent with ID %u (From GameObject with ID %u named %s) destroyBody\n",
+			m_id,
+			gameObject->getID(),
+			gameObject->getName().c_str()
+		);
+	#endif
+
+	if( m_body == nullptr )
+	{
+		return;
+	}
+
+	m_body->GetWorld()->DestroyBody( m_body );
+
+	m_body = nullptr;
+	m_storage->bodies[m_storageIndex] = nullptr;
+}
+
 void Comp2D::Components::PhysicsTransformComponent::destroyFixture( b2Fixture* fixture )
 {
 	#ifdef DEBUG
@@ -1226,7 +1322,8 @@ void Comp2D::Components::PhysicsTransformComponent::setLocalPosition( b2Vec2 pos
 		*/
 	#endif
 
-	m_localPosition = position;
+	localPosition() = position;
+	markDirty();
 
 	if
 	(
@@ -1234,16 +1331,16 @@ void Comp2D::Components::PhysicsTransformComponent::setLocalPosition( b2Vec2 pos
 		gameObject->parentGameObject->transform != nullptr
 	)
 	{
-		m_worldPosition = gameObject->parentGameObject->transform->getPhysicsWorldPosition() + m_localPosition;
+		worldPosition() = gameObject->parentGameObject->transform->getPhysicsWorldPosition() + localPosition();
 	}
 	else
 	{
-		m_worldPosition = m_localPosition;
+		worldPosition() = localPosition();
 	}
 
-	m_worldRotation = getAngle();
+	worldRotation() = getAngle();
 
-	setTransform( m_worldPosition, getWorldRotationInRadians() );
+	setTransform( worldPosition(), getWorldRotationInRadians() );
 
 	//updateWorldPosition();
 }
@@ -1284,6 +1381,7 @@ void Comp2D::Components::PhysicsTransformComponent::setTransform( const b2Vec2&
 	#endif
 
 	m_body->SetTransform( position, angle );
+	markDirty();
 }
 
 void Comp2D::Components::PhysicsTransformComponent::setType( b2BodyType type )
@@ -187,7 +187,7 @@ void Comp2D::Components::PhysicsTransformComponentFixturesShapesRenderer::drawCi
 		}
 	}
 
-	SDL_RenderDrawPoints( Comp2D::Game::renderer, &pointsVector[0], static_cast<int>( pointsVector.size() ) );
+	Comp2D::Game::renderPipeline->drawPoints( &pointsVector[0], static_cast<int>( pointsVector.size() ) );
 }
 
 void Comp2D::Components::PhysicsTransformComponentFixturesShapesRenderer::drawEdgeShape( b2Shape* shape )
@@ -217,9 +217,8 @@ void Comp2D::Components::PhysicsTransformComponentFixturesShapesRenderer::drawEd
 		physicsTransformComponent->getWorldPoint( edgeShape->m_vertex2 )
 	);
 
-	SDL_RenderDrawLine
+	Comp2D::Game::renderPipeline->drawLine
 	(
-		Comp2D::Game::renderer,
 		edgeVertex1ScreenPosition.x,
 		edgeVertex1ScreenPosition.y,
 		edgeVertex2ScreenPosition.x,
@@ -303,7 +302,7 @@ void Comp2D::Components::PhysicsTransformComponentFixturesShapesRenderer::drawPo
 	);
 	vertexPoints[vertexCount] = SDL_Point{ currentPointScreenPosition.x, currentPointScreenPosition.y };
 
-	SDL_RenderDrawLines( Comp2D::Game::renderer, vertexPoints, vertexCount + 1 );
+	Comp2D::Game::renderPipeline->drawLines( vertexPoints, vertexCount + 1 );
 
 	delete[] vertexPoints;
 }
@@ -485,7 +484,7 @@ void Comp2D::Components::PhysicsTransformComponentFixturesShapesRenderer::render
 		*/
 	#endif
 
-    SDL_SetRenderDrawColor( Comp2D::Game::renderer, 255, 255, 0, SDL_ALPHA_OPAQUE );
+    Comp2D::Game::renderPipeline->setDrawColor( 255, 255, 0, SDL_ALPHA_OPAQUE );
 
     if( physicsTransformComponent )
     {
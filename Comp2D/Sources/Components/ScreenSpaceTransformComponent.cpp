@@ -26,6 +26,8 @@
 
 #include "Comp2D/Headers/Components/ScreenSpaceTransformComponent.h"
 
+#include <cmath>
+
 #include <SDL.h>
 
 #include "Box2D/Common/b2Math.h"
@@ -102,6 +104,48 @@ Comp2D::Components::ScreenSpaceTransformComponent::~ScreenSpaceTransformComponen
 	#endif
 }
 
+b2Vec2 Comp2D::Components::ScreenSpaceTransformComponent::getWorldPositionUnderParent
+(
+	const Comp2D::Utilities::Vector2D<int>& parentScreenPosition,
+	float32 parentWorldRotationCosine,
+	float32 parentWorldRotationSine
+) const
+{
+	#ifdef DEBUG
+		/*
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"ScreenSpaceTransformComponent with ID %u (From GameObject with ID %u named %s) getWorldPositionUnderParent\n",
+			m_id,
+			gameObject->getID(),
+			gameObject->getName().c_str()
+		);
+		*/
+	#endif
+
+	b2Vec2 parentGameObjectWorldScale = gameObject->parentGameObject->transform->getWorldScale();
+
+	b2Vec2 newLocalPosition = b2Vec2
+	(
+		localPosition().x * parentGameObjectWorldScale.x,
+		localPosition().y * parentGameObjectWorldScale.y
+	);
+
+	b2Vec2 parentGameObjectWorldPosition = b2Vec2( static_cast<float32>( parentScreenPosition.x ), static_cast<float32>( parentScreenPosition.y ) );
+
+	b2Mat22 inverseRotationMatrix = b2Mat22
+	(
+		parentWorldRotationCosine,
+		parentWorldRotationSine,
+		-parentWorldRotationSine,
+		parentWorldRotationCosine
+	);
+	newLocalPosition = b2Mul( inverseRotationMatrix, newLocalPosition );
+
+	return parentGameObjectWorldPosition + newLocalPosition;
+}
+
 void Comp2D::Components::ScreenSpaceTransformComponent::updateTransform()
 {
 	#ifdef DEBUG
@@ -123,53 +167,25 @@ void Comp2D::Components::ScreenSpaceTransformComponent::updateTransform()
 		gameObject->parentGameObject->transform != nullptr
 	)
 	{
-		float32 cosWorldRotationAngle = 0.0f;
-		float32 sinWorldRotationAngle = 0.0f;
-
-		b2Vec2 newLocalPosition;
-		b2Vec2 parentGameObjectWorldPosition;
-
-		m_worldRotation = gameObject->parentGameObject->transform->getWorldRotation() + m_localRotation;
+		worldRotation() = gameObject->parentGameObject->transform->getWorldRotation() + localRotation();
 
 		b2Vec2 parentGameObjectWorldScale = gameObject->parentGameObject->transform->getWorldScale();
-		m_worldScale.x = parentGameObjectWorldScale.x * m_localScale.x;
-		m_worldScale.y = parentGameObjectWorldScale.y * m_localScale.y;
+		worldScale().x = parentGameObjectWorldScale.x * localScale().x;
+		worldScale().y = parentGameObjectWorldScale.y * localScale().y;
 
-		newLocalPosition = b2Vec2
+		// Cached when the parent world rotation was computed
+		worldPosition() = getWorldPositionUnderParent
 		(
-			m_localPosition.x * parentGameObjectWorldScale.x,
-			m_localPosition.y * parentGameObjectWorldScale.y
+			gameObject->parentGameObject->transform->getScreenPosition(),
+			gameObject->parentGameObject->transform->getWorldRotationCosine(),
+			gameObject->parentGameObject->transform->getWorldRotationSine()
 		);
-
-		Comp2D::Utilities::Vector2D<int> parentGameObjectScreenPos = gameObject->parentGameObject->transform->getScreenPosition();
-		parentGameObjectWorldPosition = b2Vec2( static_cast<float32>( parentGameObjectScreenPos.x ), static_cast<float32>( parentGameObjectScreenPos.y ) );
-
-		float32 parentGameObjectWorldRotationInRadians = gameObject->parentGameObject->transform->getWorldRotationInRadians();
-		cosWorldRotationAngle = static_cast<float32>
-		(
-			cos( parentGameObjectWorldRotationInRadians )
-		);
-		sinWorldRotationAngle = static_cast<float32>
-		(
-			sin( parentGameObjectWorldRotationInRadians )
-		);
-
-		b2Mat22 inverseRotationMatrix = b2Mat22
-		(
-			cosWorldRotationAngle,
-			sinWorldRotationAngle,
-			-sinWorldRotationAngle,
-			cosWorldRotationAngle
-		);
-		newLocalPosition = b2Mul( inverseRotationMatrix, newLocalPosition );
-
-		m_worldPosition = parentGameObjectWorldPosition + newLocalPosition;
 	}
 	else
 	{
-		m_worldPosition = m_localPosition;
-		m_worldRotation = m_localRotation;
-		m_worldScale = m_localScale;
+		worldPosition() = localPosition();
+		worldRotation() = localRotation();
+		worldScale() = localScale();
 	}
 }
 
@@ -196,23 +212,23 @@ void Comp2D::Components::ScreenSpaceTransformComponent::debugLogComponentData()
 			SDL_LOG_CATEGORY_TEST,
 			"ScreenSpaceTransformComponent with ID %u m_localPosition = ( %f, %f )\n",
 			m_id,
-			m_localPosition.x,
-			m_localPosition.y
+			localPosition().x,
+			localPosition().y
 		);
 		SDL_LogDebug
 		(
 			SDL_LOG_CATEGORY_TEST,
 			"ScreenSpaceTransformComponent with ID %u m_localRotation = %f degrees\n",
 			m_id,
-			m_localRotation
+			localRotation()
 		);
 		SDL_LogDebug
 		(
 			SDL_LOG_CATEGORY_TEST,
 			"ScreenSpaceTransformComponent with ID %u m_localScale = ( %f, %f )\n",
 			m_id,
-			m_localScale.x,
-			m_localScale.y
+			localScale().x,
+			localScale().y
 		);
 
 		SDL_LogDebug
@@ -220,23 +236,23 @@ void Comp2D::Components::ScreenSpaceTransformComponent::debugLogComponentData()
 			SDL_LOG_CATEGORY_TEST,
 			"ScreenSpaceTransformComponent with ID %u m_worldPosition = ( %f, %f )\n",
 			m_id,
-			m_worldPosition.x,
-			m_worldPosition.y
+			worldPosition().x,
+			worldPosition().y
 		);
 		SDL_LogDebug
 		(
 			SDL_LOG_CATEGORY_TEST,
 			"ScreenSpaceTransformComponent with ID %u m_worldRotation = %f degrees\n",
 			m_id,
-			m_worldRotation
+			worldRotation()
 		);
 		SDL_LogDebug
 		(
 			SDL_LOG_CATEGORY_TEST,
 			"ScreenSpaceTransformComponent with ID %u m_worldScale = ( %f, %f )\n",
 			m_id,
-			m_worldScale.x,
-			m_worldScale.y
+			worldScale().x,
+			worldScale().y
 		);
 
 		Comp2D::Utilities::Vector2D<int> screenPosition = getScreenPosition();
@@ -412,7 +428,7 @@ b2Vec2 Comp2D::Components::ScreenSpaceTransformComponent::getPhysicsWorldPositio
 		*/
 	#endif
 
-	return Comp2D::Components::TransformComponent::getPhysicsWorldPosition( m_worldPosition );
+	return Comp2D::Components::TransformComponent::getPhysicsWorldPosition( worldPosition() );
 }
 
 Comp2D::Utilities::Vector2D<int> Comp2D::Components::ScreenSpaceTransformComponent::getScreenPosition() const
@@ -430,8 +446,74 @@ Comp2D::Utilities::Vector2D<int> Comp2D::Components::ScreenSpaceTransformCompone
 		*/
 	#endif
 
-	int screenX = static_cast<int>( round( m_worldPosition.x - Comp2D::Game::getCameraPositionX() ) );
-	int screenY = static_cast<int>( round( m_worldPosition.y - Comp2D::Game::getCameraPositionY() ) );
+	int screenX = static_cast<int>( round( worldPosition().x - Comp2D::Game::getCameraPositionX() ) );
+	int screenY = static_cast<int>( round( worldPosition().y - Comp2D::Game::getCameraPositionY() ) );
+
+	return Comp2D::Utilities::Vector2D<int>( screenX, screenY );
+}
+
+float32 Comp2D::Components::ScreenSpaceTransformComponent::getInterpolatedWorldRotation() const
+{
+	#ifdef DEBUG
+		/*
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"ScreenSpaceTransformComponent with ID %u (From GameObject with ID %u named %s) getInterpolatedWorldRotation\n",
+			m_id,
+			gameObject->getID(),
+			gameObject->getName().c_str()
+		);
+		*/
+	#endif
+
+	if
+	(
+		gameObject->parentGameObject != nullptr &&
+		gameObject->parentGameObject->transform != nullptr
+	)
+	{
+		return gameObject->parentGameObject->transform->getInterpolatedWorldRotation() + localRotation();
+	}
+
+	return worldRotation();
+}
+
+Comp2D::Utilities::Vector2D<int> Comp2D::Components::ScreenSpaceTransformComponent::getInterpolatedScreenPosition() const
+{
+	#ifdef DEBUG
+		/*
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"ScreenSpaceTransformComponent with ID %u (From GameObject with ID %u named %s) getInterpolatedScreenPosition\n",
+			m_id,
+			gameObject->getID(),
+			gameObject->getName().c_str()
+		);
+		*/
+	#endif
+
+	if
+	(
+		gameObject->parentGameObject == nullptr ||
+		gameObject->parentGameObject->transform == nullptr
+	)
+	{
+		return getScreenPosition();
+	}
+
+	float32 parentWorldRotationInRadians = gameObject->parentGameObject->transform->getInterpolatedWorldRotation() * Comp2D::Utilities::DEGREE_IN_RAD;
+
+	b2Vec2 interpolatedWorldPosition = getWorldPositionUnderParent
+	(
+		gameObject->parentGameObject->transform->getInterpolatedScreenPosition(),
+		static_cast<float32>( cos( parentWorldRotationInRadians ) ),
+		static_cast<float32>( sin( parentWorldRotationInRadians ) )
+	);
+
+	int screenX = static_cast<int>( round( interpolatedWorldPosition.x - Comp2D::Game::getCameraPositionX() ) );
+	int screenY = static_cast<int>( round( interpolatedWorldPosition.y - Comp2D::Game::getCameraPositionY() ) );
 
 	return Comp2D::Utilities::Vector2D<int>( screenX, screenY );
 }
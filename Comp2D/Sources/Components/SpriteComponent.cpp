@@ -323,9 +323,9 @@ void Comp2D::Components::SpriteComponent::render()
 
 	if( gameObject->transform )
 	{
-		spriteScreenPosition = gameObject->transform->getScreenPosition();
+		spriteScreenPosition = gameObject->transform->getInterpolatedScreenPosition();
 
-		spriteAngle = -static_cast<float64>( gameObject->transform->getWorldRotation() );
+		spriteAngle = -static_cast<float64>( gameObject->transform->getInterpolatedWorldRotation() );
 
 		b2Vec2 gameObjectWorldScale = gameObject->transform->getWorldScale();
 
@@ -339,9 +339,8 @@ void Comp2D::Components::SpriteComponent::render()
 	spriteScreenRect.x = spriteScreenPosition.x - pivot.x;
 	spriteScreenRect.y = spriteScreenPosition.y - pivot.y;
 
-	SDL_RenderCopyEx
+	Comp2D::Game::renderPipeline->copyTexture
 	(
-		Comp2D::Game::renderer,
 		m_texture,
 		&m_spriteRect,
 		&spriteScreenRect,
@@ -92,7 +92,12 @@ Comp2D::Components::TextComponent::~TextComponent()
 		);
 	#endif
 
-	SDL_DestroyTexture( m_renderedTextTexture );
+	// Headless games have no render pipeline, nor textures
+	if( Comp2D::Game::renderPipeline )
+	{
+		Comp2D::Game::renderPipeline->destroyTexture( m_renderedTextTexture );
+	}
+
 	m_renderedTextTexture = nullptr;
 
 	SDL_FreeSurface( m_renderedTextSurface );
@@ -127,9 +132,16 @@ void Comp2D::Components::TextComponent::renderTextTexture()
 
 	if( m_renderedTextTexture )
 	{
-		SDL_DestroyTexture( m_renderedTextTexture );
+		if( Comp2D::Game::renderPipeline )
+		{
+			Comp2D::Game::renderPipeline->destroyTexture( m_renderedTextTexture );
+		}
+
 		m_renderedTextTexture = nullptr;
+	}
 
+	if( m_renderedTextSurface )
+	{
 		SDL_FreeSurface( m_renderedTextSurface );
 		m_renderedTextSurface = nullptr;
 	}
@@ -149,8 +161,6 @@ void Comp2D::Components::TextComponent::renderTextTexture()
 			m_renderedTextRect.y = 0;
 			m_renderedTextRect.w = m_renderedTextSurface->w;
 			m_renderedTextRect.h = m_renderedTextSurface->h;
-
-			m_renderedTextTexture = SDL_CreateTextureFromSurface( Comp2D::Game::renderer, m_renderedTextSurface );
 		}
 	}
 }
@@ -360,6 +370,13 @@ void Comp2D::Components::TextComponent::render()
 		*/
 	#endif
 
+	// The texture is created here rather than when the text changes, since
+	// render always runs on the thread that owns the renderer
+	if( m_renderedTextSurface && m_renderedTextTexture == nullptr )
+	{
+		m_renderedTextTexture = SDL_CreateTextureFromSurface( Comp2D::Game::renderer, m_renderedTextSurface );
+	}
+
 	if( m_renderedTextTexture )
 	{
 		float64 textAngle;
@@ -370,21 +387,20 @@ void Comp2D::Components::TextComponent::render()
 
 		if( gameObject->transform )
 		{
-			textScreenPosition = gameObject->transform->getScreenPosition() + m_screenPositionOffset;
+			textScreenPosition = gameObject->transform->getInterpolatedScreenPosition() + m_screenPositionOffset;
 
 			b2Vec2 gameObjectWorldScale = gameObject->transform->getWorldScale();
 			textScreenRect.w = static_cast<int>( round( m_renderedTextSurface->w * gameObjectWorldScale.x ) );
 			textScreenRect.h = static_cast<int>( round( m_renderedTextSurface->h * gameObjectWorldScale.y ) );
 
-			textAngle = -static_cast<float64>( gameObject->transform->getWorldRotation() );
+			textAngle = -static_cast<float64>( gameObject->transform->getInterpolatedWorldRotation() );
 		}
 
 		textScreenRect.x = textScreenPosition.x;
 		textScreenRect.y = textScreenPosition.y;
 
-		SDL_RenderCopyEx
+		Comp2D::Game::renderPipeline->copyTexture
 		(
-			Comp2D::Game::renderer,
 			m_renderedTextTexture,
 			&m_renderedTextRect,
 			&textScreenRect,
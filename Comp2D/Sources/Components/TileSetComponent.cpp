@@ -334,9 +334,8 @@ void Comp2D::Components::TileSetComponent::renderTile
 	m_tileScreenRect.w = tileScaledSize;
 	m_tileScreenRect.h = tileScaledSize;
 
-	SDL_RenderCopy
+	Comp2D::Game::renderPipeline->copyTexture
 	(
-		Comp2D::Game::renderer,
 		m_texture,
 		&m_tileRect,
 		&m_tileScreenRect
@@ -330,14 +330,14 @@ void Comp2D::Components::TimelinesControllerComponent::setPausable( bool pausabl
 	}
 }
 
-void Comp2D::Components::TimelinesControllerComponent::update( Uint32 currentTime )
+void Comp2D::Components::TimelinesControllerComponent::update( Uint64 currentTime )
 {
 	#ifdef DEBUG
 		/*
 		SDL_LogDebug
 		(
 			SDL_LOG_CATEGORY_TEST,
-			"TimelinesControllerComponent with ID %u (From GameObject with ID %u named %s) update: currentTime = %u\n",
+			"TimelinesControllerComponent with ID %u (From GameObject with ID %u named %s) update: currentTime = %" SDL_PRIu64 "\n",
 			m_id,
 			gameObject->getID(),
 			gameObject->getName().c_str(),
@@ -35,6 +35,7 @@
 
 #include "Comp2D/Headers/Game.h"
 #include "Comp2D/Headers/Components/Component.h"
+#include "Comp2D/Headers/Components/TransformComponentsStorage.h"
 #include "Comp2D/Headers/Objects/GameObject.h"
 #include "Comp2D/Headers/Settings/GameSettings.h"
 #include "Comp2D/Headers/Settings/GraphicsSettings.h"
@@ -52,12 +53,9 @@ Comp2D::Components::TransformComponent::TransformComponent
 )
 	:
 	Component( id, gameObject ),
-	m_localRotation( localRotation ),
-	m_worldRotation( localRotation ),
-	m_localPosition( localPosition ),
-	m_localScale( localScale ),
-	m_worldPosition( localPosition ),
-	m_worldScale( localScale )
+	m_ownsStorage( false ),
+	m_storageIndex( 0 ),
+	m_storage( nullptr )
 {
 	#ifdef DEBUG
 		SDL_LogDebug
@@ -70,6 +68,19 @@ Comp2D::Components::TransformComponent::TransformComponent
 		);
 	#endif
 
+	if( gameObject->gameState != nullptr )
+	{
+		m_storage = gameObject->gameState->getTransformComponentsStorage();
+	}
+
+	if( m_storage == nullptr )
+	{
+		m_ownsStorage = true;
+		m_storage = new Comp2D::Components::TransformComponentsStorage();
+	}
+
+	m_storageIndex = m_storage->add( this, localPosition, localRotation, localScale );
+
 	#ifdef DEBUG
 		SDL_LogDebug
 		(
@@ -95,6 +106,15 @@ Comp2D::Components::TransformComponent::~TransformComponent()
 		);
 	#endif
 
+	m_storage->remove( m_storageIndex );
+
+	if( m_ownsStorage )
+	{
+		delete m_storage;
+	}
+
+	m_storage = nullptr;
+
 	#ifdef DEBUG
 		SDL_LogDebug
 		(
@@ -107,6 +127,30 @@ Comp2D::Components::TransformComponent::~TransformComponent()
 	#endif
 }
 
+void Comp2D::Components::TransformComponent::refreshTransform()
+{
+	#ifdef DEBUG
+		/*
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"TransformComponent with ID %u (From GameObject with ID %u named %s) refreshTransform\n",
+			m_id,
+			gameObject->getID(),
+			gameObject->getName().c_str()
+		);
+		*/
+	#endif
+
+	updateTransform();
+
+	float32 worldRotationInRadians = worldRotation() * Comp2D::Utilities::DEGREE_IN_RAD;
+
+	m_storage->worldRotationsCosines[m_storageIndex] = static_cast<float32>( cos( worldRotationInRadians ) );
+	m_storage->worldRotationsSines[m_storageIndex] = static_cast<float32>( sin( worldRotationInRadians ) );
+	m_storage->dirtyFlags[m_storageIndex] = 0;
+}
+
 b2Vec2 Comp2D::Components::TransformComponent::getPhysicsWorldPosition( const b2Vec2& screenPosition )
 {
 	#ifdef DEBUG
@@ -159,6 +203,42 @@ Comp2D::Utilities::Vector2D<int> Comp2D::Components::TransformComponent::getScre
 	return Comp2D::Utilities::Vector2D<int>( screenX, screenY );
 }
 
+float32 Comp2D::Components::TransformComponent::getInterpolatedWorldRotation() const
+{
+	#ifdef DEBUG
+		/*
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"TransformComponent with ID %u (From GameObject with ID %u named %s) getInterpolatedWorldRotation\n",
+			m_id,
+			gameObject->getID(),
+			gameObject->getName().c_str()
+		);
+		*/
+	#endif
+
+	return getWorldRotation();
+}
+
+Comp2D::Utilities::Vector2D<int> Comp2D::Components::TransformComponent::getInterpolatedScreenPosition() const
+{
+	#ifdef DEBUG
+		/*
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"TransformComponent with ID %u (From GameObject with ID %u named %s) getInterpolatedScreenPosition\n",
+			m_id,
+			gameObject->getID(),
+			gameObject->getName().c_str()
+		);
+		*/
+	#endif
+
+	return getScreenPosition();
+}
+
 void Comp2D::Components::TransformComponent::setLocalPosition( b2Vec2 position )
 {
 	#ifdef DEBUG
@@ -176,7 +256,8 @@ void Comp2D::Components::TransformComponent::setLocalPosition( b2Vec2 position )
 		*/
 	#endif
 
-	m_localPosition = position;
+	localPosition() = position;
+	markDirty();
 	//updateWorldPosition();
 }
 
@@ -196,7 +277,8 @@ void Comp2D::Components::TransformComponent::setLocalRotation( float32 rotation
 		*/
 	#endif
 
-	m_localRotation = rotation /*% 360*/;
+	localRotation() = rotation /*% 360*/;
+	markDirty();
 	//updateWorldRotation();
 }
 
@@ -217,7 +299,8 @@ void Comp2D::Components::TransformComponent::setLocalScale( b2Vec2 scale )
 		*/
 	#endif
 
-	m_localScale = scale;
+	localScale() = scale;
+	markDirty();
 	//updateWorldScale();
 }
 
@@ -238,7 +321,8 @@ void Comp2D::Components::TransformComponent::setWorldPosition( b2Vec2 position )
 		*/
 	#endif
 
-	m_worldPosition = position;
+	worldPosition() = position;
+	markDirty();
 	//updateLocalPosition();
 }
 
@@ -258,7 +342,8 @@ void Comp2D::Components::TransformComponent::setWorldRotation( float32 rotation
 		*/
 	#endif
 
-	m_worldRotation = rotation;
+	worldRotation() = rotation;
+	markDirty();
 	//updateLocalRotation();
 }
 
@@ -279,10 +364,29 @@ void Comp2D::Components::TransformComponent::setWorldScale( b2Vec2 scale )
 		*/
 	#endif
 
-	m_worldScale = scale;
+	worldScale() = scale;
+	markDirty();
 	//updateLocalScale();
 }
 
+void Comp2D::Components::TransformComponent::markDirty()
+{
+	#ifdef DEBUG
+		/*
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"TransformComponent with ID %u (From GameObject with ID %u named %s) markDirty\n",
+			m_id,
+			gameObject->getID(),
+			gameObject->getName().c_str()
+		);
+		*/
+	#endif
+
+	m_storage->dirtyFlags[m_storageIndex] = 1;
+}
+
 void Comp2D::Components::TransformComponent::rotate( float32 rotation )
 {
 	#ifdef DEBUG
@@ -299,7 +403,7 @@ void Comp2D::Components::TransformComponent::rotate( float32 rotation )
 		*/
 	#endif
 
-	setLocalRotation( m_localRotation + rotation );
+	setLocalRotation( localRotation() + rotation );
 
 	gameObject->onRotated( rotation );
 }
@@ -401,7 +505,7 @@ void Comp2D::Components::TransformComponent::translate( b2Vec2 translation )
 		*/
 	#endif
 
-	setLocalPosition( m_localPosition + translation );
+	setLocalPosition( localPosition() + translation );
 
 	gameObject->onTranslated( translation );
 }
@@ -426,6 +530,24 @@ void Comp2D::Components::TransformComponent::translate( float32 x, float32 y )
 	translate( b2Vec2( x, y ) );
 }
 
+bool Comp2D::Components::TransformComponent::isDirty() const
+{
+	#ifdef DEBUG
+		/*
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"TransformComponent with ID %u (From GameObject with ID %u named %s) isDirty\n",
+			m_id,
+			gameObject->getID(),
+			gameObject->getName().c_str()
+		);
+		*/
+	#endif
+
+	return m_storage->dirtyFlags[m_storageIndex] != 0;
+}
+
 float32 Comp2D::Components::TransformComponent::getLocalRotation() const
 {
 	#ifdef DEBUG
@@ -441,7 +563,7 @@ float32 Comp2D::Components::TransformComponent::getLocalRotation() const
 		*/
 	#endif
 
-	return m_localRotation;
+	return localRotation();
 }
 
 float32 Comp2D::Components::TransformComponent::getLocalRotationInRadians() const
@@ -495,7 +617,7 @@ float32 Comp2D::Components::TransformComponent::getWorldRotation() const
 		*/
 	#endif
 
-	return m_worldRotation;
+	return worldRotation();
 }
 
 float32 Comp2D::Components::TransformComponent::getWorldRotationInRadians() const
@@ -516,6 +638,42 @@ float32 Comp2D::Components::TransformComponent::getWorldRotationInRadians() cons
 	return getWorldRotation() * Comp2D::Utilities::DEGREE_IN_RAD;
 }
 
+float32 Comp2D::Components::TransformComponent::getWorldRotationCosine() const
+{
+	#ifdef DEBUG
+		/*
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"TransformComponent with ID %u (From GameObject with ID %u named %s) getWorldRotationCosine\n",
+			m_id,
+			gameObject->getID(),
+			gameObject->getName().c_str()
+		);
+		*/
+	#endif
+
+	return m_storage->worldRotationsCosines[m_storageIndex];
+}
+
+float32 Comp2D::Components::TransformComponent::getWorldRotationSine() const
+{
+	#ifdef DEBUG
+		/*
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"TransformComponent with ID %u (From GameObject with ID %u named %s) getWorldRotationSine\n",
+			m_id,
+			gameObject->getID(),
+			gameObject->getName().c_str()
+		);
+		*/
+	#endif
+
+	return m_storage->worldRotationsSines[m_storageIndex];
+}
+
 /*
 float32 Comp2D::Components::TransformComponent::getWorldRotationUpTo360() const
 {
@@ -549,7 +707,7 @@ b2Vec2 Comp2D::Components::TransformComponent::getLocalPosition() const
 		*/
 	#endif
 
-	return m_localPosition;
+	return localPosition();
 }
 
 b2Vec2 Comp2D::Components::TransformComponent::getLocalScale() const
@@ -567,7 +725,7 @@ b2Vec2 Comp2D::Components::TransformComponent::getLocalScale() const
 		*/
 	#endif
 
-	return m_localScale;
+	return localScale();
 }
 
 b2Vec2 Comp2D::Components::TransformComponent::getWorldPosition() const
@@ -585,7 +743,7 @@ b2Vec2 Comp2D::Components::TransformComponent::getWorldPosition() const
 		*/
 	#endif
 
-	return m_worldPosition;
+	return worldPosition();
 }
 
 b2Vec2 Comp2D::Components::TransformComponent::getWorldScale() const
@@ -603,5 +761,5 @@ b2Vec2 Comp2D::Components::TransformComponent::getWorldScale() const
 		*/
 	#endif
 
-	return m_worldScale;
+	return worldScale();
 }
@@ -0,0 +1,227 @@
+/* TransformComponentsStorage.cpp -- 'Comp2D' Game Engine 'TransformComponentsStorage' class source file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#include "Comp2D/Headers/Components/TransformComponentsStorage.h"
+
+#include <cmath>
+#include <vector>
+
+#include <SDL.h>
+
+#include "Box2D/Common/b2Math.h"
+#include "Box2D/Common/b2Settings.h"
+#include "Box2D/Dynamics/b2Body.h"
+
+#include "Comp2D/Headers/Components/TransformComponent.h"
+#include "Comp2D/Headers/Utilities/Math.h"
+
+Comp2D::Components::TransformComponentsStorage::TransformComponentsStorage()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TransformComponentsStorage Constructor body Start\n" );
+	#endif
+
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TransformComponentsStorage Constructor body End\n" );
+	#endif
+}
+
+Comp2D::Components::TransformComponentsStorage::~TransformComponentsStorage()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TransformComponentsStorage Destroying\n" );
+	#endif
+
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TransformComponentsStorage Destroyed\n" );
+	#endif
+}
+
+void Comp2D::Components::TransformComponentsStorage::markAwakeBodiesDirty()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TransformComponentsStorage markAwakeBodiesDirty\n" );
+	#endif
+
+	Uint32 count = getCount();
+
+	for
+	(
+		Uint32 index = 0;
+		index < count;
+		++index
+	)
+	{
+		if
+		(
+			bodies[index] != nullptr &&
+			bodies[index]->GetType() != b2_staticBody &&
+			bodies[index]->IsAwake()
+		)
+		{
+			dirtyFlags[index] = 1;
+		}
+	}
+}
+
+void Comp2D::Components::TransformComponentsStorage::remove( Uint32 index )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TransformComponentsStorage remove: index = %u\n", index );
+	#endif
+
+	Uint32 lastIndex = getCount() - 1;
+
+	if( index != lastIndex )
+	{
+		localRotations[index] = localRotations[lastIndex];
+		previousWorldRotations[index] = previousWorldRotations[lastIndex];
+		worldRotations[index] = worldRotations[lastIndex];
+		worldRotationsCosines[index] = worldRotationsCosines[lastIndex];
+		worldRotationsSines[index] = worldRotationsSines[lastIndex];
+
+		dirtyFlags[index] = dirtyFlags[lastIndex];
+
+		localPositions[index] = localPositions[lastIndex];
+		localScales[index] = localScales[lastIndex];
+		previousWorldPositions[index] = previousWorldPositions[lastIndex];
+		worldPositions[index] = worldPositions[lastIndex];
+		worldScales[index] = worldScales[lastIndex];
+
+		bodies[index] = bodies[lastIndex];
+
+		transformComponents[index] = transformComponents[lastIndex];
+		transformComponents[index]->m_storageIndex = index;
+	}
+
+	localRotations.pop_back();
+	previousWorldRotations.pop_back();
+	worldRotations.pop_back();
+	worldRotationsCosines.pop_back();
+	worldRotationsSines.pop_back();
+
+	dirtyFlags.pop_back();
+
+	localPositions.pop_back();
+	localScales.pop_back();
+	previousWorldPositions.pop_back();
+	worldPositions.pop_back();
+	worldScales.pop_back();
+
+	bodies.pop_back();
+
+	transformComponents.pop_back();
+}
+
+void Comp2D::Components::TransformComponentsStorage::reserve( Uint32 count )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TransformComponentsStorage reserve: count = %u\n", count );
+	#endif
+
+	localRotations.reserve( count );
+	previousWorldRotations.reserve( count );
+	worldRotations.reserve( count );
+	worldRotationsCosines.reserve( count );
+	worldRotationsSines.reserve( count );
+
+	dirtyFlags.reserve( count );
+
+	localPositions.reserve( count );
+	localScales.reserve( count );
+	previousWorldPositions.reserve( count );
+	worldPositions.reserve( count );
+	worldScales.reserve( count );
+
+	bodies.reserve( count );
+
+	transformComponents.reserve( count );
+}
+
+void Comp2D::Components::TransformComponentsStorage::savePreviousWorldTransforms()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TransformComponentsStorage savePreviousWorldTransforms\n" );
+	#endif
+
+	Uint32 count = getCount();
+
+	for
+	(
+		Uint32 index = 0;
+		index < count;
+		++index
+	)
+	{
+		if( bodies[index] != nullptr )
+		{
+			previousWorldRotations[index] = Comp2D::Utilities::RAD_IN_DEGREES * bodies[index]->GetAngle();
+			previousWorldPositions[index] = bodies[index]->GetPosition();
+		}
+	}
+}
+
+Uint32 Comp2D::Components::TransformComponentsStorage::add
+(
+	Comp2D::Components::TransformComponent* transformComponent,
+	b2Vec2 localPosition,
+	float32 localRotation,
+	b2Vec2 localScale
+)
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TransformComponentsStorage add: transformComponent with ID %u\n", transformComponent->getID() );
+	#endif
+
+	localRotations.push_back( localRotation );
+	previousWorldRotations.push_back( localRotation );
+	worldRotations.push_back( localRotation );
+	worldRotationsCosines.push_back( static_cast<float32>( cos( localRotation * Comp2D::Utilities::DEGREE_IN_RAD ) ) );
+	worldRotationsSines.push_back( static_cast<float32>( sin( localRotation * Comp2D::Utilities::DEGREE_IN_RAD ) ) );
+
+	dirtyFlags.push_back( 1 );
+
+	localPositions.push_back( localPosition );
+	localScales.push_back( localScale );
+	previousWorldPositions.push_back( localPosition );
+	worldPositions.push_back( localPosition );
+	worldScales.push_back( localScale );
+
+	bodies.push_back( nullptr );
+
+	transformComponents.push_back( transformComponent );
+
+	return getCount() - 1;
+}
+
+Uint32 Comp2D::Components::TransformComponentsStorage::getCount() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TransformComponentsStorage getCount\n" );
+	#endif
+
+	return static_cast<Uint32>( transformComponents.size() );
+}
@@ -30,8 +30,11 @@
 #include <functional>
 #include <iterator>
 #include <list>
+#include <set>
 #include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <SDL.h>
 #include <SDL_image.h>
@@ -42,66 +45,59 @@
 #include "Box2D/Common/b2Math.h"
 
 #include "Comp2D/Headers/DataManagement/DataManager.h"
+#include "Comp2D/Headers/GameContext.h"
 #include "Comp2D/Headers/Inputs/GameInputs.h"
+#include "Comp2D/Headers/Inputs/InputsRecording.h"
+#include "Comp2D/Headers/Jobs/JobCounter.h"
+#include "Comp2D/Headers/Jobs/JobSystem.h"
+#include "Comp2D/Headers/Jobs/ProceduresQueue.h"
+#include "Comp2D/Headers/Jobs/SeparateThreadFunctionCall.h"
+#include "Comp2D/Headers/Jobs/TimerFunctionCall.h"
+#include "Comp2D/Headers/Profiling/Profiler.h"
+#include "Comp2D/Headers/Profiling/ProfilerZone.h"
+#include "Comp2D/Headers/Quality/QualityGovernor.h"
 #include "Comp2D/Headers/Random/RandomNumberGenerator.h"
 #include "Comp2D/Headers/Random/MersenneTwisterRNG.h"
+#include "Comp2D/Headers/Rendering/RenderPipeline.h"
 #include "Comp2D/Headers/Resources/ResourcesManager.h"
+#include "Comp2D/Headers/Resources/ResourcesPreload.h"
 #include "Comp2D/Headers/Settings/AudioSettings.h"
 #include "Comp2D/Headers/Settings/GameSettings.h"
 #include "Comp2D/Headers/Settings/GraphicsSettings.h"
 #include "Comp2D/Headers/States/GameState.h"
-#include "Comp2D/Headers/Time/TimedProcedure.h"
+#include "Comp2D/Headers/Time/FrameStatistics.h"
+#include "Comp2D/Headers/Time/StartupReport.h"
+#include "Comp2D/Headers/Time/TimeConversions.h"
+#include "Comp2D/Headers/Time/TimedProcedureHandle.h"
+#include "Comp2D/Headers/Time/TimedProceduresScheduler.h"
 #include "Comp2D/Headers/Time/TimeManager.h"
 #include "Comp2D/Headers/Time/Timer.h"
 
-bool Comp2D::Game::inStateTransition = false;
-bool Comp2D::Game::paused = false;
-bool Comp2D::Game::pausedTimeScale = false;
-bool Comp2D::Game::quit = false;
-
-unsigned int Comp2D::Game::gameTimedProcedureID = 0;
-
-Uint32 Comp2D::Game::averageFramesPerSecond = 0;
-Uint32 Comp2D::Game::currentStateID = 0;
-Uint32 Comp2D::Game::framesPerSecond = 0;
-Uint32 Comp2D::Game::framesPerSecondThroughDeltaTime = 0;
-Uint32 Comp2D::Game::lastFPSUpdateTime = 0;
-Uint32 Comp2D::Game::nextStateID = 0;
-Uint32 Comp2D::Game::timeOnLastFrameStartedRendering = 0;
-Uint32 Comp2D::Game::timeOnLastFrameFinishedRendering = 0;
-Uint32 Comp2D::Game::totalRenderedFramesSinceLastFPSUpdate = 0;
-Uint32 Comp2D::Game::windowPixelFormat = 0;
-
-Uint64 Comp2D::Game::totalRenderedFrames = 0;
+bool Comp2D::Game::contextsStarted = false;
 
-float Comp2D::Game::timeScaleOnPaused = 0.0f;
+int Comp2D::Game::commandLineArgumentsCount = 0;
 
-b2Vec2 Comp2D::Game::cameraPosition = b2Vec2_zero;
-
-std::list<SDL_TimerID> Comp2D::Game::gameTimerFunctionsIDs;
+Uint32 Comp2D::Game::windowPixelFormat = 0;
 
-std::list<SDL_Thread*> Comp2D::Game::gameSeparateThreadFunctions;
+std::vector<SDL_Event> Comp2D::Game::pendingEvents;
 
-std::list<Comp2D::Time::TimedProcedure*> Comp2D::Game::gameTimedProcedures;
-std::list<Comp2D::Time::TimedProcedure*> Comp2D::Game::gamePausableTimedProcedures;
+Comp2D::Jobs::ProceduresQueue* Comp2D::Game::postedProceduresQueue = nullptr;
 
-Comp2D::States::GameState** Comp2D::Game::gameStates = nullptr;
+char** Comp2D::Game::commandLineArguments = nullptr;
 
-Comp2D::Time::Timer Comp2D::Game::timeSinceFirstFrameTimer;
+thread_local Comp2D::GameContext* Comp2D::Game::context = nullptr;
 
 SDL_Window* Comp2D::Game::window = nullptr;
 
 SDL_Renderer* Comp2D::Game::renderer = nullptr;
 
+Comp2D::Rendering::RenderPipeline* Comp2D::Game::renderPipeline = nullptr;
+
 Comp2D::Settings::GameSettings* Comp2D::Game::gameSettings = nullptr;
 
 Comp2D::DataManagement::DataManager* Comp2D::Game::dataManager = nullptr;
 
-Comp2D::Time::TimeManager* Comp2D::Game::timeManager = nullptr;
-
-Comp2D::Random::RandomNumberGenerator* Comp2D::Game::randomNumberGenerator = nullptr;
-
-Comp2D::Resources::ResourcesManager* Comp2D::Game::resourcesManager = nullptr;
+Comp2D::Jobs::JobSystem* Comp2D::Game::jobSystem = nullptr;
 
 bool Comp2D::Game::initialize()
 {
@@ -109,10 +105,48 @@ bool Comp2D::Game::initialize()
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game initialize\n" );
 	#endif
 
+	Comp2D::Time::StartupReport::begin();
+
 	bool success = true;
 
-	if( SDL_Init( SDL_INIT_VIDEO | SDL_INIT_AUDIO | SDL_INIT_TIMER ) >= 0 )
+	initializeGameSettings();
+
+	Uint32 sdlSubsystemsFlags = SDL_INIT_VIDEO | SDL_INIT_AUDIO | SDL_INIT_TIMER;
+
+	if( gameSettings->isHeadless() )
+	{
+		// Events still come through, e.g. SDL_QUIT on SIGINT, and audio goes to
+		// the dummy driver unless another one was explicitly asked for
+		sdlSubsystemsFlags = SDL_INIT_EVENTS | SDL_INIT_AUDIO | SDL_INIT_TIMER;
+
+		SDL_setenv( "SDL_AUDIODRIVER", "dummy", 0 );
+	}
+
+	Uint64 sdlStartCounter = SDL_GetPerformanceCounter();
+
+	if( SDL_Init( sdlSubsystemsFlags ) >= 0 )
 	{
+		Comp2D::Time::StartupReport::addSubsystemTime( "SDL", sdlStartCounter );
+
+		#ifdef PROFILING
+			Comp2D::Profiling::Profiler::initialize();
+		#endif
+
+		COMP2D_PROFILE_THREAD( "Game Thread" );
+
+		initializePostedProceduresQueue();
+		initializeJobSystem();
+
+		// The window and the renderer are created on this thread meanwhile,
+		// the errors are kept to be reported from here once all are done
+		Comp2D::Jobs::JobCounter librariesInitializationsCounter;
+
+		std::string imageLoaderError;
+		std::string fontsError;
+		std::string audioError;
+
+		startLibrariesInitializations( librariesInitializationsCounter, imageLoaderError, fontsError, audioError );
+
 		/*
 		if( !SDL_SetHint( SDL_HINT_RENDER_SCALE_QUALITY, "1" ) )
 		{
@@ -122,50 +156,63 @@ bool Comp2D::Game::initialize()
 		}
 		*/
 
-		initializeGameSettings();
+		Uint64 windowStartCounter = SDL_GetPerformanceCounter();
+
+		bool gameWindowInitialized = initializeGameWindow();
+		bool rendererInitialized = false;
 
-		if( initializeGameWindow() )
+		Comp2D::Time::StartupReport::addSubsystemTime( "Window", windowStartCounter );
+
+		if( gameWindowInitialized )
 		{
-			if( initializeRenderer() )
+			Uint64 rendererStartCounter = SDL_GetPerformanceCounter();
+
+			rendererInitialized = initializeRenderer();
+
+			if( rendererInitialized )
 			{
-				SDL_SetRenderDrawColor
-				(
-					Comp2D::Game::renderer,
-					0xFF,
-					0xFF,
-					0xFF,
-					0xFF
-				);
+				initializeRenderPipeline();
+			}
+
+			Comp2D::Time::StartupReport::addSubsystemTime( "Renderer", rendererStartCounter );
+		}
 
-				if( !initializeImageLoader() )
+		// The jobs reference the errors and the counter
+		jobSystem->waitForCounter( &librariesInitializationsCounter );
+
+		if( gameWindowInitialized )
+		{
+			if( rendererInitialized )
+			{
+				if( !imageLoaderError.empty() )
 				{
 					#ifdef DEBUG
-						SDL_LogError( SDL_LOG_CATEGORY_APPLICATION, "SDL_image could not initialize! SDL_image Error: %s\n", IMG_GetError() );
+						SDL_LogError( SDL_LOG_CATEGORY_APPLICATION, "SDL_image could not initialize! SDL_image Error: %s\n", imageLoaderError.c_str() );
 					#endif
 
-					reportError( "Fatal Error: 003", "SDL_image could not initialize! SDL_image Error: ", IMG_GetError() );
+					reportError( "Fatal Error: 003", "SDL_image could not initialize! SDL_image Error: ", imageLoaderError.c_str() );
 
 					success = false;
 				}
 
-				if( success && TTF_Init() == -1 )
+				if( success && !fontsError.empty() )
 				{
 					#ifdef DEBUG
-						SDL_LogError( SDL_LOG_CATEGORY_APPLICATION, "SDL_ttf could not initialize! SDL_ttf Error: %s\n", TTF_GetError() );
+						SDL_LogError( SDL_LOG_CATEGORY_APPLICATION, "SDL_ttf could not initialize! SDL_ttf Error: %s\n", fontsError.c_str() );
 					#endif
 
-					reportError( "Fatal Error: 004", "SDL_ttf could not initialize! SDL_ttf Error: ", TTF_GetError() );
+					reportError( "Fatal Error: 004", "SDL_ttf could not initialize! SDL_ttf Error: ", fontsError.c_str() );
 
 					success = false;
 				}
 
-				if( success && !initializeAudio() )
+				if( success && !audioError.empty() )
 				{
 					#ifdef DEBUG
-						SDL_LogError( SDL_LOG_CATEGORY_AUDIO, "SDL_mixer could not initialize! SDL_mixer Error: %s\n", Mix_GetError() );
+						SDL_LogError( SDL_LOG_CATEGORY_AUDIO, "SDL_mixer could not initialize! SDL_mixer Error: %s\n", audioError.c_str() );
 					#endif
 
-					reportError( "Fatal Error: 005", "SDL_mixer could not initialize! SDL_mixer Error: ", Mix_GetError() );
+					reportError( "Fatal Error: 005", "SDL_mixer could not initialize! SDL_mixer Error: ", audioError.c_str() );
 
 					success = false;
 				}
@@ -274,12 +321,15 @@ bool Comp2D::Game::initialize()
 						}
 					#endif
 
-					initializeTimeManager();
-					initializeDataManager();
-					initializeRandomNumberGenerator();
-					initializeResourcesManager();
+					Uint64 inputsStartCounter = SDL_GetPerformanceCounter();
+
 					initializeInputs();
-					initializeStates();
+
+					Comp2D::Time::StartupReport::addSubsystemTime( "Inputs", inputsStartCounter );
+
+					initializeContext();
+
+					Comp2D::Time::StartupReport::end();
 				}
 			}
 			else
@@ -325,6 +375,17 @@ void Comp2D::Game::initializeGameSettings()
 	#endif
 
 	gameSettings = new Comp2D::Settings::GameSettings();
+
+	gameSettings->parseCommandLineArguments( commandLineArgumentsCount, commandLineArguments );
+
+	// The input devices states are shared by every context, so they could
+	// not be recorded nor replayed for each one of them
+	if( contextsStarted )
+	{
+		gameSettings->setHeadless( true );
+		gameSettings->setInputsRecordingFilePath( "" );
+		gameSettings->setInputsReplayFilePath( "" );
+	}
 }
 
 bool Comp2D::Game::initializeGameWindow()
@@ -333,6 +394,11 @@ bool Comp2D::Game::initializeGameWindow()
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game initializeGameWindow\n" );
 	#endif
 
+	if( gameSettings->isHeadless() )
+	{
+		return true;
+	}
+
 	window = SDL_CreateWindow
 	(
 		gameSettings->getWindowTitle().c_str(),
@@ -354,6 +420,11 @@ bool Comp2D::Game::initializeRenderer()
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game initializeRenderer\n" );
 	#endif
 
+	if( gameSettings->isHeadless() )
+	{
+		return true;
+	}
+
 	renderer = SDL_CreateRenderer
 	(
 		window,
@@ -363,9 +434,27 @@ bool Comp2D::Game::initializeRenderer()
 
 	SDL_SetRenderDrawBlendMode( renderer, SDL_BLENDMODE_BLEND );
 
+	SDL_SetRenderDrawColor
+	(
+		renderer,
+		0xFF,
+		0xFF,
+		0xFF,
+		0xFF
+	);
+
 	return renderer != nullptr;
 }
 
+void Comp2D::Game::initializeRenderPipeline()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game initializeRenderPipeline\n" );
+	#endif
+
+	renderPipeline = new Comp2D::Rendering::RenderPipeline( renderer );
+}
+
 bool Comp2D::Game::initializeImageLoader()
 {
 	#ifdef DEBUG
@@ -415,7 +504,27 @@ void Comp2D::Game::initializeTimeManager()
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game initializeTimeManager\n" );
 	#endif
 
-	timeManager = new Comp2D::Time::TimeManager();
+	context->timeManager = new Comp2D::Time::TimeManager();
+
+	context->frameStatistics.setFrameBudget( Comp2D::Time::secondsToNanoseconds( gameSettings->timeSettings.getFrameBudgetInSeconds() ) );
+}
+
+void Comp2D::Game::initializeJobSystem()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game initializeJobSystem\n" );
+	#endif
+
+	jobSystem = new Comp2D::Jobs::JobSystem( gameSettings->getJobWorkersCount() );
+}
+
+void Comp2D::Game::initializePostedProceduresQueue()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game initializePostedProceduresQueue\n" );
+	#endif
+
+	postedProceduresQueue = new Comp2D::Jobs::ProceduresQueue( POSTED_PROCEDURES_QUEUE_CAPACITY );
 }
 
 void Comp2D::Game::initializeDataManager()
@@ -434,13 +543,53 @@ void Comp2D::Game::initializeDataManager()
 	}
 }
 
+void Comp2D::Game::initializeInputsRecording()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game initializeInputsRecording\n" );
+	#endif
+
+	context->inputsRecording = new Comp2D::Inputs::InputsRecording();
+
+	const std::string& inputsReplayFilePath = gameSettings->getInputsReplayFilePath();
+
+	if( !inputsReplayFilePath.empty() && gameSettings->isHeadless() )
+	{
+		if( context->inputsRecording->loadReplay( inputsReplayFilePath ) )
+		{
+			context->timeManager->setFixedDeltaTime( context->inputsRecording->getFixedDeltaTimeInSeconds() );
+		}
+		else
+		{
+			reportError( "Fatal Error: 013", "Unable to load inputs replay file: ", inputsReplayFilePath.c_str() );
+		}
+	}
+	else if( !gameSettings->getInputsRecordingFilePath().empty() )
+	{
+		context->inputsRecording->startRecording( gameSettings->getInputsRecordingFilePath(), context->timeManager->getFixedDeltaTimeInSeconds() );
+	}
+}
+
 void Comp2D::Game::initializeRandomNumberGenerator()
 {
 	#ifdef DEBUG
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game initializeRandomNumberGenerator\n" );
 	#endif
 
-	randomNumberGenerator = new Comp2D::Random::MersenneTwisterRNG();
+	Comp2D::Random::MersenneTwisterRNG* mersenneTwisterRNG = nullptr;
+
+	if( context->inputsRecording->isReplaying() )
+	{
+		mersenneTwisterRNG = new Comp2D::Random::MersenneTwisterRNG( context->inputsRecording->getRandomSeed() );
+	}
+	else
+	{
+		mersenneTwisterRNG = new Comp2D::Random::MersenneTwisterRNG();
+
+		context->inputsRecording->setRandomSeed( mersenneTwisterRNG->getSeed() );
+	}
+
+	context->randomNumberGenerator = mersenneTwisterRNG;
 }
 
 void Comp2D::Game::initializeResourcesManager()
@@ -449,7 +598,7 @@ void Comp2D::Game::initializeResourcesManager()
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game initializeResourcesManager\n" );
 	#endif
 
-	resourcesManager = new Comp2D::Resources::ResourcesManager();
+	context->resourcesManager = new Comp2D::Resources::ResourcesManager();
 }
 
 void Comp2D::Game::initializeInputs()
@@ -461,251 +610,821 @@ void Comp2D::Game::initializeInputs()
 	Comp2D::Inputs::GameInputs::initializeGameInputs();
 }
 
-void Comp2D::Game::initializeStates()
+void Comp2D::Game::initializeContext()
 {
 	#ifdef DEBUG
-		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game initializeStates\n" );
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game initializeContext\n" );
 	#endif
 
-	if( NUMBER_OF_STATES < 1 )
-	{
-		quitGame();
-		return;
-	}
-
-	gameStates = new Comp2D::States::GameState*[NUMBER_OF_STATES];
-	Uint32 id = FIRST_STATE_ID;
-	// Add States Here
-	gameStates[0] = new Comp2D::States::GameState( id++ );
-
-	gameStates[FIRST_STATE_ID]->beforeSetup();
-	gameStates[FIRST_STATE_ID]->setup();
-	gameStates[FIRST_STATE_ID]->initialize();
-	timeManager->setCurrentStateInitializedTime( SDL_GetTicks() );
+	initializeTimeManager();
+	initializeInputsRecording();
+	initializeRandomNumberGenerator();
+	initializeResourcesManager();
+	initializeQualityGovernor();
+	initializeStates();
 }
 
-void Comp2D::Game::startUpdateLoop()
+void Comp2D::Game::initializeQualityGovernor()
 {
 	#ifdef DEBUG
-		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game startUpdateLoop\n" );
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game initializeQualityGovernor\n" );
 	#endif
 
-	SDL_Event e;
-
-	timeSinceFirstFrameTimer.start();
+	context->qualityGovernor.setFrameBudget( Comp2D::Time::secondsToNanoseconds( gameSettings->timeSettings.getFrameBudgetInSeconds() ) );
 
-	while( !quit )
+	// Without renderer there is nothing to scale
+	if( !gameSettings->isHeadless() )
 	{
-		if( inStateTransition )
-		{
-			if( nextStateID == currentStateID )
+		context->qualityGovernor.registerFeature
+		(
+			"Render scale",
+			RENDER_SCALE_QUALITY_LEVELS_COUNT,
+			[]( Uint32 renderScaleQualityLevel )
 			{
-				gameStates[currentStateID]->resetState();
+				renderPipeline->setRenderScale( 1.0f - RENDER_SCALE_QUALITY_LEVEL_STEP * static_cast<float>( renderScaleQualityLevel ) );
 			}
-			else
-			{
-				gameStates[currentStateID]->finalize();
+		);
+	}
+}
 
-				currentStateID = nextStateID;
-				gameStates[currentStateID]->beforeSetup();
-				gameStates[currentStateID]->setup();
-				gameStates[currentStateID]->initialize();
-				timeManager->setCurrentStateInitializedTime( timeManager->getTimeSinceSDLInitializationInMilliseconds() );
-			}
+void Comp2D::Game::initializeStates()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game initializeStates\n" );
+	#endif
 
-			inStateTransition = false;
+	if( NUMBER_OF_STATES < 1 )
+	{
+		quitGame();
+		return;
+	}
 
-			//timeSinceFirstFrameTimer.start();
-		}
-		else
-		{
-			//deltaTimeTimer.stop();
-			//deltaTimeTimer.start();
+	context->gameStates = new Comp2D::States::GameState*[NUMBER_OF_STATES]();
 
-			timeOnLastFrameStartedRendering = SDL_GetTicks();
+	Uint64 firstStateSetupStartCounter = SDL_GetPerformanceCounter();
 
-			SDL_SetRenderDrawColor( renderer, 0x00, 0x00, 0x00, 0xFF );
-			SDL_RenderClear( renderer );
+	Comp2D::States::GameState* firstGameState = getState( FIRST_STATE_ID );
 
-			gameStates[currentStateID]->render();
+	firstGameState->runSetup();
 
-			SDL_RenderPresent( renderer );
+	Comp2D::Time::StartupReport::addSubsystemTime( "First GameState setup", firstStateSetupStartCounter );
 
-			timeOnLastFrameFinishedRendering = SDL_GetTicks();
+	// Decodes the Resources on the job workers rather than one after the
+	// other, initialize then finds them already loaded
+	Uint64 firstStateResourcesStartCounter = SDL_GetPerformanceCounter();
 
-			//deltaTimeTimer.pause();
+	firstGameState->collectResourcesNamesFromResourceComponents();
 
-			updateAverageFramePerSecond();
-			updateFramesPerSecond();
+	Comp2D::Resources::ResourcesPreload* firstStateResourcesPreload = context->resourcesManager->preloadResources( firstGameState->m_resourceComponentsResourcesNames );
 
-			timeManager->setDeltaTime
-			(
-				timeOnLastFrameFinishedRendering - timeOnLastFrameStartedRendering
-			);
+	firstStateResourcesPreload->complete();
 
-			updateFramesPerSecondThroughDeltaTime();
+	delete firstStateResourcesPreload;
 
-			checkGameTimedProcedures();
-			Comp2D::States::GameState::checkGameStateTimedProcedures();
+	// The animations and timelines Resources are only known once their
+	// controllers are loaded
+	firstGameState->collectResourcesNamesFromResourceComponents();
 
-			while( SDL_PollEvent( &e ) != 0 )
-			{
-				gameStates[currentStateID]->onEvent( e );
-			}
-			Comp2D::Inputs::GameInputs::updateInputDevicesStates();
-			gameStates[currentStateID]->update();
-		}
-	}
-}
+	firstStateResourcesPreload = context->resourcesManager->preloadResources( firstGameState->m_resourceComponentsResourcesNames );
 
-void Comp2D::Game::finalize()
-{
-	#ifdef DEBUG
-		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game finalize\n" );
-	#endif
+	firstStateResourcesPreload->complete();
 
-	finalizeStates();
-	finalizeGameTimerFunctions();
-	finalizeGameTimedProcedures();
-	finalizeGameSeparateThreadsFunctions();
-	finalizeInputs();
-	finalizeResourcesManager();
-	finalizeRandomNumberGenerator();
-	finalizeDataManager();
-	finalizeTimeManager();
+	delete firstStateResourcesPreload;
 
-	finalizeAudio();
-	TTF_Quit();
-	finalizeImageLoader();
+	Comp2D::Time::StartupReport::addSubsystemTime( "First GameState Resources", firstStateResourcesStartCounter );
 
-	finalizeRenderer();
-	finalizeGameWindow();
+	Uint64 firstStateInitializationStartCounter = SDL_GetPerformanceCounter();
 
-	finalizeGameSettings();
+	firstGameState->initialize();
 
-	SDL_Quit();
+	Comp2D::Time::StartupReport::addSubsystemTime( "First GameState initialization", firstStateInitializationStartCounter );
+
+	context->timeManager->setCurrentStateInitializedTime( context->timeManager->getTimeSinceSDLInitializationInNanoseconds() );
 }
 
-void Comp2D::Game::finalizeGameTimerFunctions()
+void Comp2D::Game::startLibrariesInitializations
+(
+	Comp2D::Jobs::JobCounter& counter,
+	std::string& imageLoaderError,
+	std::string& fontsError,
+	std::string& audioError
+)
 {
 	#ifdef DEBUG
-		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game finalizeGameTimerFunctions\n" );
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game startLibrariesInitializations\n" );
 	#endif
 
-	for
+	// SDL errors are kept per thread, so they are read on the worker that
+	// failed. Not every failure sets one
+	jobSystem->run
 	(
-		std::list<SDL_TimerID>::reverse_iterator gameTimerFunctionIDReverseIt = gameTimerFunctionsIDs.rbegin();
-		gameTimerFunctionIDReverseIt != gameTimerFunctionsIDs.rend();
-		++gameTimerFunctionIDReverseIt
-	)
-	{
-		#ifdef DEBUG
-			SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game Removing Timer Function with ID %i\n", *gameTimerFunctionIDReverseIt );
-		#endif
+		[&imageLoaderError]()
+		{
+			Uint64 startCounter = SDL_GetPerformanceCounter();
 
-		SDL_RemoveTimer( *gameTimerFunctionIDReverseIt );
-	}
+			if( !initializeImageLoader() )
+			{
+				imageLoaderError = IMG_GetError();
 
-	gameTimerFunctionsIDs.clear();
-}
+				if( imageLoaderError.empty() )
+				{
+					imageLoaderError = "Unknown error";
+				}
+			}
 
-void Comp2D::Game::finalizeGameTimedProcedures()
-{
-	#ifdef DEBUG
-		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game finalizeGameTimedProcedures\n" );
-	#endif
+			Comp2D::Time::StartupReport::addSubsystemTime( "SDL_image", startCounter );
+		},
+		&counter
+	);
 
-	for
+	jobSystem->run
 	(
-		std::list<Comp2D::Time::TimedProcedure*>::reverse_iterator gameTimedProcedureReverseIt = gameTimedProcedures.rbegin();
-		gameTimedProcedureReverseIt != gameTimedProcedures.rend();
-		++gameTimedProcedureReverseIt
-	)
-	{
-		delete (*gameTimedProcedureReverseIt);
-	}
+		[&fontsError]()
+		{
+			Uint64 startCounter = SDL_GetPerformanceCounter();
 
-	gamePausableTimedProcedures.clear();
-	gameTimedProcedures.clear();
-}
+			if( TTF_Init() == -1 )
+			{
+				fontsError = TTF_GetError();
 
-void Comp2D::Game::finalizeGameSeparateThreadsFunctions()
-{
-	#ifdef DEBUG
-		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game finalizeGameSeparateThreadsFunctions\n" );
-	#endif
+				if( fontsError.empty() )
+				{
+					fontsError = "Unknown error";
+				}
+			}
 
-	for
-	(
-		std::list<SDL_Thread*>::reverse_iterator gameSeparateThreadFunctionReverseIt = gameSeparateThreadFunctions.rbegin();
-		gameSeparateThreadFunctionReverseIt != gameSeparateThreadFunctions.rend();
-		++gameSeparateThreadFunctionReverseIt
-	)
-	{
-		#ifdef DEBUG
-			SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game Waiting Separate Thread Function With Address %p\n", *gameSeparateThreadFunctionReverseIt );
-		#endif
+			Comp2D::Time::StartupReport::addSubsystemTime( "SDL_ttf", startCounter );
+		},
+		&counter
+	);
 
-		SDL_WaitThread( *gameSeparateThreadFunctionReverseIt, nullptr );
-	}
+	jobSystem->run
+	(
+		[&audioError]()
+		{
+			Uint64 startCounter = SDL_GetPerformanceCounter();
 
-	gameSeparateThreadFunctions.clear();
-}
+			if( !initializeAudio() )
+			{
+				audioError = Mix_GetError();
 
-void Comp2D::Game::finalizeStates()
-{
-	#ifdef DEBUG
-		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game finalizeStates\n" );
-	#endif
+				if( audioError.empty() )
+				{
+					audioError = "Unknown error";
+				}
+			}
 
-	if( NUMBER_OF_STATES > FIRST_STATE_ID && gameStates != nullptr )
-	{
-		gameStates[currentStateID]->finalize();
+			Comp2D::Time::StartupReport::addSubsystemTime( "SDL_mixer", startCounter );
+		},
+		&counter
+	);
 
-		for
-		(
-			Uint32 i = NUMBER_OF_STATES - 1, deletedStatesCount = 1;
-			deletedStatesCount <= NUMBER_OF_STATES;
-			--i, ++deletedStatesCount
-		)
+	jobSystem->run
+	(
+		[]()
 		{
-			delete gameStates[i];
-			gameStates[i] = nullptr;
-		}
+			Uint64 startCounter = SDL_GetPerformanceCounter();
 
-		gameStates = nullptr;
-	}
-}
-
-void Comp2D::Game::finalizeInputs()
-{
-	#ifdef DEBUG
-		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game finalizeInputs\n" );
-	#endif
+			initializeDataManager();
 
-	Comp2D::Inputs::GameInputs::finalizeGameInputs();
+			Comp2D::Time::StartupReport::addSubsystemTime( "Data", startCounter );
+		},
+		&counter
+	);
 }
 
-void Comp2D::Game::finalizeResourcesManager()
+void Comp2D::Game::startUpdateLoop()
 {
 	#ifdef DEBUG
-		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game finalizeResourcesManager\n" );
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game startUpdateLoop\n" );
 	#endif
 
-	delete resourcesManager;
-}
+	SDL_Event e;
 
-void Comp2D::Game::finalizeRandomNumberGenerator()
-{
-	#ifdef DEBUG
-		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game finalizeRandomNumberGenerator\n" );
-	#endif
+	context->timeSinceFirstFrameTimer.start();
 
-	delete randomNumberGenerator;
-}
+	resetFrameClock();
 
-void Comp2D::Game::finalizeDataManager()
-{
+	if( gameSettings->isHeadless() )
+	{
+		startHeadlessUpdateLoop();
+
+		return;
+	}
+
+	if
+	(
+		gameSettings->graphicsSettings.isPipelinedRenderingEnabled() &&
+		renderPipeline->startSimulationThread
+		(
+			[simulationContext = context]()
+			{
+				// The simulation thread works on the context that started it
+				context = simulationContext;
+
+				runSimulationFrame();
+			}
+		)
+	)
+	{
+		startPipelinedUpdateLoop();
+
+		renderPipeline->stopSimulationThread();
+
+		return;
+	}
+
+	while( !context->quit )
+	{
+		if( !updateStateTransitions() )
+		{
+			// The delta time covers the whole previous frame: render, present,
+			// events and update
+			Uint64 timeOnFrameStarted = context->timeManager->getTimeSinceSDLInitializationInNanoseconds();
+
+			context->timeManager->setDeltaTime( timeOnFrameStarted - context->timeOnLastFrameStarted );
+			// Throttled frames last as long as the throttled tick rate says, so
+			// they would only skew the statistics and lower the quality
+			if( !context->previousFrameThrottled )
+			{
+				context->frameStatistics.addFrameTime( timeOnFrameStarted - context->timeOnLastFrameStarted );
+
+				updateQualityGovernor( timeOnFrameStarted - context->timeOnLastFrameStarted );
+			}
+
+			context->timeOnLastFrameStarted = timeOnFrameStarted;
+
+			updateAverageFramePerSecond();
+			updateFramesPerSecond();
+			updateFramesPerSecondThroughDeltaTime();
+
+			bool windowHidden = isWindowHidden();
+
+			context->previousFrameThrottled = isUpdateLoopThrottled( windowHidden );
+
+			// Nothing drawn on a hidden window would be seen
+			if( !windowHidden )
+			{
+				renderPipeline->beginFrame();
+
+				context->gameStates[context->currentStateID]->render();
+
+				renderPipeline->endFrame();
+			}
+
+			Uint64 timeOnRenderFinished = context->timeManager->getTimeSinceSDLInitializationInNanoseconds();
+
+			if( !windowHidden )
+			{
+				COMP2D_PROFILE_ZONE( "SDL_RenderPresent" );
+
+				SDL_RenderPresent( renderer );
+			}
+
+			Uint64 timeOnPresentFinished = context->timeManager->getTimeSinceSDLInitializationInNanoseconds();
+
+			if( context->previousFrameThrottled )
+			{
+				waitForEventsUntil( timeOnFrameStarted + getThrottledTickIntervalInNanoseconds() );
+
+				for
+				(
+					std::vector<SDL_Event>::iterator pendingEventIt = pendingEvents.begin();
+					pendingEventIt != pendingEvents.end();
+					++pendingEventIt
+				)
+				{
+					context->gameStates[context->currentStateID]->onEvent( *pendingEventIt );
+				}
+				pendingEvents.clear();
+			}
+
+			while( SDL_PollEvent( &e ) != 0 )
+			{
+				context->gameStates[context->currentStateID]->onEvent( e );
+			}
+			Comp2D::Inputs::GameInputs::updateInputDevicesStates();
+
+			if( context->inputsRecording->isRecording() )
+			{
+				context->inputsRecording->recordFrame( context->timeManager->getDeltaTimeInNanoseconds() );
+			}
+
+			Uint64 timeOnEventsFinished = context->timeManager->getTimeSinceSDLInitializationInNanoseconds();
+
+			runSimulationFrame();
+
+			context->timeManager->setFramePhaseDuration( Comp2D::Time::EFramePhase::Render, timeOnRenderFinished - timeOnFrameStarted );
+			context->timeManager->setFramePhaseDuration( Comp2D::Time::EFramePhase::Present, timeOnPresentFinished - timeOnRenderFinished );
+			context->timeManager->setFramePhaseDuration( Comp2D::Time::EFramePhase::Events, timeOnEventsFinished - timeOnPresentFinished );
+			context->timeManager->setFramePhaseDuration( Comp2D::Time::EFramePhase::Update, context->simulationFrameDurationInNanoseconds );
+		}
+	}
+}
+
+void Comp2D::Game::startPipelinedUpdateLoop()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game startPipelinedUpdateLoop\n" );
+	#endif
+
+	SDL_Event e;
+
+	// Everything that touches the GameState happens while the simulation
+	// thread is idle: state transitions, event dispatching and recording the
+	// render packet. Only submitting and presenting overlap the simulation
+	while( !context->quit )
+	{
+		if( !updateStateTransitions() )
+		{
+			Uint64 timeOnFrameStarted = context->timeManager->getTimeSinceSDLInitializationInNanoseconds();
+
+			context->timeManager->setDeltaTime( timeOnFrameStarted - context->timeOnLastFrameStarted );
+			// Throttled frames last as long as the throttled tick rate says, so
+			// they would only skew the statistics and lower the quality
+			if( !context->previousFrameThrottled )
+			{
+				context->frameStatistics.addFrameTime( timeOnFrameStarted - context->timeOnLastFrameStarted );
+
+				updateQualityGovernor( timeOnFrameStarted - context->timeOnLastFrameStarted );
+			}
+
+			context->timeOnLastFrameStarted = timeOnFrameStarted;
+
+			updateAverageFramePerSecond();
+			updateFramesPerSecond();
+			updateFramesPerSecondThroughDeltaTime();
+
+			bool windowHidden = isWindowHidden();
+
+			context->previousFrameThrottled = isUpdateLoopThrottled( windowHidden );
+
+			for
+			(
+				std::vector<SDL_Event>::iterator pendingEventIt = pendingEvents.begin();
+				pendingEventIt != pendingEvents.end();
+				++pendingEventIt
+			)
+			{
+				context->gameStates[context->currentStateID]->onEvent( *pendingEventIt );
+			}
+			pendingEvents.clear();
+			Comp2D::Inputs::GameInputs::updateInputDevicesStates();
+
+			if( context->inputsRecording->isRecording() )
+			{
+				context->inputsRecording->recordFrame( context->timeManager->getDeltaTimeInNanoseconds() );
+			}
+
+			Uint64 timeOnEventsFinished = context->timeManager->getTimeSinceSDLInitializationInNanoseconds();
+
+			// Nothing drawn on a hidden window would be seen
+			if( !windowHidden )
+			{
+				renderPipeline->beginRecording();
+				context->gameStates[context->currentStateID]->render();
+				renderPipeline->endRecording();
+			}
+
+			renderPipeline->requestSimulationFrame();
+
+			if( !windowHidden )
+			{
+				renderPipeline->beginFrame();
+
+				{
+					COMP2D_PROFILE_ZONE( "RenderPipeline::submitRecordedRenderPacket" );
+
+					renderPipeline->submitRecordedRenderPacket();
+				}
+
+				renderPipeline->endFrame();
+			}
+
+			Uint64 timeOnRenderFinished = context->timeManager->getTimeSinceSDLInitializationInNanoseconds();
+
+			if( !windowHidden )
+			{
+				COMP2D_PROFILE_ZONE( "SDL_RenderPresent" );
+
+				SDL_RenderPresent( renderer );
+			}
+
+			Uint64 timeOnPresentFinished = context->timeManager->getTimeSinceSDLInitializationInNanoseconds();
+
+			if( context->previousFrameThrottled )
+			{
+				waitForEventsUntil( timeOnFrameStarted + getThrottledTickIntervalInNanoseconds() );
+			}
+
+			// Dispatched on the next frame, once the simulation thread is idle
+			while( SDL_PollEvent( &e ) != 0 )
+			{
+				pendingEvents.push_back( e );
+			}
+
+			renderPipeline->waitForSimulationFrame();
+
+			context->timeManager->setFramePhaseDuration( Comp2D::Time::EFramePhase::Render, timeOnRenderFinished - timeOnEventsFinished );
+			context->timeManager->setFramePhaseDuration( Comp2D::Time::EFramePhase::Present, timeOnPresentFinished - timeOnRenderFinished );
+			context->timeManager->setFramePhaseDuration( Comp2D::Time::EFramePhase::Events, timeOnEventsFinished - timeOnFrameStarted );
+			context->timeManager->setFramePhaseDuration( Comp2D::Time::EFramePhase::Update, context->simulationFrameDurationInNanoseconds );
+		}
+	}
+
+	pendingEvents.clear();
+}
+
+void Comp2D::Game::startHeadlessUpdateLoop()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game startHeadlessUpdateLoop\n" );
+	#endif
+
+	SDL_Event e;
+
+	float headlessSimulationSpeed = gameSettings->timeSettings.getHeadlessSimulationSpeed();
+
+	// Every tick advances the simulated clock by exactly one fixed step, so a
+	// run simulates the same steps whatever the machine speed. The real time
+	// is only used for the frame statistics and for pacing
+	Uint64 realTimeOnLastTickStarted = context->timeManager->getRealTimeSinceSDLInitializationInNanoseconds();
+	Uint64 realTimeOnPacingStarted = realTimeOnLastTickStarted;
+	Uint64 simulatedTimeOnPacingStarted = context->timeManager->getTimeSinceSDLInitializationInNanoseconds();
+
+	// When replaying, a tick lasts as long as the recorded frame did instead
+	Uint64 replayedDeltaTimeInNanoseconds = 0;
+
+	while( !context->quit )
+	{
+		if( updateStateTransitions() )
+		{
+			realTimeOnLastTickStarted = context->timeManager->getRealTimeSinceSDLInitializationInNanoseconds();
+			realTimeOnPacingStarted = realTimeOnLastTickStarted;
+			simulatedTimeOnPacingStarted = context->timeManager->getTimeSinceSDLInitializationInNanoseconds();
+		}
+		else if( context->inputsRecording->isReplaying() && !context->inputsRecording->replayFrame( replayedDeltaTimeInNanoseconds ) )
+		{
+			logInputsReplayReport();
+			quitGame();
+		}
+		else
+		{
+			Uint64 realTimeOnTickStarted = context->timeManager->getRealTimeSinceSDLInitializationInNanoseconds();
+
+			context->frameStatistics.addFrameTime( realTimeOnTickStarted - realTimeOnLastTickStarted );
+
+			realTimeOnLastTickStarted = realTimeOnTickStarted;
+
+			Uint64 simulatedStepInNanoseconds = context->inputsRecording->isReplaying() ?
+				replayedDeltaTimeInNanoseconds :
+				Comp2D::Time::secondsToNanoseconds( context->timeManager->getFixedDeltaTimeInSeconds() );
+
+			context->timeManager->advanceSimulatedClock( simulatedStepInNanoseconds );
+			context->timeManager->setDeltaTime( simulatedStepInNanoseconds );
+
+			context->timeOnLastFrameStarted = context->timeManager->getTimeSinceSDLInitializationInNanoseconds();
+
+			while( SDL_PollEvent( &e ) != 0 )
+			{
+				context->gameStates[context->currentStateID]->onEvent( e );
+			}
+
+			// The replayed frame already set the input devices states
+			if( !context->inputsRecording->isReplaying() )
+			{
+				Comp2D::Inputs::GameInputs::updateInputDevicesStates();
+			}
+
+			if( context->inputsRecording->isRecording() )
+			{
+				context->inputsRecording->recordFrame( simulatedStepInNanoseconds );
+			}
+
+			Uint64 realTimeOnEventsFinished = context->timeManager->getRealTimeSinceSDLInitializationInNanoseconds();
+
+			runSimulationFrame();
+
+			context->timeManager->setFramePhaseDuration( Comp2D::Time::EFramePhase::Render, 0 );
+			context->timeManager->setFramePhaseDuration( Comp2D::Time::EFramePhase::Present, 0 );
+			context->timeManager->setFramePhaseDuration( Comp2D::Time::EFramePhase::Events, realTimeOnEventsFinished - realTimeOnTickStarted );
+			context->timeManager->setFramePhaseDuration( Comp2D::Time::EFramePhase::Update, context->simulationFrameDurationInNanoseconds );
+
+			if( headlessSimulationSpeed > 0.0f )
+			{
+				Uint64 realTimeOnNextTick = realTimeOnPacingStarted + static_cast<Uint64>
+				(
+					static_cast<double>( context->timeManager->getTimeSinceSDLInitializationInNanoseconds() - simulatedTimeOnPacingStarted ) /
+					static_cast<double>( headlessSimulationSpeed )
+				);
+
+				Uint64 realTimeOnTickFinished = context->timeManager->getRealTimeSinceSDLInitializationInNanoseconds();
+
+				if( realTimeOnNextTick > realTimeOnTickFinished )
+				{
+					SDL_Delay( Comp2D::Time::nanosecondsToMilliseconds( realTimeOnNextTick - realTimeOnTickFinished ) );
+				}
+			}
+		}
+	}
+}
+
+void Comp2D::Game::startContextsUpdateLoop( const std::vector<Comp2D::GameContext*>& contexts )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game startContextsUpdateLoop\n" );
+	#endif
+
+	SDL_Event e;
+
+	Comp2D::GameContext* firstContext = context;
+
+	for
+	(
+		std::vector<Comp2D::GameContext*>::const_iterator it = contexts.begin();
+		it != contexts.end();
+		++it
+	)
+	{
+		context = *it;
+
+		context->timeSinceFirstFrameTimer.start();
+
+		resetFrameClock();
+	}
+
+	bool anyContextRunning = true;
+
+	while( anyContextRunning )
+	{
+		// Events and input devices are shared, so they are dispatched on the
+		// game thread before the contexts tick in parallel
+		while( SDL_PollEvent( &e ) != 0 )
+		{
+			for
+			(
+				std::vector<Comp2D::GameContext*>::const_iterator it = contexts.begin();
+				it != contexts.end();
+				++it
+			)
+			{
+				context = *it;
+
+				if( !context->quit && !context->inStateTransition )
+				{
+					context->gameStates[context->currentStateID]->onEvent( e );
+				}
+			}
+		}
+		Comp2D::Inputs::GameInputs::updateInputDevicesStates();
+
+		runPostedProcedures();
+
+		jobSystem->parallelFor
+		(
+			static_cast<Uint32>( contexts.size() ),
+			1,
+			[&contexts]( Uint32 first, Uint32 last )
+			{
+				Comp2D::GameContext* previousContext = context;
+
+				for( Uint32 i = first; i < last; ++i )
+				{
+					context = contexts[i];
+
+					if( !context->quit )
+					{
+						runContextTick();
+					}
+				}
+
+				context = previousContext;
+			}
+		);
+
+		anyContextRunning = false;
+
+		for
+		(
+			std::vector<Comp2D::GameContext*>::const_iterator it = contexts.begin();
+			it != contexts.end();
+			++it
+		)
+		{
+			if( !( *it )->quit )
+			{
+				anyContextRunning = true;
+			}
+		}
+	}
+
+	context = firstContext;
+}
+
+void Comp2D::Game::finalize()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game finalize\n" );
+	#endif
+
+	finalizeContext();
+	finalizeJobSystem();
+	finalizePostedProceduresQueue();
+	finalizeInputs();
+	finalizeDataManager();
+
+	finalizeAudio();
+	TTF_Quit();
+	finalizeImageLoader();
+
+	finalizeRenderPipeline();
+	finalizeRenderer();
+	finalizeGameWindow();
+
+	finalizeGameSettings();
+
+	#ifdef PROFILING
+		Comp2D::Profiling::Profiler::finalize();
+	#endif
+
+	SDL_Quit();
+}
+
+void Comp2D::Game::finalizeContext()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game finalizeContext\n" );
+	#endif
+
+	finalizeAsyncStateTransition();
+	finalizeStates();
+	finalizeGameTimerFunctions();
+	finalizeGameTimedProcedures();
+	finalizeGameSeparateThreadsFunctions();
+	finalizeInputsRecording();
+	finalizeResourcesManager();
+	finalizeRandomNumberGenerator();
+	finalizeTimeManager();
+}
+
+void Comp2D::Game::finalizeAsyncStateTransition()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game finalizeAsyncStateTransition\n" );
+	#endif
+
+	context->asyncStateTransitionRequested = false;
+
+	if( context->asyncStateTransitionResourcesPreload )
+	{
+		delete context->asyncStateTransitionResourcesPreload;
+		context->asyncStateTransitionResourcesPreload = nullptr;
+
+		// The next GameState was already set up
+		context->gameStates[context->asyncStateTransitionNextStateID]->keepResourcesLoaded( context->gameStates[context->currentStateID]->m_resourceComponentsResourcesNames );
+		context->gameStates[context->asyncStateTransitionNextStateID]->finalize();
+	}
+}
+
+void Comp2D::Game::finalizeGameTimerFunctions()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game finalizeGameTimerFunctions\n" );
+	#endif
+
+	for
+	(
+		std::list<SDL_TimerID>::reverse_iterator gameTimerFunctionIDReverseIt = context->gameTimerFunctionsIDs.rbegin();
+		gameTimerFunctionIDReverseIt != context->gameTimerFunctionsIDs.rend();
+		++gameTimerFunctionIDReverseIt
+	)
+	{
+		#ifdef DEBUG
+			SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game Removing Timer Function with ID %i\n", *gameTimerFunctionIDReverseIt );
+		#endif
+
+		Comp2D::Jobs::TimerFunctionCall::stop( *gameTimerFunctionIDReverseIt );
+	}
+
+	context->gameTimerFunctionsIDs.clear();
+}
+
+void Comp2D::Game::finalizeGameTimedProcedures()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game finalizeGameTimedProcedures\n" );
+	#endif
+
+	context->gameTimedProceduresScheduler.clear();
+}
+
+void Comp2D::Game::finalizeGameSeparateThreadsFunctions()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game finalizeGameSeparateThreadsFunctions\n" );
+	#endif
+
+	Comp2D::Jobs::SeparateThreadFunctionCall::waitForAll( context->gameSeparateThreadFunctions );
+}
+
+void Comp2D::Game::finalizeJobSystem()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game finalizeJobSystem\n" );
+	#endif
+
+	delete jobSystem;
+	jobSystem = nullptr;
+}
+
+void Comp2D::Game::finalizePostedProceduresQueue()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game finalizePostedProceduresQueue\n" );
+	#endif
+
+	// Procedures still pending are dropped along with their captures
+	delete postedProceduresQueue;
+	postedProceduresQueue = nullptr;
+}
+
+void Comp2D::Game::finalizeStates()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game finalizeStates\n" );
+	#endif
+
+	if( NUMBER_OF_STATES > FIRST_STATE_ID && context->gameStates != nullptr )
+	{
+		context->gameStates[context->currentStateID]->finalize();
+
+		// The GameStates never transitioned to were not created
+		for
+		(
+			Uint32 i = NUMBER_OF_STATES - 1, deletedStatesCount = 1;
+			deletedStatesCount <= NUMBER_OF_STATES;
+			--i, ++deletedStatesCount
+		)
+		{
+			delete context->gameStates[i];
+			context->gameStates[i] = nullptr;
+		}
+
+		delete[] context->gameStates;
+		context->gameStates = nullptr;
+	}
+}
+
+void Comp2D::Game::finalizeInputs()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game finalizeInputs\n" );
+	#endif
+
+	Comp2D::Inputs::GameInputs::finalizeGameInputs();
+}
+
+void Comp2D::Game::finalizeInputsRecording()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game finalizeInputsRecording\n" );
+	#endif
+
+	if( context->inputsRecording && context->inputsRecording->isRecording() && !context->inputsRecording->finishRecording() )
+	{
+		reportError
+		(
+			"Fatal Error: 014",
+			"Unable to write inputs recording file: ",
+			gameSettings->getInputsRecordingFilePath().c_str(),
+			false
+		);
+	}
+
+	delete context->inputsRecording;
+	context->inputsRecording = nullptr;
+}
+
+void Comp2D::Game::finalizeResourcesManager()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game finalizeResourcesManager\n" );
+	#endif
+
+	delete context->resourcesManager;
+}
+
+void Comp2D::Game::finalizeRandomNumberGenerator()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game finalizeRandomNumberGenerator\n" );
+	#endif
+
+	delete context->randomNumberGenerator;
+}
+
+void Comp2D::Game::finalizeDataManager()
+{
 	#ifdef DEBUG
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game finalizeDataManager\n" );
 	#endif
@@ -719,7 +1438,7 @@ void Comp2D::Game::finalizeTimeManager()
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game finalizeTimeManager\n" );
 	#endif
 
-	delete timeManager;
+	delete context->timeManager;
 }
 
 void Comp2D::Game::finalizeAudio()
@@ -741,6 +1460,16 @@ void Comp2D::Game::finalizeImageLoader()
 	IMG_Quit();
 }
 
+void Comp2D::Game::finalizeRenderPipeline()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game finalizeRenderPipeline\n" );
+	#endif
+
+	delete renderPipeline;
+	renderPipeline = nullptr;
+}
+
 void Comp2D::Game::finalizeRenderer()
 {
 	#ifdef DEBUG
@@ -770,49 +1499,318 @@ void Comp2D::Game::finalizeGameSettings()
 	delete gameSettings;
 }
 
+bool Comp2D::Game::updateStateTransitions()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game updateStateTransitions\n" );
+	#endif
+
+	// Returns whether the current GameState changed, in which case the loop
+	// starts over instead of running a frame. A synchronous transition asked
+	// for during an asynchronous one waits for it to complete
+	if( context->asyncStateTransitionRequested )
+	{
+		beginAsyncStateTransition();
+
+		return true;
+	}
+
+	if( context->asyncStateTransitionResourcesPreload )
+	{
+		if( context->asyncStateTransitionResourcesPreload->update( ASYNC_STATE_TRANSITION_LOADING_BUDGET_IN_NANOSECONDS ) )
+		{
+			// The animations and timelines Resources are only known once their
+			// controllers are loaded, so they are preloaded in a further pass
+			Comp2D::States::GameState* nextGameState = context->gameStates[context->asyncStateTransitionNextStateID];
+
+			std::set<std::string>::size_type preloadedResourcesNamesCount = nextGameState->m_resourceComponentsResourcesNames.size();
+
+			nextGameState->collectResourcesNamesFromResourceComponents();
+
+			if( nextGameState->m_resourceComponentsResourcesNames.size() > preloadedResourcesNamesCount )
+			{
+				delete context->asyncStateTransitionResourcesPreload;
+
+				context->asyncStateTransitionResourcesPreload = context->resourcesManager->preloadResources( nextGameState->m_resourceComponentsResourcesNames );
+
+				return false;
+			}
+
+			completeAsyncStateTransition();
+
+			return true;
+		}
+
+		return false;
+	}
+
+	if( context->inStateTransition )
+	{
+		performStateTransition();
+
+		return true;
+	}
+
+	return false;
+}
+
+void Comp2D::Game::beginAsyncStateTransition()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game beginAsyncStateTransition: nextStateID = %u; loadingStateID = %u\n", context->asyncStateTransitionNextStateID, context->asyncStateTransitionLoadingStateID );
+	#endif
+
+	context->asyncStateTransitionRequested = false;
+
+	if
+	(
+		context->asyncStateTransitionLoadingStateID != NO_STATE_ID &&
+		context->asyncStateTransitionLoadingStateID != context->currentStateID
+	)
+	{
+		context->nextStateID = context->asyncStateTransitionLoadingStateID;
+
+		performStateTransition();
+	}
+
+	Comp2D::States::GameState* nextGameState = getState( context->asyncStateTransitionNextStateID );
+
+	// The setup may change the fixed delta time, which must only apply once
+	// the next GameState becomes the current one
+	float currentStateFixedDeltaTimeInSeconds = context->timeManager->getFixedDeltaTimeInSeconds();
+
+	context->timeManager->setFixedDeltaTime( gameSettings->timeSettings.getFixedDeltaTimeInSeconds() );
+	nextGameState->runSetup();
+	context->asyncStateTransitionNextStateFixedDeltaTimeInSeconds = context->timeManager->getFixedDeltaTimeInSeconds();
+	context->timeManager->setFixedDeltaTime( currentStateFixedDeltaTimeInSeconds );
+
+	nextGameState->collectResourcesNamesFromResourceComponents();
+
+	context->asyncStateTransitionResourcesPreload = context->resourcesManager->preloadResources( nextGameState->m_resourceComponentsResourcesNames );
+
+	resetFrameClock();
+}
+
 void Comp2D::Game::checkGameTimedProcedures()
 {
 	#ifdef DEBUG
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game checkTimedProcedures\n" );
 	#endif
 
-	Uint32 currentTime = timeManager->getTimeSinceSDLInitializationInMilliseconds();
+	context->gameTimedProceduresScheduler.update( context->timeManager->getTimeSinceSDLInitializationInNanoseconds() );
+}
+
+void Comp2D::Game::completeAsyncStateTransition()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game completeAsyncStateTransition\n" );
+	#endif
+
+	delete context->asyncStateTransitionResourcesPreload;
+	context->asyncStateTransitionResourcesPreload = nullptr;
+
+	context->gameStates[context->currentStateID]->keepResourcesLoaded( context->gameStates[context->asyncStateTransitionNextStateID]->m_resourceComponentsResourcesNames );
+	context->gameStates[context->currentStateID]->finalize();
+
+	context->currentStateID = context->asyncStateTransitionNextStateID;
+	context->timeManager->setFixedDeltaTime( context->asyncStateTransitionNextStateFixedDeltaTimeInSeconds );
+	// Everything is loaded by now, so this only solves dependencies and
+	// initializes behaviors and components
+	context->gameStates[context->currentStateID]->initialize();
+	context->timeManager->setCurrentStateInitializedTime( context->timeManager->getTimeSinceSDLInitializationInNanoseconds() );
+
+	resetFrameClock();
+}
+
+void Comp2D::Game::logInputsReplayReport()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game logInputsReplayReport\n" );
+	#endif
+
+	SDL_LogInfo
+	(
+		SDL_LOG_CATEGORY_APPLICATION,
+		"Inputs replay finished: %llu frames; frame time p50 = %llu ns, p95 = %llu ns, p99 = %llu ns, maximum = %llu ns; %llu frames over budget\n",
+		static_cast<unsigned long long>( context->inputsRecording->getFramesCount() ),
+		static_cast<unsigned long long>( context->frameStatistics.getFrameTimePercentileInNanoseconds( 50.0f ) ),
+		static_cast<unsigned long long>( context->frameStatistics.getFrameTimePercentileInNanoseconds( 95.0f ) ),
+		static_cast<unsigned long long>( context->frameStatistics.getFrameTimePercentileInNanoseconds( 99.0f ) ),
+		static_cast<unsigned long long>( context->frameStatistics.getMaximumFrameTimeInNanoseconds() ),
+		static_cast<unsigned long long>( context->frameStatistics.getOverBudgetFramesCount() )
+	);
+}
+
+void Comp2D::Game::pauseGameTimedProcedures()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game pauseGameTimedProcedures\n" );
+	#endif
+
+	context->gameTimedProceduresScheduler.pause( context->timeManager->getTimeSinceSDLInitializationInNanoseconds() );
+}
+
+void Comp2D::Game::performStateTransition()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game performStateTransition\n" );
+	#endif
+
+	if( context->nextStateID == context->currentStateID )
+	{
+		context->gameStates[context->currentStateID]->resetState();
+	}
+	else
+	{
+		context->gameStates[context->currentStateID]->finalize();
+
+		context->currentStateID = context->nextStateID;
+		context->timeManager->setFixedDeltaTime( gameSettings->timeSettings.getFixedDeltaTimeInSeconds() );
+		context->gameStates[context->currentStateID]->runSetup();
+		context->gameStates[context->currentStateID]->initialize();
+		context->timeManager->setCurrentStateInitializedTime( context->timeManager->getTimeSinceSDLInitializationInNanoseconds() );
+	}
+
+	context->inStateTransition = false;
+
+	resetFrameClock();
+
+	//timeSinceFirstFrameTimer.start();
+}
+
+void Comp2D::Game::resetFrameClock()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game resetFrameClock\n" );
+	#endif
+
+	context->timeOnLastFrameStarted = context->timeManager->getTimeSinceSDLInitializationInNanoseconds();
+
+	context->fixedUpdatesAccumulatedTimeInSeconds = 0.0f;
+
+	context->timeManager->setFixedTimeStepInterpolationFactor( 0.0f );
+}
+
+void Comp2D::Game::runContextTick()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game runContextTick\n" );
+	#endif
+
+	if( updateStateTransitions() )
+	{
+		return;
+	}
+
+	// Like the headless loop, every tick simulates exactly one fixed step
+	Uint64 simulatedStepInNanoseconds = Comp2D::Time::secondsToNanoseconds( context->timeManager->getFixedDeltaTimeInSeconds() );
+
+	context->timeManager->advanceSimulatedClock( simulatedStepInNanoseconds );
+	context->timeManager->setDeltaTime( simulatedStepInNanoseconds );
+
+	context->timeOnLastFrameStarted = context->timeManager->getTimeSinceSDLInitializationInNanoseconds();
+
+	runSimulationFrame();
+
+	context->frameStatistics.addFrameTime( context->simulationFrameDurationInNanoseconds );
+
+	context->timeManager->setFramePhaseDuration( Comp2D::Time::EFramePhase::Render, 0 );
+	context->timeManager->setFramePhaseDuration( Comp2D::Time::EFramePhase::Present, 0 );
+	context->timeManager->setFramePhaseDuration( Comp2D::Time::EFramePhase::Events, 0 );
+	context->timeManager->setFramePhaseDuration( Comp2D::Time::EFramePhase::Update, context->simulationFrameDurationInNanoseconds );
+}
+
+void Comp2D::Game::runFixedUpdates()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game runFixedUpdates\n" );
+	#endif
+
+	context->fixedUpdatesAccumulatedTimeInSeconds += context->timeManager->getScaledDeltaTimeInSeconds();
+
+	float fixedDeltaTimeInSeconds = context->timeManager->getFixedDeltaTimeInSeconds();
+	Uint32 maximumFixedUpdatesPerFrame = gameSettings->timeSettings.getMaximumFixedUpdatesPerFrame();
 
 	for
 	(
-		std::list<Comp2D::Time::TimedProcedure*>::iterator gameTimedProcedureIt = gameTimedProcedures.begin();
-		gameTimedProcedureIt != gameTimedProcedures.end();
-		++gameTimedProcedureIt
+		Uint32 fixedUpdatesCount = 0;
+		context->fixedUpdatesAccumulatedTimeInSeconds >= fixedDeltaTimeInSeconds &&
+		fixedUpdatesCount < maximumFixedUpdatesPerFrame &&
+		!context->inStateTransition;
+		++fixedUpdatesCount
 	)
 	{
-		Comp2D::Time::TimedProcedure* currentGameTimedProcedure = (*gameTimedProcedureIt);
+		context->gameStates[context->currentStateID]->fixedUpdate();
 
-		if( currentGameTimedProcedure->checkCallbackTime( currentTime ) )
-		{
-			gamePausableTimedProcedures.remove( currentGameTimedProcedure );
-			gameTimedProcedures.remove( currentGameTimedProcedure );
-			delete currentGameTimedProcedure;
+		context->fixedUpdatesAccumulatedTimeInSeconds -= fixedDeltaTimeInSeconds;
+	}
 
-			--gameTimedProcedureIt;
-		}
+	// Drops the time that could not be simulated, so a long frame does not
+	// snowball into more catch-up steps on the next ones
+	if( context->fixedUpdatesAccumulatedTimeInSeconds >= fixedDeltaTimeInSeconds )
+	{
+		context->fixedUpdatesAccumulatedTimeInSeconds = fmod( context->fixedUpdatesAccumulatedTimeInSeconds, fixedDeltaTimeInSeconds );
 	}
+
+	context->timeManager->setFixedTimeStepInterpolationFactor( context->fixedUpdatesAccumulatedTimeInSeconds / fixedDeltaTimeInSeconds );
 }
 
-void Comp2D::Game::pauseGameTimedProcedures()
+void Comp2D::Game::runSimulationFrame()
 {
 	#ifdef DEBUG
-		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game pauseGameTimedProcedures\n" );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game runSimulationFrame\n" );
+	#endif
+
+	COMP2D_PROFILE_ZONE( "Game::runSimulationFrame" );
+
+	Uint64 timeOnSimulationFrameStarted = context->timeManager->getRealTimeSinceSDLInitializationInNanoseconds();
+
+	// The contexts update loop drains them on the game thread instead, as
+	// the contexts simulate in parallel
+	if( !contextsStarted )
+	{
+		runPostedProcedures();
+	}
+
+	checkGameTimedProcedures();
+	Comp2D::States::GameState::checkGameStateTimedProcedures();
+	waitForDoneSeparateThreadsFunctions();
+
+	runFixedUpdates();
+	context->gameStates[context->currentStateID]->update();
+
+	context->simulationFrameDurationInNanoseconds = context->timeManager->getRealTimeSinceSDLInitializationInNanoseconds() - timeOnSimulationFrameStarted;
+}
+
+void Comp2D::Game::runPostedProcedures()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game runPostedProcedures\n" );
 	#endif
 
+	Comp2D::GameContext* runningContext = context;
+	Comp2D::GameContext* postingContext = nullptr;
+
+	std::function<void()> postedProcedure;
+
+	Uint32 maximumPostedProceduresPerFrame = gameSettings->timeSettings.getMaximumPostedProceduresPerFrame();
+
 	for
 	(
-		std::list<Comp2D::Time::TimedProcedure*>::iterator gamePausableTimedProcedureIt = gamePausableTimedProcedures.begin();
-		gamePausableTimedProcedureIt != gamePausableTimedProcedures.end();
-		++gamePausableTimedProcedureIt
+		Uint32 i = 0;
+		i < maximumPostedProceduresPerFrame && postedProceduresQueue->pop( postedProcedure, postingContext );
+		++i
 	)
 	{
-		(*gamePausableTimedProcedureIt)->pause();
+		// Procedures posted from threads the engine did not start, such as
+		// the SDL audio callbacks, have no context
+		context = postingContext != nullptr ? postingContext : runningContext;
+
+		postedProcedure();
+		postedProcedure = nullptr;
 	}
+
+	context = runningContext;
 }
 
 void Comp2D::Game::unpauseGameTimedProcedures()
@@ -821,59 +1819,117 @@ void Comp2D::Game::unpauseGameTimedProcedures()
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game unpauseGameTimedProcedures\n" );
 	#endif
 
-	for
-	(
-		std::list<Comp2D::Time::TimedProcedure*>::iterator gamePausableTimedProcedureIt = gamePausableTimedProcedures.begin();
-		gamePausableTimedProcedureIt != gamePausableTimedProcedures.end();
-		++gamePausableTimedProcedureIt
-	)
+	context->gameTimedProceduresScheduler.unpause( context->timeManager->getTimeSinceSDLInitializationInNanoseconds() );
+}
+
+void Comp2D::Game::updateAverageFramePerSecond()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game updateAverageFramePerSecond\n" );
+	#endif
+
+	++context->totalRenderedFrames;
+
+	context->averageFramesPerSecond = static_cast<Uint32>
+	(
+		round
+		(
+			static_cast<double>( context->totalRenderedFrames ) /
+			( static_cast<double>( context->timeSinceFirstFrameTimer.getElapsedTimeInNanoseconds() ) / static_cast<double>( Comp2D::Time::NANOSECONDS_IN_SECOND ) )
+		)
+	);
+}
+
+void Comp2D::Game::updateFramesPerSecond()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game updateFramesPerSecond\n" );
+	#endif
+
+	++context->totalRenderedFramesSinceLastFPSUpdate;
+
+	if( ( context->timeOnLastFrameStarted - context->lastFPSUpdateTime ) >= Comp2D::Time::NANOSECONDS_IN_SECOND )
+	{
+		context->framesPerSecond = context->totalRenderedFramesSinceLastFPSUpdate;
+
+		context->totalRenderedFramesSinceLastFPSUpdate = 0;
+		context->lastFPSUpdateTime = context->timeOnLastFrameStarted;
+	}
+}
+
+void Comp2D::Game::updateFramesPerSecondThroughDeltaTime()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game updateFramesPerSecondThroughDeltaTime\n" );
+	#endif
+
+	if( context->timeManager->getDeltaTimeInNanoseconds() > 0 )
 	{
-		(*gamePausableTimedProcedureIt)->unpause();
+		context->framesPerSecondThroughDeltaTime = static_cast<Uint32>
+		(
+			round( static_cast<double>( Comp2D::Time::NANOSECONDS_IN_SECOND ) / static_cast<double>( context->timeManager->getDeltaTimeInNanoseconds() ) )
+		);
 	}
 }
 
-void Comp2D::Game::updateAverageFramePerSecond()
+void Comp2D::Game::waitForEventsUntil( Uint64 wakeUpTimeInNanoseconds )
 {
 	#ifdef DEBUG
-		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game updateAverageFramePerSecond\n" );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game waitForEventsUntil: wakeUpTimeInNanoseconds = %" SDL_PRIu64 "\n", wakeUpTimeInNanoseconds );
 	#endif
 
-	++totalRenderedFrames;
+	SDL_Event e;
 
-	averageFramesPerSecond = static_cast<Uint32>
-	(
-		round
-		(
-			static_cast<double>( totalRenderedFrames ) /
-			( static_cast<double>( timeSinceFirstFrameTimer.getElapsedTimeInMilliseconds() ) / 1000.0 )
-		)
-	);
+	Uint64 currentTimeInNanoseconds = context->timeManager->getTimeSinceSDLInitializationInNanoseconds();
+
+	// Sleeps inside SDL until an event arrives or the next tick is due, the
+	// events are only stored so both loops can dispatch them when it is safe
+	while( currentTimeInNanoseconds < wakeUpTimeInNanoseconds )
+	{
+		Uint32 timeoutInMilliseconds = Comp2D::Time::nanosecondsToMilliseconds( wakeUpTimeInNanoseconds - currentTimeInNanoseconds );
+
+		if( timeoutInMilliseconds == 0 )
+		{
+			break;
+		}
+
+		if( SDL_WaitEventTimeout( &e, static_cast<int>( timeoutInMilliseconds ) ) != 0 )
+		{
+			pendingEvents.push_back( e );
+		}
+
+		currentTimeInNanoseconds = context->timeManager->getTimeSinceSDLInitializationInNanoseconds();
+	}
 }
 
-void Comp2D::Game::updateFramesPerSecond()
+void Comp2D::Game::updateQualityGovernor( Uint64 frameTimeInNanoseconds )
 {
 	#ifdef DEBUG
-		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game updateFramesPerSecond\n" );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game updateQualityGovernor: frameTimeInNanoseconds = %" SDL_PRIu64 "\n", frameTimeInNanoseconds );
 	#endif
 
-	++totalRenderedFramesSinceLastFPSUpdate;
-
-	if( ( timeOnLastFrameFinishedRendering - lastFPSUpdateTime ) >= 1000 )
+	if( !gameSettings->isAdaptiveQualityEnabled() )
 	{
-		framesPerSecond = totalRenderedFramesSinceLastFPSUpdate;
-
-		totalRenderedFramesSinceLastFPSUpdate = 0;
-		lastFPSUpdateTime = SDL_GetTicks();
+		return;
 	}
+
+	// Waiting on the display to present is not work the governor can reduce
+	Uint64 presentDurationInNanoseconds = context->timeManager->getFramePhaseDurationInNanoseconds( Comp2D::Time::EFramePhase::Present );
+
+	context->qualityGovernor.addFrameWorkTime
+	(
+		frameTimeInNanoseconds > presentDurationInNanoseconds ? frameTimeInNanoseconds - presentDurationInNanoseconds : 0
+	);
 }
 
-void Comp2D::Game::updateFramesPerSecondThroughDeltaTime()
+void Comp2D::Game::waitForDoneSeparateThreadsFunctions()
 {
 	#ifdef DEBUG
-		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game updateFramesPerSecondThroughDeltaTime\n" );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game waitForDoneSeparateThreadsFunctions\n" );
 	#endif
 
-	framesPerSecondThroughDeltaTime = static_cast<Uint32>( round( 1.0f / timeManager->getDeltaTimeInSeconds() ) );
+	Comp2D::Jobs::SeparateThreadFunctionCall::waitForDone( context->gameSeparateThreadFunctions );
+	Comp2D::Jobs::SeparateThreadFunctionCall::waitForDone( context->gameStates[context->currentStateID]->m_separateThreadFunctions );
 }
 
 void Comp2D::Game::callFunctionAfterTimeOnSeparateThread
@@ -895,16 +1951,12 @@ void Comp2D::Game::callFunctionAfterTimeOnSeparateThread
 
 	//typedef Uint32 function_t( Uint32, void* );
 
-	gameTimerFunctionsIDs.push_back
-	(
-		SDL_AddTimer
-		(
-			callbackTimeInMilliseconds,
-			//timerFunction.target<function_t>(),
-			timerFunction,
-			param
-		)
-	);
+	SDL_TimerID timerFunctionID = Comp2D::Jobs::TimerFunctionCall::start( timerFunction, param, callbackTimeInMilliseconds );
+
+	if( timerFunctionID != 0 )
+	{
+		context->gameTimerFunctionsIDs.push_back( timerFunctionID );
+	}
 }
 
 void Comp2D::Game::callFunctionOnSeparateThread
@@ -918,18 +1970,15 @@ void Comp2D::Game::callFunctionOnSeparateThread
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game callFunctionOnSeparateThread: threadName = %s\n", threadName.c_str() );
 	#endif
 
-	gameSeparateThreadFunctions.push_back
-	(
-		SDL_CreateThread
-		(
-			separateThreadFunction,
-			threadName.c_str(),
-			data
-		)
-	);
+	Comp2D::Jobs::SeparateThreadFunctionCall* separateThreadFunctionCall = Comp2D::Jobs::SeparateThreadFunctionCall::start( separateThreadFunction, data, threadName );
+
+	if( separateThreadFunctionCall != nullptr )
+	{
+		context->gameSeparateThreadFunctions.push_back( separateThreadFunctionCall );
+	}
 }
 
-void Comp2D::Game::callProcedureAfterTimeOnGameThread
+Comp2D::Time::TimedProcedureHandle Comp2D::Game::callProcedureAfterTimeOnGameThread
 (
 	std::function<void()> timedProcedure,
 	Uint32 callbackTimeInMilliseconds,
@@ -948,25 +1997,13 @@ void Comp2D::Game::callProcedureAfterTimeOnGameThread
 		);
 	#endif
 
-	Comp2D::Time::TimedProcedure* createdGameTimedProcedure = new Comp2D::Time::TimedProcedure
+	return context->gameTimedProceduresScheduler.schedule
 	(
-		gameTimedProcedureID++,
 		timedProcedure,
-		timeManager->getTimeSinceSDLInitializationInMilliseconds() + callbackTimeInMilliseconds,
-		pausable
+		Comp2D::Time::millisecondsToNanoseconds( callbackTimeInMilliseconds ),
+		pausable,
+		context->timeManager->getTimeSinceSDLInitializationInNanoseconds()
 	);
-
-	if( createdGameTimedProcedure->isPausable() )
-	{
-		if( paused )
-		{
-			createdGameTimedProcedure->pause();
-		}
-
-		gamePausableTimedProcedures.push_back( createdGameTimedProcedure );
-	}
-
-	gameTimedProcedures.push_back( createdGameTimedProcedure );
 }
 
 void Comp2D::Game::pause( bool pauseTimeScale )
@@ -975,34 +2012,56 @@ void Comp2D::Game::pause( bool pauseTimeScale )
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game pause\n" );
 	#endif
 
-	if( !paused )
+	if( !context->paused )
 	{
-		timeManager->pause();
+		context->timeManager->pause();
 
 		pauseGameTimedProcedures();
 
 		if( pauseTimeScale )
 		{
-			timeScaleOnPaused = timeManager->getTimeScale();
+			context->timeScaleOnPaused = context->timeManager->getTimeScale();
 
-			timeManager->setTimeScale( 0.0f );
+			context->timeManager->setTimeScale( 0.0f );
 
-			pausedTimeScale = true;
+			context->pausedTimeScale = true;
 		}
 
-		gameStates[currentStateID]->pause();
+		context->gameStates[context->currentStateID]->pause();
 
-		paused = true;
+		context->paused = true;
 	}
 }
 
+void Comp2D::Game::postProcedureToGameThread( std::function<void()> procedure )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game postProcedureToGameThread\n" );
+	#endif
+
+	postedProceduresQueue->push( std::move( procedure ), context );
+}
+
 void Comp2D::Game::quitGame()
 {
 	#ifdef DEBUG
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game quitGame\n" );
 	#endif
 
-	quit = true;
+	// Errors may be reported from threads working on no context
+	if( context )
+	{
+		context->quit = true;
+	}
+}
+
+void Comp2D::Game::resetFrameStatistics()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game resetFrameStatistics\n" );
+	#endif
+
+	context->frameStatistics.reset();
 }
 
 void Comp2D::Game::reportError
@@ -1037,13 +2096,21 @@ void Comp2D::Game::reportError
 
 	errorTextStringStream << '\n';
 
-	SDL_ShowSimpleMessageBox
-	(
-		SDL_MESSAGEBOX_ERROR,
-		errorTitle.c_str(),
-		errorTextStringStream.str().c_str(),
-		window
-	);
+	// Nobody is there to close a message box while headless
+	if( gameSettings && gameSettings->isHeadless() )
+	{
+		SDL_LogError( SDL_LOG_CATEGORY_APPLICATION, "%s: %s", errorTitle.c_str(), errorTextStringStream.str().c_str() );
+	}
+	else
+	{
+		SDL_ShowSimpleMessageBox
+		(
+			SDL_MESSAGEBOX_ERROR,
+			errorTitle.c_str(),
+			errorTextStringStream.str().c_str(),
+			window
+		);
+	}
 
 	if( quitGameAfterReport )
 	{
@@ -1065,16 +2132,21 @@ void Comp2D::Game::setCameraPosition( const b2Vec2& position )
 		*/
 	#endif
 
-	cameraPosition.x = position.x;
-	cameraPosition.y = position.y;
+	context->cameraPosition.x = position.x;
+	context->cameraPosition.y = position.y;
 }
 
-void Comp2D::Game::start()
+void Comp2D::Game::start( int argc, char* argv[] )
 {
 	#ifdef DEBUG
-		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game start\n" );
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game start: argc = %i\n", argc );
 	#endif
 
+	commandLineArgumentsCount = argc;
+	commandLineArguments = argv;
+
+	context = new Comp2D::GameContext();
+
 	if( initialize() )
 	{
 		startUpdateLoop();
@@ -1087,6 +2159,64 @@ void Comp2D::Game::start()
 	}
 
 	finalize();
+
+	delete context;
+	context = nullptr;
+}
+
+void Comp2D::Game::startContexts( Uint32 contextsCount, int argc, char* argv[] )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game startContexts: contextsCount = %u; argc = %i\n", contextsCount, argc );
+	#endif
+
+	commandLineArgumentsCount = argc;
+	commandLineArguments = argv;
+	contextsStarted = true;
+
+	std::vector<Comp2D::GameContext*> contexts;
+
+	// The first context is initialized and finalized along with the engine
+	contexts.push_back( new Comp2D::GameContext() );
+	context = contexts.front();
+
+	if( initialize() )
+	{
+		for( Uint32 i = 1; i < contextsCount; ++i )
+		{
+			contexts.push_back( new Comp2D::GameContext() );
+			context = contexts.back();
+
+			initializeContext();
+		}
+
+		startContextsUpdateLoop( contexts );
+	}
+	else
+	{
+		#ifdef DEBUG
+			SDL_LogError( SDL_LOG_CATEGORY_APPLICATION, "Failed to initialize!\n" );
+		#endif
+	}
+
+	while( contexts.size() > 1 )
+	{
+		context = contexts.back();
+
+		finalizeContext();
+
+		delete context;
+		contexts.pop_back();
+	}
+
+	context = contexts.front();
+
+	finalize();
+
+	delete context;
+	context = nullptr;
+
+	contextsStarted = false;
 }
 
 void Comp2D::Game::startStateTransition( Uint32 nextStateID )
@@ -1095,8 +2225,8 @@ void Comp2D::Game::startStateTransition( Uint32 nextStateID )
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game startStateTransition: nextStateID = %u\n", nextStateID );
 	#endif
 
-	Comp2D::Game::nextStateID = nextStateID;
-	inStateTransition = true;
+	context->nextStateID = nextStateID;
+	context->inStateTransition = true;
 
 	/*
 	if( nextStateID == currentStateID )
@@ -1117,23 +2247,64 @@ void Comp2D::Game::unpause()
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game unpause\n" );
 	#endif
 
-	if( paused )
+	if( context->paused )
 	{
-		if( pausedTimeScale )
+		if( context->pausedTimeScale )
 		{
-			timeManager->setTimeScale( timeScaleOnPaused );
+			context->timeManager->setTimeScale( context->timeScaleOnPaused );
 
-			pausedTimeScale = false;
+			context->pausedTimeScale = false;
 		}
 
-		gameStates[currentStateID]->unpause();
+		context->gameStates[context->currentStateID]->unpause();
 
 		unpauseGameTimedProcedures();
 
-		timeManager->unpause();
+		context->timeManager->unpause();
+
+		context->paused = false;
+	}
+}
+
+bool Comp2D::Game::startAsyncStateTransition( Uint32 nextStateID, Uint32 loadingStateID )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game startAsyncStateTransition: nextStateID = %u; loadingStateID = %u\n", nextStateID, loadingStateID );
+	#endif
+
+	if
+	(
+		context->inStateTransition ||
+		isInAsyncStateTransition() ||
+		nextStateID >= NUMBER_OF_STATES ||
+		( loadingStateID != NO_STATE_ID && ( loadingStateID >= NUMBER_OF_STATES || loadingStateID == nextStateID ) )
+	)
+	{
+		return false;
+	}
+
+	// Resetting the current GameState cannot overlap with itself
+	if( nextStateID == context->currentStateID )
+	{
+		startStateTransition( nextStateID );
 
-		paused = false;
+		return true;
 	}
+
+	context->asyncStateTransitionNextStateID = nextStateID;
+	context->asyncStateTransitionLoadingStateID = loadingStateID;
+	context->asyncStateTransitionRequested = true;
+
+	return true;
+}
+
+bool Comp2D::Game::isInAsyncStateTransition()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game isInAsyncStateTransition\n" );
+	#endif
+
+	return context->asyncStateTransitionRequested || context->asyncStateTransitionResourcesPreload != nullptr;
 }
 
 bool Comp2D::Game::isPaused()
@@ -1142,7 +2313,74 @@ bool Comp2D::Game::isPaused()
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game isPaused\n" );
 	#endif
 
-	return paused;
+	return context->paused;
+}
+
+bool Comp2D::Game::isUpdateLoopThrottled( bool windowHidden )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game isUpdateLoopThrottled: windowHidden = %i\n", windowHidden );
+	#endif
+
+	return
+		context->paused ||
+		windowHidden ||
+		(
+			gameSettings->timeSettings.isThrottleWhenUnfocusedEnabled() &&
+			( SDL_GetWindowFlags( window ) & SDL_WINDOW_INPUT_FOCUS ) == 0
+		);
+}
+
+bool Comp2D::Game::isWindowHidden()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game isWindowHidden\n" );
+	#endif
+
+	return ( SDL_GetWindowFlags( window ) & ( SDL_WINDOW_HIDDEN | SDL_WINDOW_MINIMIZED ) ) != 0;
+}
+
+Uint64 Comp2D::Game::getThrottledTickIntervalInNanoseconds()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game getThrottledTickIntervalInNanoseconds\n" );
+	#endif
+
+	return Comp2D::Time::secondsToNanoseconds( 1.0f / gameSettings->timeSettings.getThrottledTicksPerSecond() );
+}
+
+Comp2D::States::GameState* Comp2D::Game::createState( Uint32 stateID )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game createState: stateID = %u\n", stateID );
+	#endif
+
+	switch( stateID )
+	{
+		// Add States Here
+		case FIRST_STATE_ID:
+			return new Comp2D::States::GameState( stateID );
+	}
+
+	return nullptr;
+}
+
+Comp2D::States::GameState* Comp2D::Game::getState( Uint32 stateID )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game getState: stateID = %u\n", stateID );
+	#endif
+
+	if( context->gameStates[stateID] == nullptr )
+	{
+		Uint64 stateCreationStartCounter = SDL_GetPerformanceCounter();
+
+		context->gameStates[stateID] = createState( stateID );
+
+		Comp2D::Time::StartupReport::addSubsystemTime( "GameState creation", stateCreationStartCounter );
+	}
+
+	return context->gameStates[stateID];
 }
 
 Uint32 Comp2D::Game::getAverageFramesPerSecond()
@@ -1151,7 +2389,7 @@ Uint32 Comp2D::Game::getAverageFramesPerSecond()
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game getAverageFramePerSecond\n" );
 	#endif
 
-	return averageFramesPerSecond;
+	return context->averageFramesPerSecond;
 }
 
 Uint32 Comp2D::Game::getCurrentStateID()
@@ -1160,7 +2398,7 @@ Uint32 Comp2D::Game::getCurrentStateID()
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game getCurrentStateID\n" );
 	#endif
 
-	return currentStateID;
+	return context->currentStateID;
 }
 
 Uint32 Comp2D::Game::getFramesPerSecond()
@@ -1169,7 +2407,7 @@ Uint32 Comp2D::Game::getFramesPerSecond()
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game getFramesPerSecond\n" );
 	#endif
 
-	return framesPerSecond;
+	return context->framesPerSecond;
 }
 
 Uint32 Comp2D::Game::getFramesPerSecondThroughDeltaTime()
@@ -1178,7 +2416,7 @@ Uint32 Comp2D::Game::getFramesPerSecondThroughDeltaTime()
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game getFramesPerSecondThroughDeltaTime\n" );
 	#endif
 
-	return framesPerSecondThroughDeltaTime;
+	return context->framesPerSecondThroughDeltaTime;
 }
 
 Uint32 Comp2D::Game::getWindowPixelFormat()
@@ -1190,13 +2428,76 @@ Uint32 Comp2D::Game::getWindowPixelFormat()
 	return windowPixelFormat;
 }
 
+Uint64 Comp2D::Game::getFrameTimePercentileInNanoseconds( float percentile )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game getFrameTimePercentileInNanoseconds\n" );
+	#endif
+
+	return context->frameStatistics.getFrameTimePercentileInNanoseconds( percentile );
+}
+
+Uint64 Comp2D::Game::getFrameTimeP50InNanoseconds()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game getFrameTimeP50InNanoseconds\n" );
+	#endif
+
+	return context->frameStatistics.getFrameTimePercentileInNanoseconds( 50.0f );
+}
+
+Uint64 Comp2D::Game::getFrameTimeP95InNanoseconds()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game getFrameTimeP95InNanoseconds\n" );
+	#endif
+
+	return context->frameStatistics.getFrameTimePercentileInNanoseconds( 95.0f );
+}
+
+Uint64 Comp2D::Game::getFrameTimeP99InNanoseconds()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game getFrameTimeP99InNanoseconds\n" );
+	#endif
+
+	return context->frameStatistics.getFrameTimePercentileInNanoseconds( 99.0f );
+}
+
+Uint64 Comp2D::Game::getMaximumFrameTimeInNanoseconds()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game getMaximumFrameTimeInNanoseconds\n" );
+	#endif
+
+	return context->frameStatistics.getMaximumFrameTimeInNanoseconds();
+}
+
+Uint64 Comp2D::Game::getFrameTimeHistogramBucketFramesCount( Uint32 bucketIndex )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game getFrameTimeHistogramBucketFramesCount\n" );
+	#endif
+
+	return context->frameStatistics.getHistogramBucketFramesCount( bucketIndex );
+}
+
+Uint64 Comp2D::Game::getOverBudgetFramesCount()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game getOverBudgetFramesCount\n" );
+	#endif
+
+	return context->frameStatistics.getOverBudgetFramesCount();
+}
+
 float Comp2D::Game::getCameraPositionX()
 {
 	#ifdef DEBUG
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game getCameraPositionX\n" );
 	#endif
 
-	return cameraPosition.x;
+	return context->cameraPosition.x;
 }
 
 float Comp2D::Game::getCameraPositionY()
@@ -1205,7 +2506,62 @@ float Comp2D::Game::getCameraPositionY()
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game getCameraPositionY\n" );
 	#endif
 
-	return cameraPosition.y;
+	return context->cameraPosition.y;
+}
+
+float Comp2D::Game::getStateTransitionProgress()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game getStateTransitionProgress\n" );
+	#endif
+
+	if( context->asyncStateTransitionResourcesPreload )
+	{
+		return context->asyncStateTransitionResourcesPreload->getProgress();
+	}
+
+	if( context->asyncStateTransitionRequested )
+	{
+		return 0.0f;
+	}
+
+	return 1.0f;
+}
+
+Comp2D::Quality::QualityGovernor* Comp2D::Game::getQualityGovernor()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game getQualityGovernor\n" );
+	#endif
+
+	return &context->qualityGovernor;
+}
+
+Comp2D::Random::RandomNumberGenerator* Comp2D::Game::getRandomNumberGenerator()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game getRandomNumberGenerator\n" );
+	#endif
+
+	return context->randomNumberGenerator;
+}
+
+Comp2D::Resources::ResourcesManager* Comp2D::Game::getResourcesManager()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game getResourcesManager\n" );
+	#endif
+
+	return context->resourcesManager;
+}
+
+Comp2D::Time::TimeManager* Comp2D::Game::getTimeManager()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game getTimeManager\n" );
+	#endif
+
+	return context->timeManager;
 }
 
 Comp2D::Utilities::Vector2D<int> Comp2D::Game::getCameraScreenPosition()
@@ -1214,8 +2570,8 @@ Comp2D::Utilities::Vector2D<int> Comp2D::Game::getCameraScreenPosition()
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game getCameraScreenPosition\n" );
 	#endif
 
-	int screenX = static_cast<int>( round( cameraPosition.x - Comp2D::Game::getCameraPositionX() ) );
-	int screenY = static_cast<int>( round( cameraPosition.y - Comp2D::Game::getCameraPositionY() ) );
+	int screenX = static_cast<int>( round( context->cameraPosition.x - Comp2D::Game::getCameraPositionX() ) );
+	int screenY = static_cast<int>( round( context->cameraPosition.y - Comp2D::Game::getCameraPositionY() ) );
 
 	return Comp2D::Utilities::Vector2D<int>( screenX, screenY );
 }
@@ -1226,5 +2582,5 @@ const b2Vec2& Comp2D::Game::getCameraPosition()
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Game getCameraPosition\n" );
 	#endif
 
-	return cameraPosition;
+	return context->cameraPosition;
 }
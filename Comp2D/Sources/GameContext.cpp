@@ -0,0 +1,103 @@
+/* GameContext.cpp -- 'Comp2D' Game Engine 'GameContext' class source file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#include "Comp2D/Headers/GameContext.h"
+
+#include <SDL.h>
+
+#include "Box2D/Common/b2Math.h"
+
+#include "Comp2D/Headers/Game.h"
+
+Comp2D::GameContext::GameContext()
+	:
+	asyncStateTransitionRequested{ false },
+	inStateTransition{ false },
+	paused{ false },
+	pausedTimeScale{ false },
+	previousFrameThrottled{ false },
+	quit{ false },
+	asyncStateTransitionLoadingStateID{ Comp2D::Game::NO_STATE_ID },
+	asyncStateTransitionNextStateID{ 0 },
+	averageFramesPerSecond{ 0 },
+	currentStateID{ 0 },
+	framesPerSecond{ 0 },
+	framesPerSecondThroughDeltaTime{ 0 },
+	nextStateID{ 0 },
+	totalRenderedFramesSinceLastFPSUpdate{ 0 },
+	lastFPSUpdateTime{ 0 },
+	simulationFrameDurationInNanoseconds{ 0 },
+	timeOnLastFrameStarted{ 0 },
+	totalRenderedFrames{ 0 },
+	asyncStateTransitionNextStateFixedDeltaTimeInSeconds{ 0.0f },
+	fixedUpdatesAccumulatedTimeInSeconds{ 0.0f },
+	timeScaleOnPaused{ 0.0f },
+	cameraPosition( b2Vec2_zero ),
+	inputsRecording{ nullptr },
+	randomNumberGenerator{ nullptr },
+	resourcesManager{ nullptr },
+	asyncStateTransitionResourcesPreload{ nullptr },
+	gameStates{ nullptr },
+	settingUpGameState{ nullptr },
+	timeManager{ nullptr }
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameContext Constructor body Start\n" );
+	#endif
+
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameContext Constructor body End\n" );
+	#endif
+}
+
+Comp2D::GameContext::~GameContext()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameContext Destroying\n" );
+	#endif
+
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameContext Destroyed\n" );
+	#endif
+}
+
+void Comp2D::GameContext::setCurrent( GameContext* gameContext )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameContext setCurrent\n" );
+	#endif
+
+	Comp2D::Game::context = gameContext;
+}
+
+Comp2D::GameContext* Comp2D::GameContext::getCurrent()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameContext getCurrent\n" );
+	#endif
+
+	return Comp2D::Game::context;
+}
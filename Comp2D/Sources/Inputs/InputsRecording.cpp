@@ -0,0 +1,432 @@
+/* InputsRecording.cpp -- 'Comp2D' Game Engine 'InputsRecording' class source file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#include "Comp2D/Headers/Inputs/InputsRecording.h"
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+
+#include "Comp2D/Headers/Inputs/Keyboard.h"
+#include "Comp2D/Headers/Inputs/Mouse.h"
+
+Comp2D::Inputs::InputsRecording::InputsRecording()
+	:
+	m_recording{ false },
+	m_replaying{ false },
+	m_mouseX{ 0 },
+	m_mouseY{ 0 },
+	m_randomSeed{ 0 },
+	m_mouseState{ 0 },
+	m_framesCount{ 0 },
+	m_fixedDeltaTimeInSeconds{ 0.0f },
+	m_replayPosition{ 0 }
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "InputsRecording Constructor body Start\n" );
+	#endif
+
+	std::memset( m_keyboardState, 0, sizeof( m_keyboardState ) );
+
+	m_changedKeysScancodes.reserve( Comp2D::Inputs::Keyboard::KEYBOARD_NUM_KEYS );
+
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "InputsRecording Constructor body End\n" );
+	#endif
+}
+
+Comp2D::Inputs::InputsRecording::~InputsRecording()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "InputsRecording Destroying\n" );
+	#endif
+
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "InputsRecording Destroyed\n" );
+	#endif
+}
+
+bool Comp2D::Inputs::InputsRecording::readUnsignedInteger( Uint64& value )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "InputsRecording readUnsignedInteger\n" );
+	#endif
+
+	value = 0;
+
+	// Seven bits per byte, the highest one telling whether more bytes follow
+	for( unsigned int shift = 0; shift < 64; shift += 7 )
+	{
+		if( m_replayPosition >= m_data.size() )
+		{
+			return false;
+		}
+
+		Uint8 currentByte = m_data[m_replayPosition++];
+
+		value |= static_cast<Uint64>( currentByte & 0x7F ) << shift;
+
+		if( ( currentByte & 0x80 ) == 0 )
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void Comp2D::Inputs::InputsRecording::writeUnsignedInteger( Uint64 value, std::vector<Uint8>& data )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "InputsRecording writeUnsignedInteger\n" );
+	#endif
+
+	while( value >= 0x80 )
+	{
+		data.push_back( static_cast<Uint8>( value | 0x80 ) );
+		value >>= 7;
+	}
+
+	data.push_back( static_cast<Uint8>( value ) );
+}
+
+bool Comp2D::Inputs::InputsRecording::readSignedInteger( Sint64& value )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "InputsRecording readSignedInteger\n" );
+	#endif
+
+	Uint64 zigZagValue = 0;
+
+	if( !readUnsignedInteger( zigZagValue ) )
+	{
+		return false;
+	}
+
+	value = static_cast<Sint64>( zigZagValue >> 1 ) ^ -static_cast<Sint64>( zigZagValue & 1 );
+
+	return true;
+}
+
+void Comp2D::Inputs::InputsRecording::writeSignedInteger( Sint64 value, std::vector<Uint8>& data )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "InputsRecording writeSignedInteger\n" );
+	#endif
+
+	// Zig zag encoded, so small negative values stay short too
+	writeUnsignedInteger( ( static_cast<Uint64>( value ) << 1 ) ^ static_cast<Uint64>( value >> 63 ), data );
+}
+
+bool Comp2D::Inputs::InputsRecording::finishRecording()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "InputsRecording finishRecording: m_framesCount = %llu\n", m_framesCount );
+	#endif
+
+	if( !m_recording )
+	{
+		return false;
+	}
+
+	m_recording = false;
+
+	SDL_RWops* recordingFile = SDL_RWFromFile( m_recordingFilePath.c_str(), "wb" );
+
+	if( recordingFile == nullptr )
+	{
+		#ifdef DEBUG
+			SDL_LogError( SDL_LOG_CATEGORY_APPLICATION, "Unable to open inputs recording file %s! SDL Error: %s\n", m_recordingFilePath.c_str(), SDL_GetError() );
+		#endif
+
+		return false;
+	}
+
+	Uint32 fixedDeltaTimeInSecondsBits = 0;
+	std::memcpy( &fixedDeltaTimeInSecondsBits, &m_fixedDeltaTimeInSeconds, sizeof( fixedDeltaTimeInSecondsBits ) );
+
+	std::vector<Uint8> header;
+
+	writeUnsignedInteger( FORMAT_MAGIC, header );
+	writeUnsignedInteger( FORMAT_VERSION, header );
+	writeUnsignedInteger( m_randomSeed, header );
+	writeUnsignedInteger( fixedDeltaTimeInSecondsBits, header );
+
+	bool success =
+		SDL_RWwrite( recordingFile, header.data(), 1, header.size() ) == header.size() &&
+		SDL_RWwrite( recordingFile, m_data.data(), 1, m_data.size() ) == m_data.size();
+
+	SDL_RWclose( recordingFile );
+
+	return success;
+}
+
+bool Comp2D::Inputs::InputsRecording::loadReplay( const std::string& replayFilePath )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "InputsRecording loadReplay: replayFilePath = %s\n", replayFilePath.c_str() );
+	#endif
+
+	SDL_RWops* replayFile = SDL_RWFromFile( replayFilePath.c_str(), "rb" );
+
+	if( replayFile == nullptr )
+	{
+		#ifdef DEBUG
+			SDL_LogError( SDL_LOG_CATEGORY_APPLICATION, "Unable to open inputs replay file %s! SDL Error: %s\n", replayFilePath.c_str(), SDL_GetError() );
+		#endif
+
+		return false;
+	}
+
+	Sint64 replayFileSize = SDL_RWsize( replayFile );
+
+	bool success = replayFileSize > 0;
+
+	if( success )
+	{
+		m_data.resize( static_cast<std::size_t>( replayFileSize ) );
+
+		success = SDL_RWread( replayFile, m_data.data(), 1, m_data.size() ) == m_data.size();
+	}
+
+	SDL_RWclose( replayFile );
+
+	m_replayPosition = 0;
+
+	Uint64 formatMagic = 0;
+	Uint64 formatVersion = 0;
+	Uint64 randomSeed = 0;
+	Uint64 fixedDeltaTimeBits = 0;
+
+	success =
+		success &&
+		readUnsignedInteger( formatMagic ) &&
+		formatMagic == FORMAT_MAGIC &&
+		readUnsignedInteger( formatVersion ) &&
+		formatVersion == FORMAT_VERSION &&
+		readUnsignedInteger( randomSeed ) &&
+		readUnsignedInteger( fixedDeltaTimeBits );
+
+	if( !success )
+	{
+		#ifdef DEBUG
+			SDL_LogError( SDL_LOG_CATEGORY_APPLICATION, "Inputs replay file %s is not a valid inputs recording!\n", replayFilePath.c_str() );
+		#endif
+
+		m_data.clear();
+
+		return false;
+	}
+
+	Uint32 fixedDeltaTimeInSecondsBits = static_cast<Uint32>( fixedDeltaTimeBits );
+
+	m_randomSeed = static_cast<unsigned int>( randomSeed );
+	std::memcpy( &m_fixedDeltaTimeInSeconds, &fixedDeltaTimeInSecondsBits, sizeof( m_fixedDeltaTimeInSeconds ) );
+
+	std::memset( m_keyboardState, 0, sizeof( m_keyboardState ) );
+	m_mouseX = 0;
+	m_mouseY = 0;
+	m_mouseState = 0;
+	m_framesCount = 0;
+
+	m_replaying = true;
+
+	return true;
+}
+
+void Comp2D::Inputs::InputsRecording::startRecording( const std::string& recordingFilePath, float fixedDeltaTimeInSeconds )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "InputsRecording startRecording: recordingFilePath = %s\n", recordingFilePath.c_str() );
+	#endif
+
+	m_recordingFilePath = recordingFilePath;
+	m_randomSeed = 0;
+	m_fixedDeltaTimeInSeconds = fixedDeltaTimeInSeconds;
+
+	m_data.clear();
+
+	std::memset( m_keyboardState, 0, sizeof( m_keyboardState ) );
+	m_mouseX = 0;
+	m_mouseY = 0;
+	m_mouseState = 0;
+	m_framesCount = 0;
+
+	m_recording = true;
+}
+
+void Comp2D::Inputs::InputsRecording::recordFrame( Uint64 deltaTimeInNanoseconds )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "InputsRecording recordFrame\n" );
+	#endif
+
+	const Uint8* keyboardState = Comp2D::Inputs::Keyboard::getKeyboardState();
+
+	m_changedKeysScancodes.clear();
+
+	for( int i = 0; i < Comp2D::Inputs::Keyboard::KEYBOARD_NUM_KEYS; ++i )
+	{
+		if( keyboardState[i] != m_keyboardState[i] )
+		{
+			m_keyboardState[i] = keyboardState[i];
+			m_changedKeysScancodes.push_back( static_cast<Uint16>( i ) );
+		}
+	}
+
+	writeUnsignedInteger( deltaTimeInNanoseconds, m_data );
+	writeUnsignedInteger( Comp2D::Inputs::Mouse::getMouseState(), m_data );
+	writeSignedInteger( Comp2D::Inputs::Mouse::getMouseX(), m_data );
+	writeSignedInteger( Comp2D::Inputs::Mouse::getMouseY(), m_data );
+	writeUnsignedInteger( m_changedKeysScancodes.size(), m_data );
+
+	for
+	(
+		std::vector<Uint16>::const_iterator scancodeIt = m_changedKeysScancodes.cbegin();
+		scancodeIt != m_changedKeysScancodes.cend();
+		++scancodeIt
+	)
+	{
+		writeUnsignedInteger( *scancodeIt, m_data );
+	}
+
+	++m_framesCount;
+}
+
+bool Comp2D::Inputs::InputsRecording::replayFrame( Uint64& deltaTimeInNanoseconds )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "InputsRecording replayFrame\n" );
+	#endif
+
+	if( !m_replaying )
+	{
+		return false;
+	}
+
+	Uint64 mouseState = 0;
+	Sint64 mouseX = 0;
+	Sint64 mouseY = 0;
+	Uint64 changedKeysCount = 0;
+
+	bool success =
+		readUnsignedInteger( deltaTimeInNanoseconds ) &&
+		readUnsignedInteger( mouseState ) &&
+		readSignedInteger( mouseX ) &&
+		readSignedInteger( mouseY ) &&
+		readUnsignedInteger( changedKeysCount );
+
+	for( Uint64 i = 0; success && i < changedKeysCount; ++i )
+	{
+		Uint64 scancode = 0;
+
+		success = readUnsignedInteger( scancode ) && scancode < Comp2D::Inputs::Keyboard::KEYBOARD_NUM_KEYS;
+
+		if( success )
+		{
+			m_keyboardState[scancode] = m_keyboardState[scancode] ? 0 : 1;
+		}
+	}
+
+	// Also reached on a truncated frame, which is dropped
+	if( !success )
+	{
+		m_replaying = false;
+
+		return false;
+	}
+
+	m_mouseX = static_cast<int>( mouseX );
+	m_mouseY = static_cast<int>( mouseY );
+	m_mouseState = static_cast<Uint32>( mouseState );
+
+	Comp2D::Inputs::Keyboard::setKeyboardState( m_keyboardState );
+	Comp2D::Inputs::Mouse::setMouseState( m_mouseState, m_mouseX, m_mouseY );
+
+	++m_framesCount;
+
+	return true;
+}
+
+void Comp2D::Inputs::InputsRecording::setRandomSeed( unsigned int randomSeed )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "InputsRecording setRandomSeed: randomSeed = %u\n", randomSeed );
+	#endif
+
+	if( m_recording )
+	{
+		m_randomSeed = randomSeed;
+	}
+}
+
+bool Comp2D::Inputs::InputsRecording::isRecording() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "InputsRecording isRecording\n" );
+	#endif
+
+	return m_recording;
+}
+
+bool Comp2D::Inputs::InputsRecording::isReplaying() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "InputsRecording isReplaying\n" );
+	#endif
+
+	return m_replaying;
+}
+
+unsigned int Comp2D::Inputs::InputsRecording::getRandomSeed() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "InputsRecording getRandomSeed\n" );
+	#endif
+
+	return m_randomSeed;
+}
+
+Uint64 Comp2D::Inputs::InputsRecording::getFramesCount() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "InputsRecording getFramesCount\n" );
+	#endif
+
+	return m_framesCount;
+}
+
+float Comp2D::Inputs::InputsRecording::getFixedDeltaTimeInSeconds() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "InputsRecording getFixedDeltaTimeInSeconds\n" );
+	#endif
+
+	return m_fixedDeltaTimeInSeconds;
+}
@@ -31,10 +31,13 @@
 Uint8 Comp2D::Inputs::Keyboard::previousKeyboardState[Comp2D::Inputs::Keyboard::KEYBOARD_NUM_KEYS];
 Uint8 Comp2D::Inputs::Keyboard::keyboardState[Comp2D::Inputs::Keyboard::KEYBOARD_NUM_KEYS];
 
-void Comp2D::Inputs::Keyboard::updateKeyboardState()
+const Uint8* Comp2D::Inputs::Keyboard::getKeyboardState()
 {
-	const Uint8* currentKeyboardState = SDL_GetKeyboardState( nullptr );
+	return keyboardState;
+}
 
+void Comp2D::Inputs::Keyboard::setKeyboardState( const Uint8* currentKeyboardState )
+{
 	for( int i = 0; i < KEYBOARD_NUM_KEYS; ++i )
 	{
 		previousKeyboardState[i] = keyboardState[i];
@@ -42,6 +45,11 @@ void Comp2D::Inputs::Keyboard::updateKeyboardState()
 	}
 }
 
+void Comp2D::Inputs::Keyboard::updateKeyboardState()
+{
+	setKeyboardState( SDL_GetKeyboardState( nullptr ) );
+}
+
 bool Comp2D::Inputs::Keyboard::isKeyDown( int keyScancode )
 {
 	bool keyPreviousState = static_cast<bool>( previousKeyboardState[keyScancode] );
@@ -34,14 +34,25 @@ int Comp2D::Inputs::Mouse::mouseY = 0;
 Uint32 Comp2D::Inputs::Mouse::previousMouseState = 0;
 Uint32 Comp2D::Inputs::Mouse::mouseState = 0;
 
-void Comp2D::Inputs::Mouse::updateMouseState()
+void Comp2D::Inputs::Mouse::setMouseState( Uint32 currentMouseState, int currentMouseX, int currentMouseY )
 {
-	Uint32 currentMouseState = SDL_GetMouseState( &mouseX, &mouseY );
+	mouseX = currentMouseX;
+	mouseY = currentMouseY;
 
 	previousMouseState = mouseState;
 	mouseState = currentMouseState;
 }
 
+void Comp2D::Inputs::Mouse::updateMouseState()
+{
+	int currentMouseX = 0;
+	int currentMouseY = 0;
+
+	Uint32 currentMouseState = SDL_GetMouseState( &currentMouseX, &currentMouseY );
+
+	setMouseState( currentMouseState, currentMouseX, currentMouseY );
+}
+
 bool Comp2D::Inputs::Mouse::isMouseButtonDown( int mouseButtonValue )
 {
 	bool mouseButtonPreviousState = static_cast<bool>( previousMouseState & SDL_BUTTON( mouseButtonValue ) );
@@ -80,3 +91,8 @@ int Comp2D::Inputs::Mouse::getMouseY()
 {
 	return mouseY;
 }
+
+Uint32 Comp2D::Inputs::Mouse::getMouseState()
+{
+	return mouseState;
+}
@@ -0,0 +1,137 @@
+/* JobCounter.cpp -- 'Comp2D' Game Engine 'JobCounter' class source file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#include "Comp2D/Headers/Jobs/JobCounter.h"
+
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_atomic.h>
+
+#include "Comp2D/Headers/Jobs/Job.h"
+
+Comp2D::Jobs::JobCounter::JobCounter()
+	:
+	m_waitingJobsLock{ 0 }
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "JobCounter Constructor body Start\n" );
+	#endif
+
+	SDL_AtomicSet( &m_value, 0 );
+
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "JobCounter Constructor body End\n" );
+	#endif
+}
+
+Comp2D::Jobs::JobCounter::~JobCounter()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "JobCounter Destroying\n" );
+	#endif
+
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "JobCounter Destroyed\n" );
+	#endif
+}
+
+void Comp2D::Jobs::JobCounter::increment( int amount )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "JobCounter increment: amount = %i\n", amount );
+	#endif
+
+	SDL_AtomicAdd( &m_value, amount );
+}
+
+bool Comp2D::Jobs::JobCounter::decrement( std::vector<Job>& releasedJobs )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "JobCounter decrement\n" );
+	#endif
+
+	SDL_AtomicLock( &m_waitingJobsLock );
+
+	// SDL_AtomicAdd returns the previous value
+	bool reachedZero = SDL_AtomicAdd( &m_value, -1 ) == 1;
+
+	if( reachedZero )
+	{
+		releasedJobs.swap( m_waitingJobs );
+	}
+
+	SDL_AtomicUnlock( &m_waitingJobsLock );
+
+	return reachedZero;
+}
+
+bool Comp2D::Jobs::JobCounter::addWaitingJob( const Job& job )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "JobCounter addWaitingJob\n" );
+	#endif
+
+	bool added = false;
+
+	// Checked under the lock, so a decrement reaching zero either sees this
+	// job in the list or happened before and the caller runs it right away
+	SDL_AtomicLock( &m_waitingJobsLock );
+
+	if( SDL_AtomicGet( &m_value ) > 0 )
+	{
+		m_waitingJobs.push_back( job );
+		added = true;
+	}
+
+	SDL_AtomicUnlock( &m_waitingJobsLock );
+
+	return added;
+}
+
+bool Comp2D::Jobs::JobCounter::isDone()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "JobCounter isDone\n" );
+	#endif
+
+	SDL_AtomicLock( &m_waitingJobsLock );
+
+	bool done = SDL_AtomicGet( &m_value ) <= 0;
+
+	SDL_AtomicUnlock( &m_waitingJobsLock );
+
+	return done;
+}
+
+int Comp2D::Jobs::JobCounter::getValue()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "JobCounter getValue\n" );
+	#endif
+
+	return SDL_AtomicGet( &m_value );
+}
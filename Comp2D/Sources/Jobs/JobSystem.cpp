@@ -0,0 +1,428 @@
+/* JobSystem.cpp -- 'Comp2D' Game Engine 'JobSystem' class source file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#include "Comp2D/Headers/Jobs/JobSystem.h"
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_atomic.h>
+#include <SDL_thread.h>
+
+#include "Comp2D/Headers/GameContext.h"
+#include "Comp2D/Headers/Jobs/Job.h"
+#include "Comp2D/Headers/Jobs/JobCounter.h"
+#include "Comp2D/Headers/Profiling/ProfilerZone.h"
+
+Comp2D::Jobs::JobSystem::JobSystem( Uint32 workersCount )
+	:
+	m_workersCount{ workersCount },
+	m_workerIndexTLSID{ SDL_TLSCreate() },
+	m_pendingJobsSemaphore{ SDL_CreateSemaphore( 0 ) },
+	m_workersJobsLocks( workersCount, 0 ),
+	m_workersJobs( workersCount )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "JobSystem Constructor body Start: workersCount = %u\n", workersCount );
+	#endif
+
+	SDL_AtomicSet( &m_nextWorkerIndex, 0 );
+	SDL_AtomicSet( &m_quit, 0 );
+	SDL_AtomicSet( &m_startedWorkersCount, 0 );
+
+	for( Uint32 i = 0; i < m_workersCount; ++i )
+	{
+		std::string workerThreadName = "Comp2D Worker " + std::to_string( i );
+
+		SDL_Thread* workerThread = SDL_CreateThread( workerThreadFunction, workerThreadName.c_str(), this );
+
+		if( workerThread == nullptr )
+		{
+			#ifdef DEBUG
+				SDL_LogError( SDL_LOG_CATEGORY_APPLICATION, "Worker thread could not be created! SDL Error: %s\n", SDL_GetError() );
+			#endif
+
+			continue;
+		}
+
+		m_workersThreads.push_back( workerThread );
+	}
+
+	// Deques of workers that failed to start are still drained by stealing,
+	// but with no worker at all Jobs have to run on the calling thread
+	if( m_workersThreads.empty() )
+	{
+		m_workersCount = 0;
+	}
+
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "JobSystem Constructor body End\n" );
+	#endif
+}
+
+Comp2D::Jobs::JobSystem::~JobSystem()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "JobSystem Destroying\n" );
+	#endif
+
+	while( tryRunPendingJob() )
+	{
+	}
+
+	SDL_AtomicSet( &m_quit, 1 );
+
+	for( Uint32 i = 0; i < m_workersThreads.size(); ++i )
+	{
+		SDL_SemPost( m_pendingJobsSemaphore );
+	}
+
+	for
+	(
+		std::vector<SDL_Thread*>::reverse_iterator workerThreadReverseIt = m_workersThreads.rbegin();
+		workerThreadReverseIt != m_workersThreads.rend();
+		++workerThreadReverseIt
+	)
+	{
+		SDL_WaitThread( *workerThreadReverseIt, nullptr );
+	}
+
+	m_workersThreads.clear();
+
+	SDL_DestroySemaphore( m_pendingJobsSemaphore );
+	m_pendingJobsSemaphore = nullptr;
+
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "JobSystem Destroyed\n" );
+	#endif
+}
+
+int Comp2D::Jobs::JobSystem::workerThreadFunction( void* data )
+{
+	JobSystem* jobSystem = static_cast<JobSystem*>( data );
+
+	Uint32 workerIndex = static_cast<Uint32>( SDL_AtomicAdd( &jobSystem->m_startedWorkersCount, 1 ) );
+
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "JobSystem workerThreadFunction: workerIndex = %u\n", workerIndex );
+	#endif
+
+	// Stored plus one, since a null value means the thread is not a worker
+	SDL_TLSSet( jobSystem->m_workerIndexTLSID, reinterpret_cast<void*>( static_cast<std::uintptr_t>( workerIndex + 1 ) ), nullptr );
+
+	COMP2D_PROFILE_THREAD( "Job Worker " + std::to_string( workerIndex ) );
+
+	while( true )
+	{
+		SDL_SemWait( jobSystem->m_pendingJobsSemaphore );
+
+		if( SDL_AtomicGet( &jobSystem->m_quit ) )
+		{
+			break;
+		}
+
+		while( jobSystem->tryRunPendingJob() )
+		{
+		}
+	}
+
+	return 0;
+}
+
+void Comp2D::Jobs::JobSystem::finishJob( const Job& job )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "JobSystem finishJob\n" );
+	#endif
+
+	std::vector<Job> releasedJobs;
+
+	// The counter may be destroyed by its waiter right after the decrement
+	if( job.counter && job.counter->decrement( releasedJobs ) )
+	{
+		for
+		(
+			std::vector<Job>::const_iterator releasedJobIt = releasedJobs.cbegin();
+			releasedJobIt != releasedJobs.cend();
+			++releasedJobIt
+		)
+		{
+			pushJob( *releasedJobIt );
+		}
+	}
+}
+
+void Comp2D::Jobs::JobSystem::pushJob( const Job& job )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "JobSystem pushJob\n" );
+	#endif
+
+	if( m_workersCount == 0 )
+	{
+		// Without workers the Job runs on the calling thread
+		runJob( job );
+		return;
+	}
+
+	int currentWorkerIndex = getCurrentWorkerIndex();
+
+	Uint32 workerIndex = currentWorkerIndex >= 0 ?
+		static_cast<Uint32>( currentWorkerIndex ) :
+		static_cast<Uint32>( SDL_AtomicAdd( &m_nextWorkerIndex, 1 ) ) % m_workersCount;
+
+	SDL_AtomicLock( &m_workersJobsLocks[workerIndex] );
+	m_workersJobs[workerIndex].push_back( job );
+	SDL_AtomicUnlock( &m_workersJobsLocks[workerIndex] );
+
+	SDL_SemPost( m_pendingJobsSemaphore );
+}
+
+void Comp2D::Jobs::JobSystem::runJob( const Job& job )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "JobSystem runJob\n" );
+	#endif
+
+	COMP2D_PROFILE_ZONE( "Job" );
+
+	// Restored afterwards, since a thread waiting on a counter may run Jobs
+	// queued from other contexts
+	Comp2D::GameContext* previousContext = Comp2D::GameContext::getCurrent();
+
+	Comp2D::GameContext::setCurrent( job.context );
+	job.procedure();
+	Comp2D::GameContext::setCurrent( previousContext );
+
+	finishJob( job );
+}
+
+bool Comp2D::Jobs::JobSystem::popJob( Uint32 workerIndex, Job& job )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "JobSystem popJob: workerIndex = %u\n", workerIndex );
+	#endif
+
+	bool popped = false;
+
+	SDL_AtomicLock( &m_workersJobsLocks[workerIndex] );
+
+	if( !m_workersJobs[workerIndex].empty() )
+	{
+		job = m_workersJobs[workerIndex].back();
+		m_workersJobs[workerIndex].pop_back();
+		popped = true;
+	}
+
+	SDL_AtomicUnlock( &m_workersJobsLocks[workerIndex] );
+
+	return popped;
+}
+
+bool Comp2D::Jobs::JobSystem::stealJob( Uint32 firstVictimIndex, Job& job )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "JobSystem stealJob: firstVictimIndex = %u\n", firstVictimIndex );
+	#endif
+
+	for( Uint32 i = 0; i < m_workersCount; ++i )
+	{
+		Uint32 victimIndex = ( firstVictimIndex + i ) % m_workersCount;
+
+		// Oldest Jobs are taken, which tend to be the largest ones
+		SDL_AtomicLock( &m_workersJobsLocks[victimIndex] );
+
+		if( !m_workersJobs[victimIndex].empty() )
+		{
+			job = m_workersJobs[victimIndex].front();
+			m_workersJobs[victimIndex].pop_front();
+
+			SDL_AtomicUnlock( &m_workersJobsLocks[victimIndex] );
+
+			return true;
+		}
+
+		SDL_AtomicUnlock( &m_workersJobsLocks[victimIndex] );
+	}
+
+	return false;
+}
+
+bool Comp2D::Jobs::JobSystem::tryRunPendingJob()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "JobSystem tryRunPendingJob\n" );
+	#endif
+
+	if( m_workersCount == 0 )
+	{
+		return false;
+	}
+
+	Job job;
+
+	int currentWorkerIndex = getCurrentWorkerIndex();
+
+	bool found = false;
+
+	if( currentWorkerIndex >= 0 )
+	{
+		found =
+			popJob( static_cast<Uint32>( currentWorkerIndex ), job ) ||
+			stealJob( static_cast<Uint32>( currentWorkerIndex ) + 1, job );
+	}
+	else
+	{
+		found = stealJob( 0, job );
+	}
+
+	if( found )
+	{
+		runJob( job );
+	}
+
+	return found;
+}
+
+int Comp2D::Jobs::JobSystem::getCurrentWorkerIndex()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "JobSystem getCurrentWorkerIndex\n" );
+	#endif
+
+	return static_cast<int>( reinterpret_cast<std::uintptr_t>( SDL_TLSGet( m_workerIndexTLSID ) ) ) - 1;
+}
+
+void Comp2D::Jobs::JobSystem::parallelFor
+(
+	Uint32 iterationsCount,
+	Uint32 batchSize,
+	std::function<void(Uint32, Uint32)> batchProcedure
+)
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "JobSystem parallelFor: iterationsCount = %u; batchSize = %u\n", iterationsCount, batchSize );
+	#endif
+
+	if( iterationsCount == 0 )
+	{
+		return;
+	}
+
+	// A few batches per thread leaves room for stealing to even out the load
+	if( batchSize == 0 )
+	{
+		batchSize = iterationsCount / ( ( m_workersCount + 1 ) * 4 );
+
+		if( batchSize == 0 )
+		{
+			batchSize = 1;
+		}
+	}
+
+	JobCounter batchesCounter;
+
+	for
+	(
+		Uint32 batchBegin = batchSize;
+		batchBegin < iterationsCount;
+		batchBegin += batchSize
+	)
+	{
+		Uint32 batchEnd = batchBegin + batchSize < iterationsCount ? batchBegin + batchSize : iterationsCount;
+
+		run
+		(
+			[batchProcedure, batchBegin, batchEnd]()
+			{
+				batchProcedure( batchBegin, batchEnd );
+			},
+			&batchesCounter
+		);
+	}
+
+	// The first batch runs right here instead of waiting on a worker
+	batchProcedure( 0, batchSize < iterationsCount ? batchSize : iterationsCount );
+
+	waitForCounter( &batchesCounter );
+}
+
+void Comp2D::Jobs::JobSystem::run
+(
+	std::function<void()> procedure,
+	JobCounter* counter,
+	JobCounter* dependency
+)
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "JobSystem run\n" );
+	#endif
+
+	if( counter )
+	{
+		counter->increment();
+	}
+
+	Job job;
+	job.procedure = procedure;
+	job.counter = counter;
+	job.context = Comp2D::GameContext::getCurrent();
+
+	if( dependency && dependency->addWaitingJob( job ) )
+	{
+		return;
+	}
+
+	pushJob( job );
+}
+
+void Comp2D::Jobs::JobSystem::waitForCounter( JobCounter* counter )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "JobSystem waitForCounter\n" );
+	#endif
+
+	while( !counter->isDone() )
+	{
+		if( !tryRunPendingJob() )
+		{
+			SDL_Delay( 0 );
+		}
+	}
+}
+
+Uint32 Comp2D::Jobs::JobSystem::getWorkersCount() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "JobSystem getWorkersCount\n" );
+	#endif
+
+	return m_workersCount;
+}
@@ -0,0 +1,229 @@
+/* ProceduresQueue.cpp -- 'Comp2D' Game Engine 'ProceduresQueue' class source file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+#include "Comp2D/Headers/Jobs/ProceduresQueue.h"
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_atomic.h>
+
+Comp2D::Jobs::ProceduresQueue::ProceduresQueue( Uint32 capacity )
+	:
+	m_dequeuePosition{ 0 },
+	m_drainedOverflowIndex{ 0 },
+	m_slotsMask{ 0 },
+	m_overflowLock{ 0 }
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ProceduresQueue Constructor body Start: capacity = %u\n", capacity );
+	#endif
+
+	Uint32 slotsCount = 2;
+
+	while( slotsCount < capacity )
+	{
+		slotsCount *= 2;
+	}
+
+	m_slotsMask = slotsCount - 1;
+
+	m_slots.resize( slotsCount );
+
+	// A slot is free for the producer whose position equals its sequence and
+	// full for the consumer when its sequence is one past the position
+	for( Uint32 i = 0; i < slotsCount; ++i )
+	{
+		SDL_AtomicSet( &m_slots[i].sequence, static_cast<int>( i ) );
+
+		m_slots[i].entry.context = nullptr;
+	}
+
+	SDL_AtomicSet( &m_enqueuePosition, 0 );
+	SDL_AtomicSet( &m_overflowing, 0 );
+
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ProceduresQueue Constructor body End\n" );
+	#endif
+}
+
+Comp2D::Jobs::ProceduresQueue::~ProceduresQueue()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ProceduresQueue Destroying\n" );
+	#endif
+
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ProceduresQueue Destroyed\n" );
+	#endif
+}
+
+bool Comp2D::Jobs::ProceduresQueue::tryPopFromOverflow( std::function<void()>& procedure, Comp2D::GameContext*& context )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ProceduresQueue tryPopFromOverflow\n" );
+	#endif
+
+	if( m_drainedOverflowIndex == m_drainedOverflowEntries.size() )
+	{
+		if( !SDL_AtomicGet( &m_overflowing ) )
+		{
+			return false;
+		}
+
+		m_drainedOverflowEntries.clear();
+		m_drainedOverflowIndex = 0;
+
+		SDL_AtomicLock( &m_overflowLock );
+
+		// Both lists keep their capacity, so a later overflow does not
+		// allocate again
+		m_drainedOverflowEntries.swap( m_overflowEntries );
+
+		if( m_drainedOverflowEntries.empty() )
+		{
+			SDL_AtomicSet( &m_overflowing, 0 );
+		}
+
+		SDL_AtomicUnlock( &m_overflowLock );
+
+		if( m_drainedOverflowEntries.empty() )
+		{
+			return false;
+		}
+	}
+
+	Entry& entry = m_drainedOverflowEntries[m_drainedOverflowIndex];
+
+	procedure = std::move( entry.procedure );
+	context = entry.context;
+
+	++m_drainedOverflowIndex;
+
+	return true;
+}
+
+bool Comp2D::Jobs::ProceduresQueue::tryPopFromSlots( std::function<void()>& procedure, Comp2D::GameContext*& context )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ProceduresQueue tryPopFromSlots\n" );
+	#endif
+
+	Slot& slot = m_slots[m_dequeuePosition & m_slotsMask];
+
+	// Not published yet
+	if( static_cast<Uint32>( SDL_AtomicGet( &slot.sequence ) ) != m_dequeuePosition + 1 )
+	{
+		return false;
+	}
+
+	procedure = std::move( slot.entry.procedure );
+	context = slot.entry.context;
+
+	slot.entry.procedure = nullptr;
+
+	// Frees the slot for the producers on the next lap of the ring
+	SDL_MemoryBarrierRelease();
+	SDL_AtomicSet( &slot.sequence, static_cast<int>( m_dequeuePosition + m_slotsMask + 1 ) );
+
+	++m_dequeuePosition;
+
+	return true;
+}
+
+bool Comp2D::Jobs::ProceduresQueue::tryPushToSlots( std::function<void()>& procedure, Comp2D::GameContext* context )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ProceduresQueue tryPushToSlots\n" );
+	#endif
+
+	Uint32 position = static_cast<Uint32>( SDL_AtomicGet( &m_enqueuePosition ) );
+
+	while( true )
+	{
+		Slot& slot = m_slots[position & m_slotsMask];
+
+		int difference = static_cast<int>( static_cast<Uint32>( SDL_AtomicGet( &slot.sequence ) ) - position );
+
+		if( difference == 0 )
+		{
+			if( SDL_AtomicCAS( &m_enqueuePosition, static_cast<int>( position ), static_cast<int>( position + 1 ) ) )
+			{
+				slot.entry.procedure = std::move( procedure );
+				slot.entry.context = context;
+
+				SDL_MemoryBarrierRelease();
+				SDL_AtomicSet( &slot.sequence, static_cast<int>( position + 1 ) );
+
+				return true;
+			}
+
+			position = static_cast<Uint32>( SDL_AtomicGet( &m_enqueuePosition ) );
+		}
+		// The consumer has not freed this slot yet, the ring is full
+		else if( difference < 0 )
+		{
+			return false;
+		}
+		// Another producer claimed the position first
+		else
+		{
+			position = static_cast<Uint32>( SDL_AtomicGet( &m_enqueuePosition ) );
+		}
+	}
+}
+
+void Comp2D::Jobs::ProceduresQueue::push( std::function<void()> procedure, Comp2D::GameContext* context )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ProceduresQueue push\n" );
+	#endif
+
+	if( !SDL_AtomicGet( &m_overflowing ) && tryPushToSlots( procedure, context ) )
+	{
+		return;
+	}
+
+	SDL_AtomicLock( &m_overflowLock );
+
+	m_overflowEntries.push_back( Entry{ std::move( procedure ), context } );
+
+	SDL_AtomicSet( &m_overflowing, 1 );
+
+	SDL_AtomicUnlock( &m_overflowLock );
+}
+
+bool Comp2D::Jobs::ProceduresQueue::pop( std::function<void()>& procedure, Comp2D::GameContext*& context )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ProceduresQueue pop\n" );
+	#endif
+
+	// Everything on the ring was posted before the overflow started or by
+	// threads that did not see it yet
+	return tryPopFromSlots( procedure, context ) || tryPopFromOverflow( procedure, context );
+}
@@ -0,0 +1,130 @@
+/* SeparateThreadFunctionCall.cpp -- 'Comp2D' Game Engine 'SeparateThreadFunctionCall' class source file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+#include "Comp2D/Headers/Jobs/SeparateThreadFunctionCall.h"
+
+#include <list>
+#include <string>
+
+#include <SDL.h>
+#include <SDL_atomic.h>
+#include <SDL_thread.h>
+
+#include "Comp2D/Headers/GameContext.h"
+
+int Comp2D::Jobs::SeparateThreadFunctionCall::run( void* separateThreadFunctionCall )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "SeparateThreadFunctionCall run\n" );
+	#endif
+
+	SeparateThreadFunctionCall* call = static_cast<SeparateThreadFunctionCall*>( separateThreadFunctionCall );
+
+	Comp2D::GameContext::setCurrent( call->context );
+
+	int result = call->separateThreadFunction( call->data );
+
+	Comp2D::GameContext::setCurrent( nullptr );
+
+	// Last touch of the call, its caller may delete it from now on
+	SDL_AtomicSet( &call->done, 1 );
+
+	return result;
+}
+
+Comp2D::Jobs::SeparateThreadFunctionCall* Comp2D::Jobs::SeparateThreadFunctionCall::start( int (*separateThreadFunction)(void*), void* data, const std::string& threadName )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "SeparateThreadFunctionCall start: threadName = %s\n", threadName.c_str() );
+	#endif
+
+	SeparateThreadFunctionCall* call = new SeparateThreadFunctionCall{ separateThreadFunction, data, Comp2D::GameContext::getCurrent(), nullptr };
+
+	SDL_AtomicSet( &call->done, 0 );
+
+	call->thread = SDL_CreateThread( run, threadName.c_str(), call );
+
+	if( call->thread == nullptr )
+	{
+		SDL_LogError( SDL_LOG_CATEGORY_APPLICATION, "Separate thread %s could not be created! SDL Error: %s\n", threadName.c_str(), SDL_GetError() );
+
+		delete call;
+
+		return nullptr;
+	}
+
+	return call;
+}
+
+void Comp2D::Jobs::SeparateThreadFunctionCall::waitForDone( std::list<SeparateThreadFunctionCall*>& separateThreadFunctionCalls )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "SeparateThreadFunctionCall waitForDone\n" );
+	#endif
+
+	std::list<SeparateThreadFunctionCall*>::iterator callIt = separateThreadFunctionCalls.begin();
+
+	while( callIt != separateThreadFunctionCalls.end() )
+	{
+		if( SDL_AtomicGet( &(*callIt)->done ) )
+		{
+			// Only left to exit, so this does not block
+			SDL_WaitThread( (*callIt)->thread, nullptr );
+
+			delete (*callIt);
+
+			callIt = separateThreadFunctionCalls.erase( callIt );
+		}
+		else
+		{
+			++callIt;
+		}
+	}
+}
+
+void Comp2D::Jobs::SeparateThreadFunctionCall::waitForAll( std::list<SeparateThreadFunctionCall*>& separateThreadFunctionCalls )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "SeparateThreadFunctionCall waitForAll\n" );
+	#endif
+
+	for
+	(
+		std::list<SeparateThreadFunctionCall*>::reverse_iterator callReverseIt = separateThreadFunctionCalls.rbegin();
+		callReverseIt != separateThreadFunctionCalls.rend();
+		++callReverseIt
+	)
+	{
+		#ifdef DEBUG
+			SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "SeparateThreadFunctionCall Waiting Separate Thread Function With Address %p\n", (*callReverseIt)->thread );
+		#endif
+
+		SDL_WaitThread( (*callReverseIt)->thread, nullptr );
+
+		delete (*callReverseIt);
+	}
+
+	separateThreadFunctionCalls.clear();
+}
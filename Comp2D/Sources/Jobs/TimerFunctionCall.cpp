@@ -0,0 +1,158 @@
+/* TimerFunctionCall.cpp -- 'Comp2D' Game Engine 'TimerFunctionCall' class source file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#include "Comp2D/Headers/Jobs/TimerFunctionCall.h"
+
+#include <cstdint>
+#include <unordered_map>
+
+#include <SDL.h>
+#include <SDL_atomic.h>
+
+#include "Comp2D/Headers/GameContext.h"
+
+SDL_TimerID Comp2D::Jobs::TimerFunctionCall::lastTimerFunctionCallID = 0;
+
+SDL_SpinLock Comp2D::Jobs::TimerFunctionCall::timerFunctionCallsLock = 0;
+
+std::unordered_map<SDL_TimerID, Comp2D::Jobs::TimerFunctionCall> Comp2D::Jobs::TimerFunctionCall::timerFunctionCalls;
+
+Uint32 Comp2D::Jobs::TimerFunctionCall::run( Uint32 interval, void* timerFunctionCallID )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimerFunctionCall run\n" );
+	#endif
+
+	SDL_TimerID callID = static_cast<SDL_TimerID>( reinterpret_cast<intptr_t>( timerFunctionCallID ) );
+
+	// Copied, so stop may erase it while the function runs
+	SDL_AtomicLock( &timerFunctionCallsLock );
+
+	std::unordered_map<SDL_TimerID, TimerFunctionCall>::const_iterator callIt = timerFunctionCalls.find( callID );
+
+	if( callIt == timerFunctionCalls.end() )
+	{
+		SDL_AtomicUnlock( &timerFunctionCallsLock );
+
+		return 0;
+	}
+
+	TimerFunctionCall call = callIt->second;
+
+	SDL_AtomicUnlock( &timerFunctionCallsLock );
+
+	Comp2D::GameContext* previousContext = Comp2D::GameContext::getCurrent();
+
+	Comp2D::GameContext::setCurrent( call.context );
+
+	Uint32 nextInterval = call.timerFunction( interval, call.param );
+
+	Comp2D::GameContext::setCurrent( previousContext );
+
+	if( nextInterval == 0 )
+	{
+		SDL_AtomicLock( &timerFunctionCallsLock );
+
+		timerFunctionCalls.erase( callID );
+
+		SDL_AtomicUnlock( &timerFunctionCallsLock );
+	}
+
+	return nextInterval;
+}
+
+SDL_TimerID Comp2D::Jobs::TimerFunctionCall::start( Uint32 (*timerFunction)(Uint32, void*), void* param, Uint32 callbackTimeInMilliseconds )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimerFunctionCall start: callbackTimeInMilliseconds = %u\n", callbackTimeInMilliseconds );
+	#endif
+
+	// Added before the timer, which may fire before SDL_AddTimer returns
+	SDL_AtomicLock( &timerFunctionCallsLock );
+
+	SDL_TimerID callID = ++lastTimerFunctionCallID;
+
+	timerFunctionCalls[callID] = TimerFunctionCall{ timerFunction, param, Comp2D::GameContext::getCurrent(), 0 };
+
+	SDL_AtomicUnlock( &timerFunctionCallsLock );
+
+	SDL_TimerID timerID = SDL_AddTimer( callbackTimeInMilliseconds, run, reinterpret_cast<void*>( static_cast<intptr_t>( callID ) ) );
+
+	SDL_AtomicLock( &timerFunctionCallsLock );
+
+	if( timerID == 0 )
+	{
+		timerFunctionCalls.erase( callID );
+
+		callID = 0;
+	}
+	else
+	{
+		std::unordered_map<SDL_TimerID, TimerFunctionCall>::iterator callIt = timerFunctionCalls.find( callID );
+
+		if( callIt != timerFunctionCalls.end() )
+		{
+			callIt->second.timerID = timerID;
+		}
+	}
+
+	SDL_AtomicUnlock( &timerFunctionCallsLock );
+
+	if( callID == 0 )
+	{
+		SDL_LogError( SDL_LOG_CATEGORY_APPLICATION, "Timer function could not be added! SDL Error: %s\n", SDL_GetError() );
+	}
+
+	return callID;
+}
+
+void Comp2D::Jobs::TimerFunctionCall::stop( SDL_TimerID timerFunctionCallID )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimerFunctionCall stop: timerFunctionCallID = %i\n", timerFunctionCallID );
+	#endif
+
+	SDL_TimerID timerID = 0;
+
+	SDL_AtomicLock( &timerFunctionCallsLock );
+
+	std::unordered_map<SDL_TimerID, TimerFunctionCall>::iterator callIt = timerFunctionCalls.find( timerFunctionCallID );
+
+	if( callIt != timerFunctionCalls.end() )
+	{
+		timerID = callIt->second.timerID;
+
+		timerFunctionCalls.erase( callIt );
+	}
+
+	SDL_AtomicUnlock( &timerFunctionCallsLock );
+
+	// Already done when it was not found
+	if( timerID != 0 )
+	{
+		SDL_RemoveTimer( timerID );
+	}
+}
@@ -0,0 +1,376 @@
+/* Logger.cpp -- 'Comp2D' Game Engine 'Logger' class source file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+#include "Comp2D/Headers/Logging/Logger.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_atomic.h>
+#include <SDL_mutex.h>
+#include <SDL_thread.h>
+
+#include "Comp2D/Headers/Logging/LogRecord.h"
+
+SDL_atomic_t Comp2D::Logging::Logger::droppedRecordsCount;
+SDL_atomic_t Comp2D::Logging::Logger::enqueuePosition;
+SDL_atomic_t Comp2D::Logging::Logger::quit;
+
+Uint32 Comp2D::Logging::Logger::dequeuePosition = 0;
+Uint32 Comp2D::Logging::Logger::reportedDroppedRecordsCount = 0;
+
+Uint64 Comp2D::Logging::Logger::performanceCounterFrequency = 1;
+Uint64 Comp2D::Logging::Logger::performanceCounterOnInitialization = 0;
+
+void* Comp2D::Logging::Logger::previousOutputFunctionUserData = nullptr;
+
+SDL_LogOutputFunction Comp2D::Logging::Logger::previousOutputFunction = nullptr;
+
+SDL_RWops* Comp2D::Logging::Logger::logFile = nullptr;
+
+SDL_sem* Comp2D::Logging::Logger::pendingRecordsSemaphore = nullptr;
+
+SDL_Thread* Comp2D::Logging::Logger::writerThread = nullptr;
+
+std::vector<Comp2D::Logging::LogRecord> Comp2D::Logging::Logger::records;
+
+int Comp2D::Logging::Logger::writerThreadFunction( void* data )
+{
+	// Logging from here would only feed the ring being written
+
+	while( !SDL_AtomicGet( &quit ) )
+	{
+		SDL_SemWaitTimeout( pendingRecordsSemaphore, WRITER_WAKE_UP_INTERVAL_IN_MILLISECONDS );
+
+		writePendingRecords();
+	}
+
+	writePendingRecords();
+
+	return 0;
+}
+
+void Comp2D::Logging::Logger::outputFunction( void* userdata, int category, SDL_LogPriority priority, const char* message )
+{
+	Uint32 position = static_cast<Uint32>( SDL_AtomicGet( &enqueuePosition ) );
+
+	while( true )
+	{
+		LogRecord& record = records[position & ( RECORDS_COUNT - 1 )];
+
+		int difference = static_cast<int>( static_cast<Uint32>( SDL_AtomicGet( &record.sequence ) ) - position );
+
+		if( difference == 0 )
+		{
+			if( SDL_AtomicCAS( &enqueuePosition, static_cast<int>( position ), static_cast<int>( position + 1 ) ) )
+			{
+				Uint32 messageLength = static_cast<Uint32>( SDL_strlen( message ) );
+
+				// The engine messages already end with a new line
+				if( messageLength > 0 && message[messageLength - 1] == '\n' )
+				{
+					--messageLength;
+				}
+
+				if( messageLength > LogRecord::MESSAGE_MAXIMUM_LENGTH )
+				{
+					messageLength = LogRecord::MESSAGE_MAXIMUM_LENGTH;
+				}
+
+				record.category = category;
+				record.messageLength = messageLength;
+				record.counter = SDL_GetPerformanceCounter();
+				record.priority = priority;
+
+				SDL_memcpy( record.message, message, messageLength );
+
+				SDL_MemoryBarrierRelease();
+				SDL_AtomicSet( &record.sequence, static_cast<int>( position + 1 ) );
+
+				// The writer wakes up on its own every few milliseconds, so it
+				// is only woken up early when the ring is filling up or when
+				// something went wrong
+				if( ( position & ( RECORDS_COUNT / 4 - 1 ) ) == 0 || priority >= SDL_LOG_PRIORITY_ERROR )
+				{
+					SDL_SemPost( pendingRecordsSemaphore );
+				}
+
+				return;
+			}
+
+			position = static_cast<Uint32>( SDL_AtomicGet( &enqueuePosition ) );
+		}
+		// The writer has not written this record yet, the ring is full
+		else if( difference < 0 )
+		{
+			// Warnings and errors wait for the writer instead of being lost
+			if( priority < SDL_LOG_PRIORITY_WARN )
+			{
+				SDL_AtomicAdd( &droppedRecordsCount, 1 );
+
+				return;
+			}
+
+			SDL_SemPost( pendingRecordsSemaphore );
+			SDL_Delay( 0 );
+
+			position = static_cast<Uint32>( SDL_AtomicGet( &enqueuePosition ) );
+		}
+		// Another thread claimed the position first
+		else
+		{
+			position = static_cast<Uint32>( SDL_AtomicGet( &enqueuePosition ) );
+		}
+	}
+}
+
+void Comp2D::Logging::Logger::writePendingRecords()
+{
+	constexpr Uint32 LINE_MAXIMUM_LENGTH = LogRecord::MESSAGE_MAXIMUM_LENGTH + 64;
+	constexpr Uint32 WRITE_BUFFER_SIZE = 16384;
+
+	char writeBuffer[WRITE_BUFFER_SIZE];
+
+	Uint32 writeBufferLength = 0;
+
+	while( true )
+	{
+		LogRecord& record = records[dequeuePosition & ( RECORDS_COUNT - 1 )];
+
+		bool recordPending = static_cast<Uint32>( SDL_AtomicGet( &record.sequence ) ) == dequeuePosition + 1;
+
+		if( recordPending )
+		{
+			Uint64 elapsedCounter = record.counter - performanceCounterOnInitialization;
+
+			writeBufferLength += SDL_snprintf
+			(
+				writeBuffer + writeBufferLength,
+				LINE_MAXIMUM_LENGTH,
+				"[%6u.%06u] %s (%s): %.*s\n",
+				static_cast<unsigned int>( elapsedCounter / performanceCounterFrequency ),
+				static_cast<unsigned int>( ( elapsedCounter % performanceCounterFrequency ) * 1000000 / performanceCounterFrequency ),
+				getPriorityName( record.priority ),
+				getCategoryName( record.category ),
+				static_cast<int>( record.messageLength ),
+				record.message
+			);
+
+			SDL_AtomicSet( &record.sequence, static_cast<int>( dequeuePosition + RECORDS_COUNT ) );
+
+			++dequeuePosition;
+		}
+
+		if( writeBufferLength > 0 && ( !recordPending || writeBufferLength + LINE_MAXIMUM_LENGTH > WRITE_BUFFER_SIZE ) )
+		{
+			std::fwrite( writeBuffer, 1, writeBufferLength, stdout );
+
+			if( logFile )
+			{
+				SDL_RWwrite( logFile, writeBuffer, 1, writeBufferLength );
+			}
+
+			writeBufferLength = 0;
+		}
+
+		if( !recordPending )
+		{
+			break;
+		}
+	}
+
+	Uint32 currentDroppedRecordsCount = static_cast<Uint32>( SDL_AtomicGet( &droppedRecordsCount ) );
+
+	if( currentDroppedRecordsCount != reportedDroppedRecordsCount )
+	{
+		writeBufferLength = SDL_snprintf
+		(
+			writeBuffer,
+			LINE_MAXIMUM_LENGTH,
+			"WARN (LOGGER): %u messages dropped, the log ring was full\n",
+			currentDroppedRecordsCount - reportedDroppedRecordsCount
+		);
+
+		std::fwrite( writeBuffer, 1, writeBufferLength, stdout );
+
+		if( logFile )
+		{
+			SDL_RWwrite( logFile, writeBuffer, 1, writeBufferLength );
+		}
+
+		reportedDroppedRecordsCount = currentDroppedRecordsCount;
+	}
+
+	std::fflush( stdout );
+}
+
+const char* Comp2D::Logging::Logger::getCategoryName( int category )
+{
+	switch( category )
+	{
+		case SDL_LOG_CATEGORY_APPLICATION:
+			return "APPLICATION";
+		case SDL_LOG_CATEGORY_ASSERT:
+			return "ASSERT";
+		case SDL_LOG_CATEGORY_AUDIO:
+			return "AUDIO";
+		case SDL_LOG_CATEGORY_CUSTOM:
+			return "CUSTOM";
+		case SDL_LOG_CATEGORY_ERROR:
+			return "ERROR";
+		case SDL_LOG_CATEGORY_INPUT:
+			return "INPUT";
+		case SDL_LOG_CATEGORY_RENDER:
+			return "RENDER";
+		case SDL_LOG_CATEGORY_SYSTEM:
+			return "SYSTEM";
+		case SDL_LOG_CATEGORY_TEST:
+			return "TEST";
+		case SDL_LOG_CATEGORY_VIDEO:
+			return "VIDEO";
+		default:
+			return "UNKNOWN CATEGORY";
+	}
+}
+
+const char* Comp2D::Logging::Logger::getPriorityName( SDL_LogPriority priority )
+{
+	switch( priority )
+	{
+		case SDL_LOG_PRIORITY_CRITICAL:
+			return "CRITICAL";
+		case SDL_LOG_PRIORITY_DEBUG:
+			return "DEBUG";
+		case SDL_LOG_PRIORITY_ERROR:
+			return "ERROR";
+		case SDL_LOG_PRIORITY_INFO:
+			return "INFO";
+		case SDL_LOG_PRIORITY_VERBOSE:
+			return "VERBOSE";
+		case SDL_LOG_PRIORITY_WARN:
+			return "WARN";
+		default:
+			return "UNKNOWN PRIORITY";
+	}
+}
+
+bool Comp2D::Logging::Logger::initialize( const std::string& logFilePath )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Logger initialize: logFilePath = %s\n", logFilePath.c_str() );
+	#endif
+
+	bool success = true;
+
+	performanceCounterFrequency = SDL_GetPerformanceFrequency();
+	performanceCounterOnInitialization = SDL_GetPerformanceCounter();
+
+	records.resize( RECORDS_COUNT );
+
+	// A record can be claimed when its sequence equals the ring position and
+	// written when it is one past it
+	for( Uint32 i = 0; i < RECORDS_COUNT; ++i )
+	{
+		SDL_AtomicSet( &records[i].sequence, static_cast<int>( i ) );
+	}
+
+	SDL_AtomicSet( &droppedRecordsCount, 0 );
+	SDL_AtomicSet( &enqueuePosition, 0 );
+	SDL_AtomicSet( &quit, 0 );
+
+	dequeuePosition = 0;
+	reportedDroppedRecordsCount = 0;
+
+	if( !logFilePath.empty() )
+	{
+		logFile = SDL_RWFromFile( logFilePath.c_str(), "ab" );
+
+		success = logFile != nullptr;
+	}
+
+	for( int category = SDL_LOG_CATEGORY_APPLICATION; category <= SDL_LOG_CATEGORY_CUSTOM; ++category )
+	{
+		if( SDL_LogGetPriority( category ) < COMP2D_LOG_MINIMUM_PRIORITY )
+		{
+			SDL_LogSetPriority( category, COMP2D_LOG_MINIMUM_PRIORITY );
+		}
+	}
+
+	pendingRecordsSemaphore = SDL_CreateSemaphore( 0 );
+
+	writerThread = SDL_CreateThread( writerThreadFunction, "Log Writer", nullptr );
+
+	SDL_LogGetOutputFunction( &previousOutputFunction, &previousOutputFunctionUserData );
+	SDL_LogSetOutputFunction( outputFunction, nullptr );
+
+	return success;
+}
+
+void Comp2D::Logging::Logger::finalize()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Logger finalize\n" );
+	#endif
+
+	SDL_LogSetOutputFunction( previousOutputFunction, previousOutputFunctionUserData );
+
+	SDL_AtomicSet( &quit, 1 );
+	SDL_SemPost( pendingRecordsSemaphore );
+
+	SDL_WaitThread( writerThread, nullptr );
+	writerThread = nullptr;
+
+	SDL_DestroySemaphore( pendingRecordsSemaphore );
+	pendingRecordsSemaphore = nullptr;
+
+	if( logFile )
+	{
+		SDL_RWclose( logFile );
+		logFile = nullptr;
+	}
+
+	records.clear();
+	records.shrink_to_fit();
+}
+
+void Comp2D::Logging::Logger::setCategoryPriority( int category, SDL_LogPriority priority )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Logger setCategoryPriority: category = %i; priority = %i\n", category, priority );
+	#endif
+
+	SDL_LogSetPriority( category, priority );
+}
+
+Uint32 Comp2D::Logging::Logger::getDroppedRecordsCount()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Logger getDroppedRecordsCount\n" );
+	#endif
+
+	return static_cast<Uint32>( SDL_AtomicGet( &droppedRecordsCount ) );
+}
@@ -0,0 +1,196 @@
+/* MemoryArena.cpp -- 'Comp2D' Game Engine 'MemoryArena' class source file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#include "Comp2D/Headers/Memory/MemoryArena.h"
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+#include <SDL.h>
+
+thread_local Comp2D::Memory::MemoryArena* Comp2D::Memory::MemoryArena::current = nullptr;
+
+Comp2D::Memory::MemoryArena::MemoryArena( size_t blockSize )
+	:
+	m_blockSize{ blockSize },
+	// Full, so the first allocation opens a block
+	m_currentBlockOffset{ blockSize }
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "MemoryArena Constructor: blockSize = %u\n", static_cast<unsigned int>( blockSize ) );
+	#endif
+}
+
+Comp2D::Memory::MemoryArena::~MemoryArena()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "MemoryArena Destroying\n" );
+	#endif
+
+	reset();
+
+	for
+	(
+		std::vector<Uint8*>::iterator blockIt = m_blocks.begin();
+		blockIt != m_blocks.end();
+		++blockIt
+	)
+	{
+		::operator delete( *blockIt );
+	}
+
+	m_blocks.clear();
+}
+
+void* Comp2D::Memory::MemoryArena::allocate( size_t size )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "MemoryArena allocate: size = %u\n", static_cast<unsigned int>( size ) );
+	#endif
+
+	Uint8* allocation = nullptr;
+
+	if( current != nullptr )
+	{
+		allocation = static_cast<Uint8*>( current->allocateFromBlocks( ALLOCATION_HEADER_SIZE + size ) );
+	}
+	else
+	{
+		allocation = static_cast<Uint8*>( ::operator new( ALLOCATION_HEADER_SIZE + size ) );
+	}
+
+	*reinterpret_cast<MemoryArena**>( allocation ) = current;
+
+	return allocation + ALLOCATION_HEADER_SIZE;
+}
+
+void Comp2D::Memory::MemoryArena::deallocate( void* pointer )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "MemoryArena deallocate\n" );
+	#endif
+
+	if( pointer == nullptr )
+	{
+		return;
+	}
+
+	Uint8* allocation = static_cast<Uint8*>( pointer ) - ALLOCATION_HEADER_SIZE;
+
+	// Arena memory is given back by the reset of its MemoryArena
+	if( *reinterpret_cast<MemoryArena**>( allocation ) == nullptr )
+	{
+		::operator delete( allocation );
+	}
+}
+
+void Comp2D::Memory::MemoryArena::setCurrent( MemoryArena* memoryArena )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "MemoryArena setCurrent\n" );
+	#endif
+
+	current = memoryArena;
+}
+
+Comp2D::Memory::MemoryArena* Comp2D::Memory::MemoryArena::getCurrent()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "MemoryArena getCurrent\n" );
+	#endif
+
+	return current;
+}
+
+void* Comp2D::Memory::MemoryArena::allocateFromBlocks( size_t size )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "MemoryArena allocateFromBlocks: size = %u\n", static_cast<unsigned int>( size ) );
+	#endif
+
+	// The blocks come aligned from the global heap, so rounding every size
+	// keeps each allocation aligned as well
+	size = ( size + ALLOCATION_HEADER_SIZE - 1 ) & ~( ALLOCATION_HEADER_SIZE - 1 );
+
+	m_usedSize += size;
+
+	if( size > m_blockSize )
+	{
+		m_largeAllocations.push_back( static_cast<Uint8*>( ::operator new( size ) ) );
+
+		return m_largeAllocations.back();
+	}
+
+	if( m_currentBlockOffset + size > m_blockSize )
+	{
+		if( m_openedBlocksCount == m_blocks.size() )
+		{
+			m_blocks.push_back( static_cast<Uint8*>( ::operator new( m_blockSize ) ) );
+		}
+
+		++m_openedBlocksCount;
+		m_currentBlockOffset = 0;
+	}
+
+	Uint8* allocation = m_blocks[m_openedBlocksCount - 1] + m_currentBlockOffset;
+
+	m_currentBlockOffset += size;
+
+	return allocation;
+}
+
+void Comp2D::Memory::MemoryArena::reset()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "MemoryArena reset: usedSize = %u\n", static_cast<unsigned int>( m_usedSize ) );
+	#endif
+
+	for
+	(
+		std::vector<Uint8*>::iterator largeAllocationIt = m_largeAllocations.begin();
+		largeAllocationIt != m_largeAllocations.end();
+		++largeAllocationIt
+	)
+	{
+		::operator delete( *largeAllocationIt );
+	}
+
+	m_largeAllocations.clear();
+
+	m_openedBlocksCount = 0;
+	m_currentBlockOffset = m_blockSize;
+	m_usedSize = 0;
+}
+
+size_t Comp2D::Memory::MemoryArena::getUsedSize() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "MemoryArena getUsedSize\n" );
+	#endif
+
+	return m_usedSize;
+}
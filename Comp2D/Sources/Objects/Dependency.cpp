@@ -32,6 +32,8 @@
 
 #include <SDL.h>
 
+#include "Comp2D/Headers/Memory/MemoryArena.h"
+
 Comp2D::Objects::Dependency::Dependency
 (
 	void** dependentPointerToRequiredObject,
@@ -86,3 +88,21 @@ Comp2D::Objects::Dependency::~Dependency()
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Dependency Destroyed\n" );
 	#endif
 }
+
+void* Comp2D::Objects::Dependency::operator new( size_t size )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Dependency operator new: size = %u\n", static_cast<unsigned int>( size ) );
+	#endif
+
+	return Comp2D::Memory::MemoryArena::allocate( size );
+}
+
+void Comp2D::Objects::Dependency::operator delete( void* pointer )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Dependency operator delete\n" );
+	#endif
+
+	Comp2D::Memory::MemoryArena::deallocate( pointer );
+}
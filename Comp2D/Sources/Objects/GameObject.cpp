@@ -26,9 +26,11 @@
 
 #include "Comp2D/Headers/Objects/GameObject.h"
 
+#include <algorithm>
 #include <iterator>
 #include <list>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <SDL.h>
@@ -37,11 +39,17 @@
 #include "Box2D/Dynamics/b2WorldCallbacks.h"
 #include "Box2D/Dynamics/Contacts/b2Contact.h"
 
+#include "Comp2D/Headers/Components/AnimationsControllerComponent.h"
 #include "Comp2D/Headers/Components/Component.h"
+#include "Comp2D/Headers/Components/ComponentType.h"
 #include "Comp2D/Headers/Components/GameObjectBehavior.h"
 #include "Comp2D/Headers/Components/PhysicsTransformComponent.h"
+#include "Comp2D/Headers/Components/Renderable.h"
+#include "Comp2D/Headers/Components/ResourceComponent.h"
 #include "Comp2D/Headers/Components/ScreenSpaceTransformComponent.h"
+#include "Comp2D/Headers/Components/TimelinesControllerComponent.h"
 #include "Comp2D/Headers/Components/TransformComponent.h"
+#include "Comp2D/Headers/Memory/MemoryArena.h"
 #include "Comp2D/Headers/Utilities/Vector2D.h"
 #include "Comp2D/Headers/States/GameState.h"
 
@@ -106,6 +114,219 @@ Comp2D::Objects::GameObject::~GameObject()
 	#endif
 }
 
+void* Comp2D::Objects::GameObject::operator new( size_t size )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameObject operator new: size = %u\n", static_cast<unsigned int>( size ) );
+	#endif
+
+	return Comp2D::Memory::MemoryArena::allocate( size );
+}
+
+void Comp2D::Objects::GameObject::operator delete( void* pointer )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameObject operator delete\n" );
+	#endif
+
+	Comp2D::Memory::MemoryArena::deallocate( pointer );
+}
+
+void Comp2D::Objects::GameObject::notifyActivityChanged()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameObject with ID %u named %s notifyActivityChanged\n", m_id, m_name.c_str() );
+	#endif
+
+	if( gameState != nullptr && m_creationOrder != NOT_CREATED_CREATION_ORDER )
+	{
+		gameState->onGameObjectActivityChanged( this );
+	}
+}
+
+void Comp2D::Objects::GameObject::notifyBehaviorsChanged()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameObject with ID %u named %s notifyBehaviorsChanged\n", m_id, m_name.c_str() );
+	#endif
+
+	if( gameState != nullptr && m_creationOrder != NOT_CREATED_CREATION_ORDER )
+	{
+		gameState->onGameObjectBehaviorsChanged();
+	}
+}
+
+void Comp2D::Objects::GameObject::notifyBehaviorRemoved( Comp2D::Components::GameObjectBehavior* behavior )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameObject with ID %u named %s notifyBehaviorRemoved\n", m_id, m_name.c_str() );
+	#endif
+
+	if( gameState != nullptr && m_creationOrder != NOT_CREATED_CREATION_ORDER )
+	{
+		gameState->onGameObjectBehaviorRemoved( behavior );
+	}
+}
+
+void Comp2D::Objects::GameObject::indexComponent( Comp2D::Components::Component* component )
+{
+	#ifdef DEBUG
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"GameObject with ID %u named %s indexComponent: component with ID %u\n",
+			m_id,
+			m_name.c_str(),
+			component->getID()
+		);
+	#endif
+
+	component->m_roles = Comp2D::Components::ComponentType::getRoles( component );
+
+	if( component->hasRole( Comp2D::Components::EComponentRole::AnimationsController ) )
+	{
+		animationsControllerComponents.push_back( static_cast<Comp2D::Components::AnimationsControllerComponent*>( component ) );
+	}
+
+	if( component->hasRole( Comp2D::Components::EComponentRole::GameObjectBehavior ) )
+	{
+		behaviors.push_back( static_cast<Comp2D::Components::GameObjectBehavior*>( component ) );
+	}
+
+	if( component->hasRole( Comp2D::Components::EComponentRole::Renderable ) )
+	{
+		// Renderable is not a Component, so this one takes a cross cast
+		Comp2D::Components::Renderable* renderable = dynamic_cast<Comp2D::Components::Renderable*>( component );
+
+		renderable->component = component;
+
+		renderables.push_back( renderable );
+	}
+
+	if( component->hasRole( Comp2D::Components::EComponentRole::ResourceComponent ) )
+	{
+		resourceComponents.push_back( static_cast<Comp2D::Components::ResourceComponent*>( component ) );
+	}
+
+	if( component->hasRole( Comp2D::Components::EComponentRole::TimelinesController ) )
+	{
+		timelinesControllerComponents.push_back( static_cast<Comp2D::Components::TimelinesControllerComponent*>( component ) );
+	}
+
+	for( Uint32 typeID = 0; typeID < m_componentsByType.size(); ++typeID )
+	{
+		if( Comp2D::Components::ComponentType::isInstance( typeID, component ) )
+		{
+			m_componentsByType[typeID].push_back( component );
+		}
+	}
+}
+
+void Comp2D::Objects::GameObject::indexComponentTypes() const
+{
+	#ifdef DEBUG
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"GameObject with ID %u named %s indexComponentTypes\n",
+			m_id,
+			m_name.c_str()
+		);
+	#endif
+
+	Uint32 typesCount = Comp2D::Components::ComponentType::getTypesCount();
+
+	for( Uint32 typeID = static_cast<Uint32>( m_componentsByType.size() ); typeID < typesCount; ++typeID )
+	{
+		m_componentsByType.emplace_back();
+
+		for
+		(
+			std::vector<Comp2D::Components::Component*>::const_iterator componentConstIt = components.cbegin();
+			componentConstIt != components.cend();
+			++componentConstIt
+		)
+		{
+			if( Comp2D::Components::ComponentType::isInstance( typeID, *componentConstIt ) )
+			{
+				m_componentsByType[typeID].push_back( *componentConstIt );
+			}
+		}
+	}
+}
+
+void Comp2D::Objects::GameObject::unindexComponent( Comp2D::Components::Component* component )
+{
+	#ifdef DEBUG
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"GameObject with ID %u named %s unindexComponent: component with ID %u\n",
+			m_id,
+			m_name.c_str(),
+			component->getID()
+		);
+	#endif
+
+	if( component->hasRole( Comp2D::Components::EComponentRole::AnimationsController ) )
+	{
+		animationsControllerComponents.erase
+		(
+			std::find( animationsControllerComponents.begin(), animationsControllerComponents.end(), component )
+		);
+	}
+
+	if( component->hasRole( Comp2D::Components::EComponentRole::GameObjectBehavior ) )
+	{
+		behaviors.erase( std::find( behaviors.begin(), behaviors.end(), component ) );
+	}
+
+	if( component->hasRole( Comp2D::Components::EComponentRole::Renderable ) )
+	{
+		for
+		(
+			std::vector<Comp2D::Components::Renderable*>::iterator renderableIt = renderables.begin();
+			renderableIt != renderables.end();
+			++renderableIt
+		)
+		{
+			if( (*renderableIt)->component == component )
+			{
+				renderables.erase( renderableIt );
+				break;
+			}
+		}
+	}
+
+	if( component->hasRole( Comp2D::Components::EComponentRole::ResourceComponent ) )
+	{
+		resourceComponents.erase( std::find( resourceComponents.begin(), resourceComponents.end(), component ) );
+	}
+
+	if( component->hasRole( Comp2D::Components::EComponentRole::TimelinesController ) )
+	{
+		timelinesControllerComponents.erase
+		(
+			std::find( timelinesControllerComponents.begin(), timelinesControllerComponents.end(), component )
+		);
+	}
+
+	for
+	(
+		std::vector<std::vector<Comp2D::Components::Component*>>::iterator typeComponentsIt = m_componentsByType.begin();
+		typeComponentsIt != m_componentsByType.end();
+		++typeComponentsIt
+	)
+	{
+		std::vector<Comp2D::Components::Component*>::iterator typeComponentIt = std::find( typeComponentsIt->begin(), typeComponentsIt->end(), component );
+
+		if( typeComponentIt != typeComponentsIt->end() )
+		{
+			typeComponentsIt->erase( typeComponentIt );
+		}
+	}
+}
+
 void Comp2D::Objects::GameObject::setComponentActiveInHierarchy( Comp2D::Components::Component* component, bool activeInHierarchy )
 {
 	#ifdef DEBUG
@@ -147,6 +368,8 @@ void Comp2D::Objects::GameObject::setSelfActiveInHierarchy( bool activeInHierarc
 
 	m_activeInHierarchy = activeInHierarchy;
 
+	notifyActivityChanged();
+
 	if( transform )
 	{
 		transform->setActiveInHierarchy( activeInHierarchy );
@@ -220,7 +443,12 @@ void Comp2D::Objects::GameObject::setActive( bool active )
 		);
 	#endif
 
-	m_active = active;
+	if( m_active != active )
+	{
+		m_active = active;
+
+		notifyActivityChanged();
+	}
 }
 
 void Comp2D::Objects::GameObject::setActiveInHierarchy( bool activeInHierarchy )
@@ -416,30 +644,29 @@ void Comp2D::Objects::GameObject::onRotated( float32 rotation )
 		*/
 	#endif
 
+	#ifdef DEBUG
+		// Translating or rotating notifies the other behaviors and the
+		// children, which the parallel safe behaviors must not do
+		SDL_assert( gameState == nullptr || !gameState->m_parallelUpdatableBehaviorsUpdating );
+	#endif
+
 	Comp2D::Components::GameObjectBehavior* currentBehavior = nullptr;
 	for
 	(
-		//std::list<Comp2D::Components::Component*>::iterator it = activeInHierarchyComponents.begin();
-		//it != activeInHierarchyComponents.end();
-		std::vector<Comp2D::Components::Component*>::iterator it = components.begin();
-		it != components.end();
+		std::vector<Comp2D::Components::GameObjectBehavior*>::iterator it = behaviors.begin();
+		it != behaviors.end();
 		++it
 	)
 	{
-		Comp2D::Components::Component* currentComponent = *it;
+		currentBehavior = *it;
 
 		if
 		(
-			currentComponent->isEnabled() &&
-			currentComponent->isActiveInHierarchy()
+			currentBehavior->isEnabled() &&
+			currentBehavior->isActiveInHierarchy()
 		)
 		{
-			currentBehavior = dynamic_cast<Comp2D::Components::GameObjectBehavior*>( *it );
-
-			if( currentBehavior )
-			{
-				currentBehavior->onRotated( rotation );
-			}
+			currentBehavior->onRotated( rotation );
 		}
 	}
 
@@ -481,30 +708,27 @@ void Comp2D::Objects::GameObject::onTranslated( b2Vec2 translation )
 		*/
 	#endif
 
+	#ifdef DEBUG
+		SDL_assert( gameState == nullptr || !gameState->m_parallelUpdatableBehaviorsUpdating );
+	#endif
+
 	Comp2D::Components::GameObjectBehavior* currentBehavior = nullptr;
 	for
 	(
-		//std::list<Comp2D::Components::Component*>::iterator it = activeInHierarchyComponents.begin();
-		//it != activeInHierarchyComponents.end();
-		std::vector<Comp2D::Components::Component*>::iterator it = components.begin();
-		it != components.end();
+		std::vector<Comp2D::Components::GameObjectBehavior*>::iterator it = behaviors.begin();
+		it != behaviors.end();
 		++it
 	)
 	{
-		Comp2D::Components::Component* currentComponent = *it;
+		currentBehavior = *it;
 
 		if
 		(
-			currentComponent->isEnabled() &&
-			currentComponent->isActiveInHierarchy()
+			currentBehavior->isEnabled() &&
+			currentBehavior->isActiveInHierarchy()
 		)
 		{
-			currentBehavior = dynamic_cast<Comp2D::Components::GameObjectBehavior*>( *it );
-
-			if( currentBehavior )
-			{
-				currentBehavior->onTranslated( translation );
-			}
+			currentBehavior->onTranslated( translation );
 		}
 	}
 
@@ -549,27 +773,20 @@ void Comp2D::Objects::GameObject::beginContact( b2Contact* contact, GameObject*
 	Comp2D::Components::GameObjectBehavior* currentBehavior = nullptr;
 	for
 	(
-		//std::list<Comp2D::Components::Component*>::iterator it = activeInHierarchyComponents.begin();
-		//it != activeInHierarchyComponents.end();
-		std::vector<Comp2D::Components::Component*>::iterator it = components.begin();
-		it != components.end();
+		std::vector<Comp2D::Components::GameObjectBehavior*>::iterator it = behaviors.begin();
+		it != behaviors.end();
 		++it
 	)
 	{
-		Comp2D::Components::Component* currentComponent = *it;
+		currentBehavior = *it;
 
 		if
 		(
-			currentComponent->isEnabled() &&
-			currentComponent->isActiveInHierarchy()
+			currentBehavior->isEnabled() &&
+			currentBehavior->isActiveInHierarchy()
 		)
 		{
-			currentBehavior = dynamic_cast<Comp2D::Components::GameObjectBehavior*>( *it );
-
-			if( currentBehavior )
-			{
-				currentBehavior->beginContact( contact, otherGameObject );
-			}
+			currentBehavior->beginContact( contact, otherGameObject );
 		}
 	}
 
@@ -614,27 +831,20 @@ void Comp2D::Objects::GameObject::endContact( b2Contact* contact, GameObject* ot
 	Comp2D::Components::GameObjectBehavior* currentBehavior = nullptr;
 	for
 	(
-		//std::list<Comp2D::Components::Component*>::iterator it = activeInHierarchyComponents.begin();
-		//it != activeInHierarchyComponents.end();
-		std::vector<Comp2D::Components::Component*>::iterator it = components.begin();
-		it != components.end();
+		std::vector<Comp2D::Components::GameObjectBehavior*>::iterator it = behaviors.begin();
+		it != behaviors.end();
 		++it
 	)
 	{
-		Comp2D::Components::Component* currentComponent = *it;
+		currentBehavior = *it;
 
 		if
 		(
-			currentComponent->isEnabled() &&
-			currentComponent->isActiveInHierarchy()
+			currentBehavior->isEnabled() &&
+			currentBehavior->isActiveInHierarchy()
 		)
 		{
-			currentBehavior = dynamic_cast<Comp2D::Components::GameObjectBehavior*>( *it );
-
-			if( currentBehavior )
-			{
-				currentBehavior->endContact( contact, otherGameObject );
-			}
+			currentBehavior->endContact( contact, otherGameObject );
 		}
 	}
 
@@ -679,27 +889,20 @@ void Comp2D::Objects::GameObject::postSolve( b2Contact* contact, const b2Contact
 	Comp2D::Components::GameObjectBehavior* currentBehavior = nullptr;
 	for
 	(
-		//std::list<Comp2D::Components::Component*>::iterator it = activeInHierarchyComponents.begin();
-		//it != activeInHierarchyComponents.end();
-		std::vector<Comp2D::Components::Component*>::iterator it = components.begin();
-		it != components.end();
+		std::vector<Comp2D::Components::GameObjectBehavior*>::iterator it = behaviors.begin();
+		it != behaviors.end();
 		++it
 	)
 	{
-		Comp2D::Components::Component* currentComponent = *it;
+		currentBehavior = *it;
 
 		if
 		(
-			currentComponent->isEnabled() &&
-			currentComponent->isActiveInHierarchy()
+			currentBehavior->isEnabled() &&
+			currentBehavior->isActiveInHierarchy()
 		)
 		{
-			currentBehavior = dynamic_cast<Comp2D::Components::GameObjectBehavior*>( *it );
-
-			if( currentBehavior )
-			{
-				currentBehavior->postSolve( contact, impulse, otherGameObject );
-			}
+			currentBehavior->postSolve( contact, impulse, otherGameObject );
 		}
 	}
 
@@ -744,27 +947,20 @@ void Comp2D::Objects::GameObject::preSolve( b2Contact* contact, const b2Manifold
 	Comp2D::Components::GameObjectBehavior* currentBehavior = nullptr;
 	for
 	(
-		//std::list<Comp2D::Components::Component*>::iterator it = activeInHierarchyComponents.begin();
-		//it != activeInHierarchyComponents.end();
-		std::vector<Comp2D::Components::Component*>::iterator it = components.begin();
-		it != components.end();
+		std::vector<Comp2D::Components::GameObjectBehavior*>::iterator it = behaviors.begin();
+		it != behaviors.end();
 		++it
 	)
 	{
-		Comp2D::Components::Component* currentComponent = *it;
+		currentBehavior = *it;
 
 		if
 		(
-			currentComponent->isEnabled() &&
-			currentComponent->isActiveInHierarchy()
+			currentBehavior->isEnabled() &&
+			currentBehavior->isActiveInHierarchy()
 		)
 		{
-			currentBehavior = dynamic_cast<Comp2D::Components::GameObjectBehavior*>( *it );
-
-			if( currentBehavior )
-			{
-				currentBehavior->preSolve( contact, oldManifold, otherGameObject );
-			}
+			currentBehavior->preSolve( contact, oldManifold, otherGameObject );
 		}
 	}
 
@@ -822,6 +1018,23 @@ bool Comp2D::Objects::GameObject::isActiveInHierarchy() const
 	return m_activeInHierarchy;
 }
 
+bool Comp2D::Objects::GameObject::isDestroyPending() const
+{
+	#ifdef DEBUG
+		/*
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"GameObject with ID %u named %s isDestroyPending\n",
+			m_id,
+			m_name.c_str()
+		);
+		*/
+	#endif
+
+	return m_destroyPending;
+}
+
 unsigned int  Comp2D::Objects::GameObject::getID() const
 {
 	#ifdef DEBUG
@@ -895,6 +1108,13 @@ Comp2D::Components::Component* Comp2D::Objects::GameObject::addComponent( Comp2D
 
 	components.push_back( component );
 
+	indexComponent( component );
+
+	if( component->hasRole( Comp2D::Components::EComponentRole::GameObjectBehavior ) )
+	{
+		notifyBehaviorsChanged();
+	}
+
 	if( m_activeInHierarchy )
 	{
 		component->setActiveInHierarchy( m_activeInHierarchy );
@@ -961,6 +1181,13 @@ Comp2D::Components::Component* Comp2D::Objects::GameObject::removeComponent( uns
 
 			components.erase( components.begin() + i );
 
+			if( removedComponent->hasRole( Comp2D::Components::EComponentRole::GameObjectBehavior ) )
+			{
+				notifyBehaviorRemoved( static_cast<Comp2D::Components::GameObjectBehavior*>( removedComponent ) );
+			}
+
+			unindexComponent( removedComponent );
+
 			if( removedComponent->isActiveInHierarchy() )
 			{
 				//activeInHierarchyComponents.remove( removedComponent );
@@ -1000,6 +1227,13 @@ Comp2D::Components::Component* Comp2D::Objects::GameObject::removeComponent( Com
 
 			components.erase( components.begin() + i );
 
+			if( removedComponent->hasRole( Comp2D::Components::EComponentRole::GameObjectBehavior ) )
+			{
+				notifyBehaviorRemoved( static_cast<Comp2D::Components::GameObjectBehavior*>( removedComponent ) );
+			}
+
+			unindexComponent( removedComponent );
+
 			if( removedComponent->isActiveInHierarchy() )
 			{
 				//activeInHierarchyComponents.remove( removedComponent );
@@ -1036,6 +1270,11 @@ Comp2D::Objects::GameObject* Comp2D::Objects::GameObject::addChildGameObject( Ga
 
 	childGameObject->parentGameObject = this;
 	childGameObjects.push_back( childGameObject );
+	m_childGameObjectsByID.emplace( childGameObject->m_id, childGameObject );
+	m_childGameObjectsByName.emplace( childGameObject->m_name, childGameObject );
+
+	// No longer a root
+	childGameObject->notifyActivityChanged();
 
 	childGameObject->setActive( active );
 	if( active )
@@ -1067,16 +1306,11 @@ Comp2D::Objects::GameObject* Comp2D::Objects::GameObject::getChildGameObject( un
 		);
 	#endif
 
-	GameObject* currentGameObject = nullptr;
+	std::unordered_map<unsigned int, GameObject*>::const_iterator childGameObjectIt = m_childGameObjectsByID.find( id );
 
-	for( unsigned int i = 0; i < childGameObjects.size(); ++i )
+	if( childGameObjectIt != m_childGameObjectsByID.cend() )
 	{
-		currentGameObject = childGameObjects[i];
-
-		if( currentGameObject->m_id == id )
-		{
-			return currentGameObject;
-		}
+		return childGameObjectIt->second;
 	}
 
 	return nullptr;
@@ -1095,16 +1329,11 @@ Comp2D::Objects::GameObject* Comp2D::Objects::GameObject::getChildGameObject( co
 		);
 	#endif
 
-	GameObject* currentGameObject = nullptr;
+	std::unordered_map<std::string, GameObject*>::const_iterator childGameObjectIt = m_childGameObjectsByName.find( name );
 
-	for( unsigned int i = 0; i < childGameObjects.size(); ++i )
+	if( childGameObjectIt != m_childGameObjectsByName.cend() )
 	{
-		currentGameObject = childGameObjects[i];
-
-		if(  currentGameObject->m_name.compare( name ) == 0 )
-		{
-			return currentGameObject;
-		}
+		return childGameObjectIt->second;
 	}
 
 	return nullptr;
@@ -1159,5 +1388,40 @@ Comp2D::Objects::GameObject* Comp2D::Objects::GameObject::removeChildGameObject(
 		);
 	#endif
 
+	std::vector<GameObject*>::iterator childGameObjectIt = std::find( childGameObjects.begin(), childGameObjects.end(), childGameObject );
+
+	if( childGameObjectIt == childGameObjects.end() )
+	{
+		return nullptr;
+	}
+
+	childGameObjects.erase( childGameObjectIt );
+	activeChildGameObjects.remove( childGameObject );
+
+	std::unordered_map<unsigned int, GameObject*>::iterator childGameObjectByIDIt = m_childGameObjectsByID.find( childGameObject->m_id );
+
+	if( childGameObjectByIDIt != m_childGameObjectsByID.end() && childGameObjectByIDIt->second == childGameObject )
+	{
+		m_childGameObjectsByID.erase( childGameObjectByIDIt );
+	}
+
+	std::unordered_map<std::string, GameObject*>::iterator childGameObjectByNameIt = m_childGameObjectsByName.find( childGameObject->m_name );
+
+	if( childGameObjectByNameIt != m_childGameObjectsByName.end() && childGameObjectByNameIt->second == childGameObject )
+	{
+		m_childGameObjectsByName.erase( childGameObjectByNameIt );
+	}
+
+	childGameObject->parentGameObject = nullptr;
+
+	// Now a root
+	childGameObject->notifyActivityChanged();
+
+	// Deleting it right away could pull it from under what is being walked
+	if( deleteChildGameObject && gameState != nullptr )
+	{
+		gameState->deferDestroyGameObject( childGameObject );
+	}
+
 	return childGameObject;
 }
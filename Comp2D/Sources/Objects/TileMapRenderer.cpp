@@ -92,7 +92,7 @@ Comp2D::Objects::TileMapRenderer::TileMapRenderer
 				this,
 				static_cast<Comp2D::Resources::GenericResource<Comp2D::Tiling::TileIndexMap>*>
 				(
-					Game::resourcesManager->getResource( tileIndexMapResourceName )
+					Game::getResourcesManager()->getResource( tileIndexMapResourceName )
 				)
 			)
 		)
@@ -109,7 +109,7 @@ Comp2D::Objects::TileMapRenderer::TileMapRenderer
 				tileSetColumnCount,
 				tileSetLineCount,
 				tileSetTileSize,
-				static_cast<Comp2D::Resources::TextureResource*>( Comp2D::Game::resourcesManager->getResource( tileSetTextureResourceName ) )
+				static_cast<Comp2D::Resources::TextureResource*>( Comp2D::Game::getResourcesManager()->getResource( tileSetTextureResourceName ) )
 			)
 		)
 	);
@@ -0,0 +1,271 @@
+/* Profiler.cpp -- 'Comp2D' Game Engine 'Profiler' class source file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#include "Comp2D/Headers/Profiling/Profiler.h"
+
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_mutex.h>
+#include <SDL_thread.h>
+
+#include "Comp2D/Headers/Profiling/ProfilerThreadZones.h"
+#include "Comp2D/Headers/Profiling/ProfilerZoneRecord.h"
+
+Uint64 Comp2D::Profiling::Profiler::performanceCounterFrequency = 1;
+Uint64 Comp2D::Profiling::Profiler::performanceCounterOnInitialization = 0;
+
+SDL_TLSID Comp2D::Profiling::Profiler::threadZonesTLSID = 0;
+
+SDL_mutex* Comp2D::Profiling::Profiler::threadsZonesMutex = nullptr;
+
+std::vector<Comp2D::Profiling::ProfilerThreadZones*> Comp2D::Profiling::Profiler::threadsZones;
+
+void Comp2D::Profiling::Profiler::initialize()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Profiler initialize\n" );
+	#endif
+
+	performanceCounterFrequency = SDL_GetPerformanceFrequency();
+	performanceCounterOnInitialization = SDL_GetPerformanceCounter();
+
+	threadZonesTLSID = SDL_TLSCreate();
+
+	threadsZonesMutex = SDL_CreateMutex();
+}
+
+void Comp2D::Profiling::Profiler::finalize()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Profiler finalize\n" );
+	#endif
+
+	SDL_LockMutex( threadsZonesMutex );
+
+	for
+	(
+		std::vector<ProfilerThreadZones*>::iterator threadZonesIt = threadsZones.begin();
+		threadZonesIt != threadsZones.end();
+		++threadZonesIt
+	)
+	{
+		delete (*threadZonesIt);
+	}
+	threadsZones.clear();
+
+	SDL_UnlockMutex( threadsZonesMutex );
+
+	SDL_DestroyMutex( threadsZonesMutex );
+	threadsZonesMutex = nullptr;
+}
+
+Comp2D::Profiling::ProfilerThreadZones* Comp2D::Profiling::Profiler::getCurrentThreadZones()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Profiler getCurrentThreadZones\n" );
+	#endif
+
+	if( threadsZonesMutex == nullptr )
+	{
+		return nullptr;
+	}
+
+	ProfilerThreadZones* currentThreadZones = static_cast<ProfilerThreadZones*>( SDL_TLSGet( threadZonesTLSID ) );
+
+	// First zone of this thread
+	if( currentThreadZones == nullptr )
+	{
+		currentThreadZones = new ProfilerThreadZones( SDL_ThreadID() );
+
+		SDL_LockMutex( threadsZonesMutex );
+
+		threadsZones.push_back( currentThreadZones );
+
+		SDL_UnlockMutex( threadsZonesMutex );
+
+		SDL_TLSSet( threadZonesTLSID, currentThreadZones, nullptr );
+	}
+
+	return currentThreadZones;
+}
+
+void Comp2D::Profiling::Profiler::addZone( const char* name, Uint64 beginCounter, Uint64 endCounter )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Profiler addZone: name = %s\n", name );
+	#endif
+
+	ProfilerThreadZones* currentThreadZones = getCurrentThreadZones();
+
+	if( currentThreadZones )
+	{
+		currentThreadZones->addZone( name, beginCounter, endCounter );
+	}
+}
+
+void Comp2D::Profiling::Profiler::clear()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Profiler clear\n" );
+	#endif
+
+	if( threadsZonesMutex == nullptr )
+	{
+		return;
+	}
+
+	SDL_LockMutex( threadsZonesMutex );
+
+	for
+	(
+		std::vector<ProfilerThreadZones*>::iterator threadZonesIt = threadsZones.begin();
+		threadZonesIt != threadsZones.end();
+		++threadZonesIt
+	)
+	{
+		(*threadZonesIt)->clear();
+	}
+
+	SDL_UnlockMutex( threadsZonesMutex );
+}
+
+void Comp2D::Profiling::Profiler::setCurrentThreadName( const std::string& threadName )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Profiler setCurrentThreadName: threadName = %s\n", threadName.c_str() );
+	#endif
+
+	ProfilerThreadZones* currentThreadZones = getCurrentThreadZones();
+
+	if( currentThreadZones )
+	{
+		currentThreadZones->setThreadName( threadName );
+	}
+}
+
+bool Comp2D::Profiling::Profiler::writeChromeTrace( const std::string& traceFilePath )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Profiler writeChromeTrace: traceFilePath = %s\n", traceFilePath.c_str() );
+	#endif
+
+	if( threadsZonesMutex == nullptr )
+	{
+		return false;
+	}
+
+	std::stringstream traceStringStream;
+	traceStringStream.str( "" );
+
+	traceStringStream << std::fixed << std::setprecision( 3 );
+
+	traceStringStream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+	bool firstEvent = true;
+
+	std::vector<ProfilerZoneRecord> threadZones;
+
+	SDL_LockMutex( threadsZonesMutex );
+
+	for
+	(
+		std::vector<ProfilerThreadZones*>::iterator threadZonesIt = threadsZones.begin();
+		threadZonesIt != threadsZones.end();
+		++threadZonesIt
+	)
+	{
+		SDL_threadID threadID = (*threadZonesIt)->getThreadID();
+
+		if( !firstEvent )
+		{
+			traceStringStream << ',';
+		}
+		firstEvent = false;
+
+		traceStringStream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << threadID
+						  << ",\"args\":{\"name\":\"" << (*threadZonesIt)->getThreadName() << "\"}}";
+
+		threadZones.clear();
+
+		(*threadZonesIt)->copyZones( threadZones );
+
+		for
+		(
+			std::vector<ProfilerZoneRecord>::iterator zoneIt = threadZones.begin();
+			zoneIt != threadZones.end();
+			++zoneIt
+		)
+		{
+			double beginInMicroseconds = static_cast<double>( zoneIt->beginCounter - performanceCounterOnInitialization ) * 1000000.0 /
+										 static_cast<double>( performanceCounterFrequency );
+			double durationInMicroseconds = static_cast<double>( zoneIt->endCounter - zoneIt->beginCounter ) * 1000000.0 /
+											static_cast<double>( performanceCounterFrequency );
+
+			traceStringStream << ",{\"name\":\"";
+
+			// Zone names are identifiers, only quotes and backslashes need escaping
+			for( const char* nameCharacter = zoneIt->name; *nameCharacter != '\0'; ++nameCharacter )
+			{
+				if( *nameCharacter == '"' || *nameCharacter == '\\' )
+				{
+					traceStringStream << '\\';
+				}
+				traceStringStream << *nameCharacter;
+			}
+
+			traceStringStream << "\",\"cat\":\"Comp2D\",\"ph\":\"X\",\"pid\":1,\"tid\":" << threadID
+							  << ",\"ts\":" << beginInMicroseconds
+							  << ",\"dur\":" << durationInMicroseconds << '}';
+		}
+	}
+
+	SDL_UnlockMutex( threadsZonesMutex );
+
+	traceStringStream << "]}\n";
+
+	SDL_RWops* traceFile = SDL_RWFromFile( traceFilePath.c_str(), "wb" );
+
+	if( traceFile == nullptr )
+	{
+		#ifdef DEBUG
+			SDL_LogError( SDL_LOG_CATEGORY_APPLICATION, "Unable to open trace file %s! SDL Error: %s\n", traceFilePath.c_str(), SDL_GetError() );
+		#endif
+
+		return false;
+	}
+
+	std::string trace = traceStringStream.str();
+
+	bool success = SDL_RWwrite( traceFile, trace.c_str(), 1, trace.size() ) == trace.size();
+
+	SDL_RWclose( traceFile );
+
+	return success;
+}
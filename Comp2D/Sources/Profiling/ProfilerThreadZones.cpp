@@ -0,0 +1,149 @@
+/* ProfilerThreadZones.cpp -- 'Comp2D' Game Engine 'ProfilerThreadZones' class source file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#include "Comp2D/Headers/Profiling/ProfilerThreadZones.h"
+
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_atomic.h>
+#include <SDL_thread.h>
+
+#include "Comp2D/Headers/Profiling/ProfilerZoneRecord.h"
+
+Comp2D::Profiling::ProfilerThreadZones::ProfilerThreadZones( SDL_threadID threadID )
+	:
+	m_nextZoneIndex{ 0 },
+	m_recordedZonesCount{ 0 },
+	m_threadID{ threadID },
+	m_zonesLock{ 0 },
+	m_threadName{ "Thread " + std::to_string( threadID ) },
+	m_zones( ZONES_RING_CAPACITY )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ProfilerThreadZones Constructor body Start\n" );
+	#endif
+
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ProfilerThreadZones Constructor body End\n" );
+	#endif
+}
+
+Comp2D::Profiling::ProfilerThreadZones::~ProfilerThreadZones()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ProfilerThreadZones Destroying\n" );
+	#endif
+
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ProfilerThreadZones Destroyed\n" );
+	#endif
+}
+
+void Comp2D::Profiling::ProfilerThreadZones::addZone( const char* name, Uint64 beginCounter, Uint64 endCounter )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ProfilerThreadZones addZone: name = %s\n", name );
+	#endif
+
+	SDL_AtomicLock( &m_zonesLock );
+
+	ProfilerZoneRecord& zone = m_zones[m_nextZoneIndex];
+
+	zone.beginCounter = beginCounter;
+	zone.endCounter = endCounter;
+	zone.name = name;
+
+	m_nextZoneIndex = ( m_nextZoneIndex + 1 ) % ZONES_RING_CAPACITY;
+
+	++m_recordedZonesCount;
+
+	SDL_AtomicUnlock( &m_zonesLock );
+}
+
+void Comp2D::Profiling::ProfilerThreadZones::clear()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ProfilerThreadZones clear\n" );
+	#endif
+
+	SDL_AtomicLock( &m_zonesLock );
+
+	m_nextZoneIndex = 0;
+	m_recordedZonesCount = 0;
+
+	SDL_AtomicUnlock( &m_zonesLock );
+}
+
+void Comp2D::Profiling::ProfilerThreadZones::copyZones( std::vector<ProfilerZoneRecord>& zones )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ProfilerThreadZones copyZones\n" );
+	#endif
+
+	SDL_AtomicLock( &m_zonesLock );
+
+	if( m_recordedZonesCount > ZONES_RING_CAPACITY )
+	{
+		zones.insert( zones.end(), m_zones.begin() + m_nextZoneIndex, m_zones.end() );
+	}
+
+	zones.insert( zones.end(), m_zones.begin(), m_zones.begin() + m_nextZoneIndex );
+
+	SDL_AtomicUnlock( &m_zonesLock );
+}
+
+void Comp2D::Profiling::ProfilerThreadZones::setThreadName( const std::string& threadName )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ProfilerThreadZones setThreadName: threadName = %s\n", threadName.c_str() );
+	#endif
+
+	SDL_AtomicLock( &m_zonesLock );
+
+	m_threadName = threadName;
+
+	SDL_AtomicUnlock( &m_zonesLock );
+}
+
+SDL_threadID Comp2D::Profiling::ProfilerThreadZones::getThreadID() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ProfilerThreadZones getThreadID\n" );
+	#endif
+
+	return m_threadID;
+}
+
+const std::string& Comp2D::Profiling::ProfilerThreadZones::getThreadName() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ProfilerThreadZones getThreadName\n" );
+	#endif
+
+	return m_threadName;
+}
@@ -0,0 +1,369 @@
+/* QualityGovernor.cpp -- 'Comp2D' Game Engine 'QualityGovernor' class source file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+#include "Comp2D/Headers/Quality/QualityGovernor.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+
+#include "Comp2D/Headers/Quality/QualityFeature.h"
+
+Comp2D::Quality::QualityGovernor::QualityGovernor()
+	:
+	m_nextFeatureID{ 0 },
+	m_windowFramesCount{ 0 },
+	m_windowsToSkipCount{ 0 },
+	m_windowsUnderRestoreThresholdCount{ 0 },
+	m_frameBudgetInNanoseconds{ 0 },
+	m_windowWorkTimeInNanoseconds{ 0 }
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "QualityGovernor Constructor body Start\n" );
+	#endif
+
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "QualityGovernor Constructor body End\n" );
+	#endif
+}
+
+Comp2D::Quality::QualityGovernor::~QualityGovernor()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "QualityGovernor Destroying\n" );
+	#endif
+
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "QualityGovernor Destroyed\n" );
+	#endif
+}
+
+void Comp2D::Quality::QualityGovernor::degrade()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "QualityGovernor degrade\n" );
+	#endif
+
+	QualityFeature* degradedFeature = nullptr;
+
+	for
+	(
+		std::vector<QualityFeature>::iterator featureIt = m_features.begin();
+		featureIt != m_features.end();
+		++featureIt
+	)
+	{
+		if
+		(
+			featureIt->currentLevel + 1 < featureIt->levelsCount &&
+			( degradedFeature == nullptr || featureIt->degradationOrder < degradedFeature->degradationOrder )
+		)
+		{
+			degradedFeature = &(*featureIt);
+		}
+	}
+
+	// Already at the lowest quality
+	if( degradedFeature == nullptr )
+	{
+		return;
+	}
+
+	++degradedFeature->currentLevel;
+
+	m_degradedFeaturesIDs.push_back( degradedFeature->id );
+
+	SDL_LogInfo
+	(
+		SDL_LOG_CATEGORY_APPLICATION,
+		"Quality degraded: %s level %u of %u\n",
+		degradedFeature->name.c_str(),
+		degradedFeature->currentLevel,
+		degradedFeature->levelsCount - 1
+	);
+
+	degradedFeature->onLevelChanged( degradedFeature->currentLevel );
+}
+
+void Comp2D::Quality::QualityGovernor::evaluateWindow()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "QualityGovernor evaluateWindow\n" );
+	#endif
+
+	double averageWorkTimeInNanoseconds =
+		static_cast<double>( m_windowWorkTimeInNanoseconds ) / static_cast<double>( m_windowFramesCount );
+	double frameBudgetInNanoseconds = static_cast<double>( m_frameBudgetInNanoseconds );
+
+	m_windowFramesCount = 0;
+	m_windowWorkTimeInNanoseconds = 0;
+
+	// The window after a change still holds frames from before it took effect
+	if( m_windowsToSkipCount > 0 )
+	{
+		--m_windowsToSkipCount;
+
+		return;
+	}
+
+	if( averageWorkTimeInNanoseconds > frameBudgetInNanoseconds * DEGRADE_THRESHOLD )
+	{
+		m_windowsUnderRestoreThresholdCount = 0;
+
+		degrade();
+
+		m_windowsToSkipCount = 1;
+	}
+	else if( averageWorkTimeInNanoseconds < frameBudgetInNanoseconds * RESTORE_THRESHOLD && !m_degradedFeaturesIDs.empty() )
+	{
+		++m_windowsUnderRestoreThresholdCount;
+
+		if( m_windowsUnderRestoreThresholdCount >= RESTORE_WINDOWS_COUNT )
+		{
+			m_windowsUnderRestoreThresholdCount = 0;
+
+			restore();
+
+			m_windowsToSkipCount = 1;
+		}
+	}
+	else
+	{
+		m_windowsUnderRestoreThresholdCount = 0;
+	}
+}
+
+void Comp2D::Quality::QualityGovernor::restore()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "QualityGovernor restore\n" );
+	#endif
+
+	while( !m_degradedFeaturesIDs.empty() )
+	{
+		QualityFeature* restoredFeature = getFeature( m_degradedFeaturesIDs.back() );
+
+		m_degradedFeaturesIDs.pop_back();
+
+		// Skips features unregistered while degraded
+		if( restoredFeature != nullptr && restoredFeature->currentLevel > 0 )
+		{
+			--restoredFeature->currentLevel;
+
+			SDL_LogInfo
+			(
+				SDL_LOG_CATEGORY_APPLICATION,
+				"Quality restored: %s level %u of %u\n",
+				restoredFeature->name.c_str(),
+				restoredFeature->currentLevel,
+				restoredFeature->levelsCount - 1
+			);
+
+			restoredFeature->onLevelChanged( restoredFeature->currentLevel );
+
+			return;
+		}
+	}
+}
+
+Comp2D::Quality::QualityFeature* Comp2D::Quality::QualityGovernor::getFeature( unsigned int featureID )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "QualityGovernor getFeature: featureID = %u\n", featureID );
+	#endif
+
+	for
+	(
+		std::vector<QualityFeature>::iterator featureIt = m_features.begin();
+		featureIt != m_features.end();
+		++featureIt
+	)
+	{
+		if( featureIt->id == featureID )
+		{
+			return &(*featureIt);
+		}
+	}
+
+	return nullptr;
+}
+
+void Comp2D::Quality::QualityGovernor::addFrameWorkTime( Uint64 frameWorkTimeInNanoseconds )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "QualityGovernor addFrameWorkTime: frameWorkTimeInNanoseconds = %" SDL_PRIu64 "\n", frameWorkTimeInNanoseconds );
+	#endif
+
+	if( m_frameBudgetInNanoseconds == 0 )
+	{
+		return;
+	}
+
+	m_windowWorkTimeInNanoseconds += frameWorkTimeInNanoseconds;
+	++m_windowFramesCount;
+
+	if( m_windowFramesCount >= EVALUATION_WINDOW_FRAMES_COUNT )
+	{
+		evaluateWindow();
+	}
+}
+
+void Comp2D::Quality::QualityGovernor::reset()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "QualityGovernor reset\n" );
+	#endif
+
+	m_degradedFeaturesIDs.clear();
+
+	for
+	(
+		std::vector<QualityFeature>::iterator featureIt = m_features.begin();
+		featureIt != m_features.end();
+		++featureIt
+	)
+	{
+		if( featureIt->currentLevel > 0 )
+		{
+			featureIt->currentLevel = 0;
+
+			featureIt->onLevelChanged( 0 );
+		}
+	}
+
+	m_windowFramesCount = 0;
+	m_windowsToSkipCount = 0;
+	m_windowsUnderRestoreThresholdCount = 0;
+	m_windowWorkTimeInNanoseconds = 0;
+}
+
+void Comp2D::Quality::QualityGovernor::setFrameBudget( Uint64 frameBudgetInNanoseconds )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "QualityGovernor setFrameBudget: frameBudgetInNanoseconds = %" SDL_PRIu64 "\n", frameBudgetInNanoseconds );
+	#endif
+
+	m_frameBudgetInNanoseconds = frameBudgetInNanoseconds;
+}
+
+void Comp2D::Quality::QualityGovernor::unregisterFeature( unsigned int featureID )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "QualityGovernor unregisterFeature: featureID = %u\n", featureID );
+	#endif
+
+	for
+	(
+		std::vector<QualityFeature>::iterator featureIt = m_features.begin();
+		featureIt != m_features.end();
+		++featureIt
+	)
+	{
+		if( featureIt->id == featureID )
+		{
+			m_features.erase( featureIt );
+
+			return;
+		}
+	}
+}
+
+Uint32 Comp2D::Quality::QualityGovernor::getDegradedLevelsCount() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "QualityGovernor getDegradedLevelsCount\n" );
+	#endif
+
+	Uint32 degradedLevelsCount = 0;
+
+	for
+	(
+		std::vector<QualityFeature>::const_iterator featureIt = m_features.begin();
+		featureIt != m_features.end();
+		++featureIt
+	)
+	{
+		degradedLevelsCount += featureIt->currentLevel;
+	}
+
+	return degradedLevelsCount;
+}
+
+Uint32 Comp2D::Quality::QualityGovernor::getFeatureLevel( unsigned int featureID ) const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "QualityGovernor getFeatureLevel: featureID = %u\n", featureID );
+	#endif
+
+	for
+	(
+		std::vector<QualityFeature>::const_iterator featureIt = m_features.begin();
+		featureIt != m_features.end();
+		++featureIt
+	)
+	{
+		if( featureIt->id == featureID )
+		{
+			return featureIt->currentLevel;
+		}
+	}
+
+	return 0;
+}
+
+unsigned int Comp2D::Quality::QualityGovernor::registerFeature
+(
+	const std::string& name,
+	Uint32 levelsCount,
+	std::function<void(Uint32)> onLevelChanged,
+	int degradationOrder
+)
+{
+	#ifdef DEBUG
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"QualityGovernor registerFeature: name = %s; levelsCount = %u; degradationOrder = %i\n",
+			name.c_str(),
+			levelsCount,
+			degradationOrder
+		);
+	#endif
+
+	QualityFeature feature;
+
+	feature.degradationOrder = degradationOrder;
+	feature.id = m_nextFeatureID++;
+	feature.currentLevel = 0;
+	feature.levelsCount = levelsCount;
+	feature.name = name;
+	feature.onLevelChanged = onLevelChanged;
+
+	m_features.push_back( feature );
+
+	return feature.id;
+}
@@ -42,7 +42,23 @@ Comp2D::Random::MersenneTwisterRNG::MersenneTwisterRNG()
 	#endif
 
 	std::random_device randomDevice;
-	mersenne = std::mt19937( randomDevice() );
+	seed = randomDevice();
+	mersenne = std::mt19937( seed );
+
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "MersenneTwisterRNG Constructor body End\n" );
+	#endif
+}
+
+Comp2D::Random::MersenneTwisterRNG::MersenneTwisterRNG( unsigned int seed )
+	:
+	RandomNumberGenerator(),
+	seed{ seed },
+	mersenne( seed )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "MersenneTwisterRNG Constructor body Start: seed = %u\n", seed );
+	#endif
 
 	#ifdef DEBUG
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "MersenneTwisterRNG Constructor body End\n" );
@@ -60,6 +76,15 @@ Comp2D::Random::MersenneTwisterRNG::~MersenneTwisterRNG()
 	#endif
 }
 
+unsigned int Comp2D::Random::MersenneTwisterRNG::getSeed() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "MersenneTwisterRNG getSeed\n" );
+	#endif
+
+	return seed;
+}
+
 bool Comp2D::Random::MersenneTwisterRNG::getRandomBoolean()
 {
 	#ifdef DEBUG
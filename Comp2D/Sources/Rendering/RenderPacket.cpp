@@ -0,0 +1,255 @@
+/* RenderPacket.cpp -- 'Comp2D' Game Engine 'RenderPacket' class source file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#include "Comp2D/Headers/Rendering/RenderPacket.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <SDL.h>
+
+#include "Comp2D/Headers/Rendering/RenderCommand.h"
+
+Comp2D::Rendering::RenderPacket::RenderPacket()
+	:
+	m_sortRequired{ false },
+	m_lastCommandLayer{ 0 }
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPacket Constructor body Start\n" );
+	#endif
+
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPacket Constructor body End\n" );
+	#endif
+}
+
+Comp2D::Rendering::RenderPacket::~RenderPacket()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPacket Destroying\n" );
+	#endif
+
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPacket Destroyed\n" );
+	#endif
+}
+
+Comp2D::Rendering::RenderCommand& Comp2D::Rendering::RenderPacket::addCommand( ERenderCommandType type, int layer )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPacket addCommand: layer = %i\n", layer );
+	#endif
+
+	// Renderables are recorded already sorted by layer, so sorting is only
+	// needed when a command goes back to a lower layer
+	if( !m_commands.empty() && layer < m_lastCommandLayer )
+	{
+		m_sortRequired = true;
+	}
+	m_lastCommandLayer = layer;
+
+	m_commands.emplace_back();
+
+	RenderCommand& command = m_commands.back();
+
+	command.hasCenter = false;
+	command.hasDestinationRect = false;
+	command.hasSourceRect = false;
+	command.layer = layer;
+	command.firstPointIndex = 0;
+	command.pointsCount = 0;
+	command.angle = 0.0;
+	command.type = type;
+	command.flip = SDL_FLIP_NONE;
+	command.texture = nullptr;
+
+	return command;
+}
+
+void Comp2D::Rendering::RenderPacket::addCopyTextureCommand
+(
+	int layer,
+	SDL_Texture* texture,
+	const SDL_Rect* sourceRect,
+	const SDL_Rect* destinationRect,
+	double angle,
+	const SDL_Point* center,
+	SDL_RendererFlip flip
+)
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPacket addCopyTextureCommand: layer = %i\n", layer );
+	#endif
+
+	RenderCommand& command = addCommand( ERenderCommandType::CopyTexture, layer );
+
+	command.texture = texture;
+	command.angle = angle;
+	command.flip = flip;
+
+	if( sourceRect )
+	{
+		command.hasSourceRect = true;
+		command.sourceRect = *sourceRect;
+	}
+
+	if( destinationRect )
+	{
+		command.hasDestinationRect = true;
+		command.destinationRect = *destinationRect;
+	}
+
+	if( center )
+	{
+		command.hasCenter = true;
+		command.center = *center;
+	}
+}
+
+void Comp2D::Rendering::RenderPacket::addDrawLinesCommand( int layer, SDL_Color color, const SDL_Point* points, int pointsCount )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPacket addDrawLinesCommand: layer = %i; pointsCount = %i\n", layer, pointsCount );
+	#endif
+
+	if( pointsCount > 0 )
+	{
+		RenderCommand& command = addCommand( ERenderCommandType::DrawLines, layer );
+
+		command.color = color;
+		command.firstPointIndex = static_cast<Uint32>( m_points.size() );
+		command.pointsCount = static_cast<Uint32>( pointsCount );
+
+		m_points.insert( m_points.end(), points, points + pointsCount );
+	}
+}
+
+void Comp2D::Rendering::RenderPacket::addDrawPointsCommand( int layer, SDL_Color color, const SDL_Point* points, int pointsCount )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPacket addDrawPointsCommand: layer = %i; pointsCount = %i\n", layer, pointsCount );
+	#endif
+
+	if( pointsCount > 0 )
+	{
+		RenderCommand& command = addCommand( ERenderCommandType::DrawPoints, layer );
+
+		command.color = color;
+		command.firstPointIndex = static_cast<Uint32>( m_points.size() );
+		command.pointsCount = static_cast<Uint32>( pointsCount );
+
+		m_points.insert( m_points.end(), points, points + pointsCount );
+	}
+}
+
+void Comp2D::Rendering::RenderPacket::clear()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPacket clear\n" );
+	#endif
+
+	m_sortRequired = false;
+	m_lastCommandLayer = 0;
+
+	m_points.clear();
+	m_commands.clear();
+}
+
+void Comp2D::Rendering::RenderPacket::submit( SDL_Renderer* renderer )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPacket submit\n" );
+	#endif
+
+	if( m_sortRequired )
+	{
+		std::stable_sort
+		(
+			m_commands.begin(),
+			m_commands.end(),
+			[]( const RenderCommand& commandA, const RenderCommand& commandB )
+			{
+				return commandA.layer < commandB.layer;
+			}
+		);
+
+		m_sortRequired = false;
+	}
+
+	for
+	(
+		std::vector<RenderCommand>::const_iterator commandIt = m_commands.cbegin();
+		commandIt != m_commands.cend();
+		++commandIt
+	)
+	{
+		switch( commandIt->type )
+		{
+		case ERenderCommandType::CopyTexture:
+			SDL_RenderCopyEx
+			(
+				renderer,
+				commandIt->texture,
+				commandIt->hasSourceRect ? &commandIt->sourceRect : nullptr,
+				commandIt->hasDestinationRect ? &commandIt->destinationRect : nullptr,
+				commandIt->angle,
+				commandIt->hasCenter ? &commandIt->center : nullptr,
+				commandIt->flip
+			);
+			break;
+		case ERenderCommandType::DrawLines:
+			SDL_SetRenderDrawColor( renderer, commandIt->color.r, commandIt->color.g, commandIt->color.b, commandIt->color.a );
+			SDL_RenderDrawLines( renderer, &m_points[commandIt->firstPointIndex], static_cast<int>( commandIt->pointsCount ) );
+			break;
+		case ERenderCommandType::DrawPoints:
+			SDL_SetRenderDrawColor( renderer, commandIt->color.r, commandIt->color.g, commandIt->color.b, commandIt->color.a );
+			SDL_RenderDrawPoints( renderer, &m_points[commandIt->firstPointIndex], static_cast<int>( commandIt->pointsCount ) );
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+std::size_t Comp2D::Rendering::RenderPacket::getCommandsCount() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPacket getCommandsCount\n" );
+	#endif
+
+	return m_commands.size();
+}
+
+std::size_t Comp2D::Rendering::RenderPacket::getPointsCount() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPacket getPointsCount\n" );
+	#endif
+
+	return m_points.size();
+}
@@ -0,0 +1,601 @@
+/* RenderPipeline.cpp -- 'Comp2D' Game Engine 'RenderPipeline' class source file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#include "Comp2D/Headers/Rendering/RenderPipeline.h"
+
+#include <functional>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_thread.h>
+
+#include "Comp2D/Headers/Profiling/ProfilerZone.h"
+#include "Comp2D/Headers/Rendering/RenderPacket.h"
+
+Comp2D::Rendering::RenderPipeline::RenderPipeline( SDL_Renderer* renderer )
+	:
+	m_recording{ false },
+	m_renderingScaledFrame{ false },
+	m_simulationThreadRunning{ false },
+	m_simulationThreadStopRequested{ false },
+	m_currentRenderLayer{ 0 },
+	m_scaledRenderTargetHeight{ 0 },
+	m_scaledRenderTargetWidth{ 0 },
+	m_recordingRenderPacketIndex{ 0 },
+	m_renderScale{ 1.0f },
+	m_drawColor{ 0xFF, 0xFF, 0xFF, 0xFF },
+	m_renderer{ renderer },
+	m_scaledRenderTarget{ nullptr },
+	m_pendingTexturesDestructionMutex{ SDL_CreateMutex() },
+	m_simulationFrameFinishedSemaphore{ SDL_CreateSemaphore( 0 ) },
+	m_simulationFrameRequestedSemaphore{ SDL_CreateSemaphore( 0 ) },
+	m_simulationThread{ nullptr }
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPipeline Constructor body Start\n" );
+	#endif
+
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPipeline Constructor body End\n" );
+	#endif
+}
+
+Comp2D::Rendering::RenderPipeline::~RenderPipeline()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPipeline Destroying\n" );
+	#endif
+
+	stopSimulationThread();
+
+	destroyPendingTextures();
+
+	if( m_scaledRenderTarget )
+	{
+		SDL_DestroyTexture( m_scaledRenderTarget );
+		m_scaledRenderTarget = nullptr;
+	}
+
+	SDL_DestroySemaphore( m_simulationFrameRequestedSemaphore );
+	m_simulationFrameRequestedSemaphore = nullptr;
+
+	SDL_DestroySemaphore( m_simulationFrameFinishedSemaphore );
+	m_simulationFrameFinishedSemaphore = nullptr;
+
+	SDL_DestroyMutex( m_pendingTexturesDestructionMutex );
+	m_pendingTexturesDestructionMutex = nullptr;
+
+	m_renderer = nullptr;
+
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPipeline Destroyed\n" );
+	#endif
+}
+
+int Comp2D::Rendering::RenderPipeline::simulationThreadFunction( void* data )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPipeline simulationThreadFunction\n" );
+	#endif
+
+	RenderPipeline* renderPipeline = static_cast<RenderPipeline*>( data );
+
+	COMP2D_PROFILE_THREAD( "Simulation Thread" );
+
+	while( true )
+	{
+		SDL_SemWait( renderPipeline->m_simulationFrameRequestedSemaphore );
+
+		if( renderPipeline->m_simulationThreadStopRequested )
+		{
+			break;
+		}
+
+		renderPipeline->m_simulationFrameProcedure();
+
+		SDL_SemPost( renderPipeline->m_simulationFrameFinishedSemaphore );
+	}
+
+	return 0;
+}
+
+void Comp2D::Rendering::RenderPipeline::destroyPendingTextures()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPipeline destroyPendingTextures\n" );
+	#endif
+
+	SDL_LockMutex( m_pendingTexturesDestructionMutex );
+
+	for
+	(
+		std::vector<SDL_Texture*>::iterator pendingTextureIt = m_pendingTexturesDestruction.begin();
+		pendingTextureIt != m_pendingTexturesDestruction.end();
+		++pendingTextureIt
+	)
+	{
+		SDL_DestroyTexture( *pendingTextureIt );
+	}
+
+	m_pendingTexturesDestruction.clear();
+
+	SDL_UnlockMutex( m_pendingTexturesDestructionMutex );
+}
+
+bool Comp2D::Rendering::RenderPipeline::prepareScaledRenderTarget( int outputWidth, int outputHeight )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPipeline prepareScaledRenderTarget: outputWidth = %i; outputHeight = %i\n", outputWidth, outputHeight );
+	#endif
+
+	int scaledRenderTargetWidth = static_cast<int>( static_cast<float>( outputWidth ) * m_renderScale );
+	int scaledRenderTargetHeight = static_cast<int>( static_cast<float>( outputHeight ) * m_renderScale );
+
+	if( scaledRenderTargetWidth < 1 )
+	{
+		scaledRenderTargetWidth = 1;
+	}
+	if( scaledRenderTargetHeight < 1 )
+	{
+		scaledRenderTargetHeight = 1;
+	}
+
+	if
+	(
+		m_scaledRenderTarget &&
+		m_scaledRenderTargetWidth == scaledRenderTargetWidth &&
+		m_scaledRenderTargetHeight == scaledRenderTargetHeight
+	)
+	{
+		return true;
+	}
+
+	if( m_scaledRenderTarget )
+	{
+		SDL_DestroyTexture( m_scaledRenderTarget );
+		m_scaledRenderTarget = nullptr;
+	}
+
+	if( !SDL_RenderTargetSupported( m_renderer ) )
+	{
+		return false;
+	}
+
+	m_scaledRenderTarget = SDL_CreateTexture
+	(
+		m_renderer,
+		SDL_PIXELFORMAT_RGBA8888,
+		SDL_TEXTUREACCESS_TARGET,
+		scaledRenderTargetWidth,
+		scaledRenderTargetHeight
+	);
+
+	if( m_scaledRenderTarget == nullptr )
+	{
+		SDL_LogError( SDL_LOG_CATEGORY_RENDER, "Failed to create the scaled render target! SDL Error: %s\n", SDL_GetError() );
+
+		return false;
+	}
+
+	m_scaledRenderTargetWidth = scaledRenderTargetWidth;
+	m_scaledRenderTargetHeight = scaledRenderTargetHeight;
+
+	return true;
+}
+
+void Comp2D::Rendering::RenderPipeline::beginFrame()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPipeline beginFrame\n" );
+	#endif
+
+	SDL_SetRenderDrawColor( m_renderer, 0x00, 0x00, 0x00, 0xFF );
+	SDL_RenderClear( m_renderer );
+
+	if( m_renderScale >= 1.0f )
+	{
+		return;
+	}
+
+	int outputWidth;
+	int outputHeight;
+
+	SDL_GetRendererOutputSize( m_renderer, &outputWidth, &outputHeight );
+
+	// Without render targets the frame is drawn at full resolution
+	if( !prepareScaledRenderTarget( outputWidth, outputHeight ) )
+	{
+		m_renderScale = 1.0f;
+
+		return;
+	}
+
+	SDL_SetRenderTarget( m_renderer, m_scaledRenderTarget );
+	// Keeps every draw call in window coordinates
+	SDL_RenderSetScale
+	(
+		m_renderer,
+		static_cast<float>( m_scaledRenderTargetWidth ) / static_cast<float>( outputWidth ),
+		static_cast<float>( m_scaledRenderTargetHeight ) / static_cast<float>( outputHeight )
+	);
+	SDL_RenderClear( m_renderer );
+
+	m_renderingScaledFrame = true;
+}
+
+void Comp2D::Rendering::RenderPipeline::beginRecording()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPipeline beginRecording\n" );
+	#endif
+
+	// The simulation thread is idle and the last recorded packet was already
+	// submitted, so no command can still reference these textures
+	destroyPendingTextures();
+
+	m_renderPackets[m_recordingRenderPacketIndex].clear();
+
+	m_currentRenderLayer = 0;
+
+	m_recording = true;
+}
+
+void Comp2D::Rendering::RenderPipeline::copyTexture
+(
+	SDL_Texture* texture,
+	const SDL_Rect* sourceRect,
+	const SDL_Rect* destinationRect
+)
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPipeline copyTexture\n" );
+	#endif
+
+	if( m_recording )
+	{
+		m_renderPackets[m_recordingRenderPacketIndex].addCopyTextureCommand
+		(
+			m_currentRenderLayer,
+			texture,
+			sourceRect,
+			destinationRect
+		);
+	}
+	else
+	{
+		SDL_RenderCopy( m_renderer, texture, sourceRect, destinationRect );
+	}
+}
+
+void Comp2D::Rendering::RenderPipeline::copyTexture
+(
+	SDL_Texture* texture,
+	const SDL_Rect* sourceRect,
+	const SDL_Rect* destinationRect,
+	double angle,
+	const SDL_Point* center,
+	SDL_RendererFlip flip
+)
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPipeline copyTexture: angle = %f\n", angle );
+	#endif
+
+	if( m_recording )
+	{
+		m_renderPackets[m_recordingRenderPacketIndex].addCopyTextureCommand
+		(
+			m_currentRenderLayer,
+			texture,
+			sourceRect,
+			destinationRect,
+			angle,
+			center,
+			flip
+		);
+	}
+	else
+	{
+		SDL_RenderCopyEx( m_renderer, texture, sourceRect, destinationRect, angle, center, flip );
+	}
+}
+
+void Comp2D::Rendering::RenderPipeline::destroyTexture( SDL_Texture* texture )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPipeline destroyTexture: texture = %p\n", texture );
+	#endif
+
+	if( texture == nullptr )
+	{
+		return;
+	}
+
+	// While pipelined, the packet being submitted may still reference the
+	// texture, so destruction waits for the next recording
+	if( m_simulationThreadRunning )
+	{
+		SDL_LockMutex( m_pendingTexturesDestructionMutex );
+
+		m_pendingTexturesDestruction.push_back( texture );
+
+		SDL_UnlockMutex( m_pendingTexturesDestructionMutex );
+	}
+	else
+	{
+		SDL_DestroyTexture( texture );
+	}
+}
+
+void Comp2D::Rendering::RenderPipeline::drawLine( int x1, int y1, int x2, int y2 )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPipeline drawLine: x1 = %i; y1 = %i; x2 = %i; y2 = %i\n", x1, y1, x2, y2 );
+	#endif
+
+	SDL_Point linePoints[2] = { SDL_Point{ x1, y1 }, SDL_Point{ x2, y2 } };
+
+	drawLines( linePoints, 2 );
+}
+
+void Comp2D::Rendering::RenderPipeline::drawLines( const SDL_Point* points, int pointsCount )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPipeline drawLines: pointsCount = %i\n", pointsCount );
+	#endif
+
+	if( m_recording )
+	{
+		m_renderPackets[m_recordingRenderPacketIndex].addDrawLinesCommand( m_currentRenderLayer, m_drawColor, points, pointsCount );
+	}
+	else
+	{
+		SDL_RenderDrawLines( m_renderer, points, pointsCount );
+	}
+}
+
+void Comp2D::Rendering::RenderPipeline::drawPoints( const SDL_Point* points, int pointsCount )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPipeline drawPoints: pointsCount = %i\n", pointsCount );
+	#endif
+
+	if( m_recording )
+	{
+		m_renderPackets[m_recordingRenderPacketIndex].addDrawPointsCommand( m_currentRenderLayer, m_drawColor, points, pointsCount );
+	}
+	else
+	{
+		SDL_RenderDrawPoints( m_renderer, points, pointsCount );
+	}
+}
+
+void Comp2D::Rendering::RenderPipeline::endFrame()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPipeline endFrame\n" );
+	#endif
+
+	if( m_renderingScaledFrame )
+	{
+		SDL_SetRenderTarget( m_renderer, nullptr );
+		SDL_RenderSetScale( m_renderer, 1.0f, 1.0f );
+
+		SDL_RenderCopy( m_renderer, m_scaledRenderTarget, nullptr, nullptr );
+
+		m_renderingScaledFrame = false;
+	}
+}
+
+void Comp2D::Rendering::RenderPipeline::endRecording()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPipeline endRecording\n" );
+	#endif
+
+	m_recording = false;
+
+	m_recordingRenderPacketIndex = ( m_recordingRenderPacketIndex + 1 ) % RENDER_PACKETS_COUNT;
+}
+
+void Comp2D::Rendering::RenderPipeline::requestSimulationFrame()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPipeline requestSimulationFrame\n" );
+	#endif
+
+	if( m_simulationThreadRunning )
+	{
+		SDL_SemPost( m_simulationFrameRequestedSemaphore );
+	}
+	else
+	{
+		m_simulationFrameProcedure();
+	}
+}
+
+void Comp2D::Rendering::RenderPipeline::setCurrentRenderLayer( int renderLayer )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPipeline setCurrentRenderLayer: renderLayer = %i\n", renderLayer );
+	#endif
+
+	m_currentRenderLayer = renderLayer;
+}
+
+void Comp2D::Rendering::RenderPipeline::setDrawColor( Uint8 r, Uint8 g, Uint8 b, Uint8 a )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPipeline setDrawColor: r = %u; g = %u; b = %u; a = %u\n", r, g, b, a );
+	#endif
+
+	m_drawColor = SDL_Color{ r, g, b, a };
+
+	if( !m_recording )
+	{
+		SDL_SetRenderDrawColor( m_renderer, r, g, b, a );
+	}
+}
+
+void Comp2D::Rendering::RenderPipeline::setRenderScale( float renderScale )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPipeline setRenderScale: renderScale = %f\n", renderScale );
+	#endif
+
+	if( renderScale < MINIMUM_RENDER_SCALE )
+	{
+		m_renderScale = MINIMUM_RENDER_SCALE;
+	}
+	else if( renderScale > 1.0f )
+	{
+		m_renderScale = 1.0f;
+	}
+	else
+	{
+		m_renderScale = renderScale;
+	}
+}
+
+void Comp2D::Rendering::RenderPipeline::stopSimulationThread()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPipeline stopSimulationThread\n" );
+	#endif
+
+	if( m_simulationThreadRunning )
+	{
+		m_simulationThreadStopRequested = true;
+
+		SDL_SemPost( m_simulationFrameRequestedSemaphore );
+
+		SDL_WaitThread( m_simulationThread, nullptr );
+		m_simulationThread = nullptr;
+
+		m_simulationThreadRunning = false;
+		m_simulationThreadStopRequested = false;
+
+		destroyPendingTextures();
+	}
+}
+
+void Comp2D::Rendering::RenderPipeline::submitRecordedRenderPacket()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPipeline submitRecordedRenderPacket\n" );
+	#endif
+
+	m_renderPackets[( m_recordingRenderPacketIndex + 1 ) % RENDER_PACKETS_COUNT].submit( m_renderer );
+}
+
+void Comp2D::Rendering::RenderPipeline::waitForSimulationFrame()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPipeline waitForSimulationFrame\n" );
+	#endif
+
+	if( m_simulationThreadRunning )
+	{
+		SDL_SemWait( m_simulationFrameFinishedSemaphore );
+	}
+}
+
+bool Comp2D::Rendering::RenderPipeline::startSimulationThread( std::function<void()> simulationFrameProcedure )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPipeline startSimulationThread\n" );
+	#endif
+
+	m_simulationFrameProcedure = simulationFrameProcedure;
+
+	if( m_simulationThreadRunning )
+	{
+		return true;
+	}
+
+	if
+	(
+		m_pendingTexturesDestructionMutex == nullptr ||
+		m_simulationFrameFinishedSemaphore == nullptr ||
+		m_simulationFrameRequestedSemaphore == nullptr
+	)
+	{
+		return false;
+	}
+
+	// Set before the thread exists, so that textures released by the very
+	// first simulation frame are already deferred
+	m_simulationThreadRunning = true;
+
+	m_simulationThread = SDL_CreateThread( simulationThreadFunction, "Comp2D Simulation", this );
+
+	if( m_simulationThread == nullptr )
+	{
+		#ifdef DEBUG
+			SDL_LogError( SDL_LOG_CATEGORY_APPLICATION, "Simulation thread could not be created! SDL Error: %s\n", SDL_GetError() );
+		#endif
+
+		m_simulationThreadRunning = false;
+	}
+
+	return m_simulationThreadRunning;
+}
+
+bool Comp2D::Rendering::RenderPipeline::isRecording() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPipeline isRecording\n" );
+	#endif
+
+	return m_recording;
+}
+
+bool Comp2D::Rendering::RenderPipeline::isSimulationThreadRunning() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPipeline isSimulationThreadRunning\n" );
+	#endif
+
+	return m_simulationThreadRunning;
+}
+
+float Comp2D::Rendering::RenderPipeline::getRenderScale() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPipeline getRenderScale\n" );
+	#endif
+
+	return m_renderScale;
+}
+
+const Comp2D::Rendering::RenderPacket& Comp2D::Rendering::RenderPipeline::getRecordedRenderPacket() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "RenderPipeline getRecordedRenderPacket\n" );
+	#endif
+
+	return m_renderPackets[( m_recordingRenderPacketIndex + 1 ) % RENDER_PACKETS_COUNT];
+}
@@ -33,7 +33,8 @@
 Comp2D::Resources::Resource::Resource( const std::string& name )
 	:
 	m_name( name ),
-	m_loaded( false )
+	m_loaded( false ),
+	m_loadMutex{ SDL_CreateMutex() }
 {
 	#ifdef DEBUG
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Resource named %s Constructor body Start\n", m_name.c_str() );
@@ -50,11 +51,21 @@ Comp2D::Resources::Resource::~Resource()
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Resource named %s Destroying\n", m_name.c_str() );
 	#endif
 
+	SDL_DestroyMutex( m_loadMutex );
+	m_loadMutex = nullptr;
+
 	#ifdef DEBUG
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Resource named %s Destroyed\n", m_name.c_str() );
 	#endif
 }
 
+void Comp2D::Resources::Resource::preload()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Resource named %s preload\n", m_name.c_str() );
+	#endif
+}
+
 bool Comp2D::Resources::Resource::isLoaded() const
 {
 	#ifdef DEBUG
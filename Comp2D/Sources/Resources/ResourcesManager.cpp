@@ -33,12 +33,15 @@
 
 #include <SDL.h>
 
+#include "Comp2D/Headers/Profiling/ProfilerZone.h"
 #include "Comp2D/Headers/Resources/FontResource.h"
 #include "Comp2D/Headers/Resources/GenericResource.h"
 #include "Comp2D/Headers/Resources/MusicResource.h"
 #include "Comp2D/Headers/Resources/Resource.h"
+#include "Comp2D/Headers/Resources/ResourcesPreload.h"
 #include "Comp2D/Headers/Resources/SoundEffectResource.h"
 #include "Comp2D/Headers/Resources/TextureResource.h"
+#include "Comp2D/Headers/Time/StartupReport.h"
 
 Comp2D::Resources::ResourcesManager::ResourcesManager()
 	:
@@ -124,7 +127,12 @@ Comp2D::Resources::Resource* Comp2D::Resources::ResourcesManager::loadResource
 			resourceName.compare( currentResource->getName() ) == 0
 		)
 		{
+			Uint64 loadStartCounter = SDL_GetPerformanceCounter();
+
 			currentResource->load();
+
+			Comp2D::Time::StartupReport::addResourceTime( resourceName, loadStartCounter );
+
 			return currentResource;
 		}
 	}
@@ -142,6 +150,8 @@ void Comp2D::Resources::ResourcesManager::loadResources
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ResourcesManager loadResources: appendWithLoaded = %i\n", appendWithLoaded );
 	#endif
 
+	COMP2D_PROFILE_ZONE( "ResourcesManager::loadResources" );
+
 	if( !appendWithLoaded )
 	{
 		freeAllResources();
@@ -168,7 +178,12 @@ void Comp2D::Resources::ResourcesManager::loadResources
 			{
 				//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ResourcesManager Loading Resource named %s", (*resourceNameIt).c_str() );
 
+				Uint64 loadStartCounter = SDL_GetPerformanceCounter();
+
 				currentResource->load();
+
+				Comp2D::Time::StartupReport::addResourceTime( currentResource->getName(), loadStartCounter );
+
 				break;
 			}
 		}
@@ -194,6 +209,35 @@ void Comp2D::Resources::ResourcesManager::loadAllResources()
 	}
 }
 
+Comp2D::Resources::ResourcesPreload* Comp2D::Resources::ResourcesManager::preloadResources( const std::set<std::string>& resourcesNames )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ResourcesManager preloadResources\n" );
+	#endif
+
+	std::vector<Comp2D::Resources::Resource*> preloadedResources;
+
+	for( unsigned int i = 0; i < m_resources.size(); ++i )
+	{
+		Comp2D::Resources::Resource* currentResource = m_resources[i];
+
+		if
+		(
+			!currentResource->isLoaded() &&
+			resourcesNames.find( currentResource->getName() ) != resourcesNames.end()
+		)
+		{
+			preloadedResources.push_back( currentResource );
+		}
+	}
+
+	Comp2D::Resources::ResourcesPreload* resourcesPreload = new Comp2D::Resources::ResourcesPreload( preloadedResources );
+
+	resourcesPreload->start();
+
+	return resourcesPreload;
+}
+
 void Comp2D::Resources::ResourcesManager::freeResource( const std::string& resourceName )
 {
 	#ifdef DEBUG
@@ -0,0 +1,174 @@
+/* ResourcesPreload.cpp -- 'Comp2D' Game Engine 'ResourcesPreload' class source file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#include "Comp2D/Headers/Resources/ResourcesPreload.h"
+
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_atomic.h>
+
+#include "Comp2D/Headers/Game.h"
+#include "Comp2D/Headers/Jobs/JobCounter.h"
+#include "Comp2D/Headers/Jobs/JobSystem.h"
+#include "Comp2D/Headers/Resources/Resource.h"
+#include "Comp2D/Headers/Time/StartupReport.h"
+#include "Comp2D/Headers/Time/TimeManager.h"
+
+Comp2D::Resources::ResourcesPreload::ResourcesPreload( const std::vector<Resource*>& resources )
+	:
+	m_loadedResourcesCount{ 0 },
+	m_resources{ resources }
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ResourcesPreload Constructor body Start\n" );
+	#endif
+
+	SDL_AtomicSet( &m_preloadedResourcesCount, 0 );
+
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ResourcesPreload Constructor body End\n" );
+	#endif
+}
+
+Comp2D::Resources::ResourcesPreload::~ResourcesPreload()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ResourcesPreload Destroying\n" );
+	#endif
+
+	// The preload Jobs reference this object
+	Comp2D::Game::jobSystem->waitForCounter( &m_preloadsCounter );
+
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ResourcesPreload Destroyed\n" );
+	#endif
+}
+
+void Comp2D::Resources::ResourcesPreload::start()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ResourcesPreload start: resources count = %u\n", static_cast<Uint32>( m_resources.size() ) );
+	#endif
+
+	for
+	(
+		std::vector<Resource*>::iterator resourceIt = m_resources.begin();
+		resourceIt != m_resources.end();
+		++resourceIt
+	)
+	{
+		Resource* resource = (*resourceIt);
+
+		Comp2D::Game::jobSystem->run
+		(
+			[this, resource]()
+			{
+				Uint64 preloadStartCounter = SDL_GetPerformanceCounter();
+
+				resource->preload();
+
+				Comp2D::Time::StartupReport::addResourceTime( resource->getName(), preloadStartCounter );
+
+				SDL_AtomicAdd( &m_preloadedResourcesCount, 1 );
+			},
+			&m_preloadsCounter
+		);
+	}
+}
+
+bool Comp2D::Resources::ResourcesPreload::update( Uint64 timeBudgetInNanoseconds )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ResourcesPreload update: timeBudgetInNanoseconds = %" SDL_PRIu64 "\n", timeBudgetInNanoseconds );
+	#endif
+
+	if( !m_preloadsCounter.isDone() )
+	{
+		return false;
+	}
+
+	Uint64 timeOnUpdateStarted = Comp2D::Game::getTimeManager()->getRealTimeSinceSDLInitializationInNanoseconds();
+
+	// At least one Resource is loaded per update, whatever the budget
+	while( m_loadedResourcesCount < m_resources.size() )
+	{
+		Resource* resource = m_resources[m_loadedResourcesCount];
+
+		if( !resource->isLoaded() )
+		{
+			Uint64 loadStartCounter = SDL_GetPerformanceCounter();
+
+			resource->load();
+
+			Comp2D::Time::StartupReport::addResourceTime( resource->getName(), loadStartCounter );
+		}
+
+		++m_loadedResourcesCount;
+
+		if( Comp2D::Game::getTimeManager()->getRealTimeSinceSDLInitializationInNanoseconds() - timeOnUpdateStarted >= timeBudgetInNanoseconds )
+		{
+			break;
+		}
+	}
+
+	return isDone();
+}
+
+void Comp2D::Resources::ResourcesPreload::complete()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ResourcesPreload complete\n" );
+	#endif
+
+	Comp2D::Game::jobSystem->waitForCounter( &m_preloadsCounter );
+
+	update( SDL_MAX_UINT64 );
+}
+
+bool Comp2D::Resources::ResourcesPreload::isDone()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ResourcesPreload isDone\n" );
+	#endif
+
+	return m_loadedResourcesCount == m_resources.size();
+}
+
+float Comp2D::Resources::ResourcesPreload::getProgress()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "ResourcesPreload getProgress\n" );
+	#endif
+
+	if( m_resources.empty() )
+	{
+		return 1.0f;
+	}
+
+	return static_cast<float>( static_cast<Uint32>( SDL_AtomicGet( &m_preloadedResourcesCount ) ) + m_loadedResourcesCount ) /
+		   static_cast<float>( 2 * m_resources.size() );
+}
@@ -57,6 +57,13 @@ Comp2D::Resources::SoundEffectResource::~SoundEffectResource()
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "SoundEffectResource named %s Destroying\n", m_name.c_str() );
 	#endif
 
+	// Preloaded but never loaded
+	if( !m_loaded )
+	{
+		Mix_FreeChunk( m_soundEffect );
+		m_soundEffect = nullptr;
+	}
+
 	#ifdef DEBUG
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "SoundEffectResource named %s Destroyed\n", m_name.c_str() );
 	#endif
@@ -68,7 +75,12 @@ void Comp2D::Resources::SoundEffectResource::load()
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "SoundEffectResource named %s load\n", m_name.c_str() );
 	#endif
 
-	m_soundEffect = Mix_LoadWAV( m_filePath.c_str() );
+	SDL_LockMutex( m_loadMutex );
+
+	if( m_soundEffect == nullptr )
+	{
+		m_soundEffect = Mix_LoadWAV( m_filePath.c_str() );
+	}
 
 	if( m_soundEffect )
 	{
@@ -88,6 +100,8 @@ void Comp2D::Resources::SoundEffectResource::load()
 
 		Comp2D::Game::reportError( "Fatal Error: 008", "Failed to load sound effect resource! SDL_mixer Error: ", Mix_GetError() );
 	}
+
+	SDL_UnlockMutex( m_loadMutex );
 }
 
 void Comp2D::Resources::SoundEffectResource::free()
@@ -96,9 +110,29 @@ void Comp2D::Resources::SoundEffectResource::free()
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "SoundEffectResource named %s free\n", m_name.c_str() );
 	#endif
 
+	SDL_LockMutex( m_loadMutex );
+
 	Mix_FreeChunk( m_soundEffect );
 	m_soundEffect = nullptr;
 	m_loaded = false;
+
+	SDL_UnlockMutex( m_loadMutex );
+}
+
+void Comp2D::Resources::SoundEffectResource::preload()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "SoundEffectResource named %s preload\n", m_name.c_str() );
+	#endif
+
+	SDL_LockMutex( m_loadMutex );
+
+	if( !m_loaded && m_soundEffect == nullptr )
+	{
+		m_soundEffect = Mix_LoadWAV( m_filePath.c_str() );
+	}
+
+	SDL_UnlockMutex( m_loadMutex );
 }
 
 Mix_Chunk* Comp2D::Resources::SoundEffectResource::getSoundEffect() const
@@ -58,49 +58,83 @@ Comp2D::Resources::TextureResource::~TextureResource()
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TextureResource named %s Destroying\n", m_name.c_str() );
 	#endif
 
+	SDL_FreeSurface( m_preloadedSurface );
+	m_preloadedSurface = nullptr;
+
 	#ifdef DEBUG
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TextureResource named %s Destroyed\n", m_name.c_str() );
 	#endif
 }
 
-void Comp2D::Resources::TextureResource::load()
+SDL_Surface* Comp2D::Resources::TextureResource::loadSurface() const
 {
 	#ifdef DEBUG
-		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TextureResource named %s load\n", m_name.c_str() );
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TextureResource named %s loadSurface\n", m_name.c_str() );
 	#endif
 
 	SDL_Surface* loadedSurface = IMG_Load( m_filePath.c_str() );
 
 	if( loadedSurface )
 	{
-		m_width = loadedSurface->w;
-		m_height = loadedSurface->h;
-
 		SDL_SetSurfaceColorMod( loadedSurface, m_modColor.r, m_modColor.g, m_modColor.b );
 
 		SDL_SetSurfaceBlendMode( loadedSurface, SDL_BLENDMODE_BLEND );
+	}
 
-		m_texture = SDL_CreateTextureFromSurface( Comp2D::Game::renderer, loadedSurface );
+	return loadedSurface;
+}
 
-		if( m_texture )
-		{
-			SDL_SetTextureBlendMode( m_texture, SDL_BLENDMODE_BLEND );
+void Comp2D::Resources::TextureResource::load()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TextureResource named %s load\n", m_name.c_str() );
+	#endif
+
+	SDL_LockMutex( m_loadMutex );
+
+	SDL_Surface* loadedSurface = m_preloadedSurface;
 
+	m_preloadedSurface = nullptr;
+
+	if( loadedSurface == nullptr )
+	{
+		loadedSurface = loadSurface();
+	}
+
+	if( loadedSurface )
+	{
+		m_width = loadedSurface->w;
+		m_height = loadedSurface->h;
+
+		// Without renderer only the image dimensions are kept, nothing is drawn
+		if( Comp2D::Game::gameSettings->isHeadless() )
+		{
 			m_loaded = true;
 		}
 		else
 		{
-			#ifdef DEBUG
-				SDL_LogError
-				(
-					SDL_LOG_CATEGORY_APPLICATION,
-					"Unable to create texture from %s! SDL Error: %s\n",
-					m_filePath.c_str(),
-					SDL_GetError()
-				);
-			#endif
-
-			Comp2D::Game::reportError( "Fatal Error: 010", "Unable to create texture! SDL Error: ", SDL_GetError() );
+			m_texture = SDL_CreateTextureFromSurface( Comp2D::Game::renderer, loadedSurface );
+
+			if( m_texture )
+			{
+				SDL_SetTextureBlendMode( m_texture, SDL_BLENDMODE_BLEND );
+
+				m_loaded = true;
+			}
+			else
+			{
+				#ifdef DEBUG
+					SDL_LogError
+					(
+						SDL_LOG_CATEGORY_APPLICATION,
+						"Unable to create texture from %s! SDL Error: %s\n",
+						m_filePath.c_str(),
+						SDL_GetError()
+					);
+				#endif
+
+				Comp2D::Game::reportError( "Fatal Error: 010", "Unable to create texture! SDL Error: ", SDL_GetError() );
+			}
 		}
 
 		SDL_FreeSurface( loadedSurface );
@@ -119,6 +153,8 @@ void Comp2D::Resources::TextureResource::load()
 
 		Comp2D::Game::reportError( "Fatal Error: 009", "Unable to load image! SDL_image Error: ", IMG_GetError() );
 	}
+
+	SDL_UnlockMutex( m_loadMutex );
 }
 
 void Comp2D::Resources::TextureResource::free()
@@ -127,11 +163,37 @@ void Comp2D::Resources::TextureResource::free()
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TextureResource named %s free\n", m_name.c_str() );
 	#endif
 
-	SDL_DestroyTexture( m_texture );
+	SDL_LockMutex( m_loadMutex );
+
+	// Headless games have no render pipeline, load only kept the dimensions
+	if( Comp2D::Game::renderPipeline )
+	{
+		Comp2D::Game::renderPipeline->destroyTexture( m_texture );
+	}
 
 	m_texture = nullptr;
 
 	m_loaded = false;
+
+	SDL_UnlockMutex( m_loadMutex );
+}
+
+void Comp2D::Resources::TextureResource::preload()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TextureResource named %s preload\n", m_name.c_str() );
+	#endif
+
+	// Decoding the image is the slow part, the texture upload stays on the
+	// game thread since it needs the renderer
+	SDL_LockMutex( m_loadMutex );
+
+	if( !m_loaded && m_preloadedSurface == nullptr )
+	{
+		m_preloadedSurface = loadSurface();
+	}
+
+	SDL_UnlockMutex( m_loadMutex );
 }
 
 void Comp2D::Resources::TextureResource::setModColor( Uint8 r, Uint8 g, Uint8 b )
@@ -26,6 +26,7 @@
 
 #include "Comp2D/Headers/Settings/GameSettings.h"
 
+#include <cstdlib>
 #include <string>
 
 #include <SDL.h>
@@ -33,19 +34,33 @@
 
 #include "Comp2D/Headers/Settings/AudioSettings.h"
 #include "Comp2D/Headers/Settings/GraphicsSettings.h"
+#include "Comp2D/Headers/Settings/TimeSettings.h"
 
 Comp2D::Settings::GameSettings::GameSettings()
 	:
+	m_adaptiveQuality{ false },
+	m_headless{ false },
 	m_imageLoadingFlags{ IMG_INIT_PNG },
 	m_windowInitXPos{ SDL_WINDOWPOS_UNDEFINED },
 	m_windowInitYPos{ SDL_WINDOWPOS_UNDEFINED },
+	m_jobWorkersCount{ 1 },
 	m_windowFlags{ SDL_WINDOW_SHOWN },
+	m_inputsRecordingFilePath{ "" },
+	m_inputsReplayFilePath{ "" },
 	m_windowTitle{ "Comp2D Game" }
 {
 	#ifdef DEBUG
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameSettings Constructor body Start\n" );
 	#endif
 
+	// One core is left to the game thread, which helps running jobs while
+	// it waits on them
+	int cpuCount = SDL_GetCPUCount();
+	if( cpuCount > 2 )
+	{
+		m_jobWorkersCount = static_cast<Uint32>( cpuCount - 1 );
+	}
+
 	#ifdef DEBUG
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameSettings Constructor body End\n" );
 	#endif
@@ -62,6 +77,101 @@ Comp2D::Settings::GameSettings::~GameSettings()
 	#endif
 }
 
+void Comp2D::Settings::GameSettings::parseCommandLineArguments( int argc, char* argv[] )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameSettings parseCommandLineArguments: argc = %i\n", argc );
+	#endif
+
+	const std::string headlessSimulationSpeedArgumentPrefix = "--headless-simulation-speed=";
+	const std::string inputsRecordingFilePathArgumentPrefix = "--record-inputs=";
+	const std::string inputsReplayFilePathArgumentPrefix = "--replay-inputs=";
+
+	for( int argIndex = 1; argIndex < argc; ++argIndex )
+	{
+		std::string argument = argv[argIndex];
+
+		if( argument == "--adaptive-quality" )
+		{
+			setAdaptiveQuality( true );
+		}
+		else if( argument == "--headless" )
+		{
+			setHeadless( true );
+		}
+		else if( argument.compare( 0, headlessSimulationSpeedArgumentPrefix.size(), headlessSimulationSpeedArgumentPrefix ) == 0 )
+		{
+			timeSettings.setHeadlessSimulationSpeed
+			(
+				static_cast<float>( std::strtod( argument.c_str() + headlessSimulationSpeedArgumentPrefix.size(), nullptr ) )
+			);
+		}
+		else if( argument.compare( 0, inputsRecordingFilePathArgumentPrefix.size(), inputsRecordingFilePathArgumentPrefix ) == 0 )
+		{
+			setInputsRecordingFilePath( argument.substr( inputsRecordingFilePathArgumentPrefix.size() ) );
+		}
+		else if( argument.compare( 0, inputsReplayFilePathArgumentPrefix.size(), inputsReplayFilePathArgumentPrefix ) == 0 )
+		{
+			setInputsReplayFilePath( argument.substr( inputsReplayFilePathArgumentPrefix.size() ) );
+			setHeadless( true );
+		}
+	}
+}
+
+void Comp2D::Settings::GameSettings::setAdaptiveQuality( bool adaptiveQuality )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameSettings setAdaptiveQuality: adaptiveQuality = %i\n", adaptiveQuality );
+	#endif
+
+	m_adaptiveQuality = adaptiveQuality;
+}
+
+void Comp2D::Settings::GameSettings::setHeadless( bool headless )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameSettings setHeadless: headless = %i\n", headless );
+	#endif
+
+	m_headless = headless;
+}
+
+bool Comp2D::Settings::GameSettings::isAdaptiveQualityEnabled() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameSettings isAdaptiveQualityEnabled\n" );
+	#endif
+
+	return m_adaptiveQuality;
+}
+
+bool Comp2D::Settings::GameSettings::isHeadless() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameSettings isHeadless\n" );
+	#endif
+
+	return m_headless;
+}
+
+void Comp2D::Settings::GameSettings::setInputsRecordingFilePath( const std::string& inputsRecordingFilePath )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameSettings setInputsRecordingFilePath: inputsRecordingFilePath = %s\n", inputsRecordingFilePath.c_str() );
+	#endif
+
+	m_inputsRecordingFilePath = inputsRecordingFilePath;
+}
+
+void Comp2D::Settings::GameSettings::setInputsReplayFilePath( const std::string& inputsReplayFilePath )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameSettings setInputsReplayFilePath: inputsReplayFilePath = %s\n", inputsReplayFilePath.c_str() );
+	#endif
+
+	m_inputsReplayFilePath = inputsReplayFilePath;
+}
+
 int Comp2D::Settings::GameSettings::getImageLoadingFlags() const
 {
 	#ifdef DEBUG
@@ -89,6 +199,15 @@ int Comp2D::Settings::GameSettings::getWindowInitYPos() const
 	return m_windowInitYPos;
 }
 
+Uint32 Comp2D::Settings::GameSettings::getJobWorkersCount() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameSettings getJobWorkersCount\n" );
+	#endif
+
+	return m_jobWorkersCount;
+}
+
 Uint32 Comp2D::Settings::GameSettings::getWindowFlags() const
 {
 	#ifdef DEBUG
@@ -98,6 +217,24 @@ Uint32 Comp2D::Settings::GameSettings::getWindowFlags() const
 	return m_windowFlags;
 }
 
+const std::string& Comp2D::Settings::GameSettings::getInputsRecordingFilePath() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameSettings getInputsRecordingFilePath\n" );
+	#endif
+
+	return m_inputsRecordingFilePath;
+}
+
+const std::string& Comp2D::Settings::GameSettings::getInputsReplayFilePath() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameSettings getInputsReplayFilePath\n" );
+	#endif
+
+	return m_inputsReplayFilePath;
+}
+
 const std::string& Comp2D::Settings::GameSettings::getWindowTitle() const
 {
 	#ifdef DEBUG
@@ -30,6 +30,7 @@
 
 Comp2D::Settings::GraphicsSettings::GraphicsSettings()
 	:
+	m_pipelinedRendering{ DEFAULT_PIPELINED_RENDERING },
 	m_rendererFlags
 	{
 		SDL_RENDERER_ACCELERATED
@@ -121,6 +122,24 @@ void Comp2D::Settings::GraphicsSettings::setScreenDimensions( int width, int hei
 	setScreenHeight( height );
 }
 
+void Comp2D::Settings::GraphicsSettings::setPipelinedRendering( bool pipelinedRendering )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GraphicsSettings setPipelinedRendering: pipelinedRendering = %i\n", pipelinedRendering );
+	#endif
+
+	m_pipelinedRendering = pipelinedRendering;
+}
+
+bool Comp2D::Settings::GraphicsSettings::isPipelinedRenderingEnabled() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GraphicsSettings isPipelinedRenderingEnabled\n" );
+	#endif
+
+	return m_pipelinedRendering;
+}
+
 int Comp2D::Settings::GraphicsSettings::getScreenWidth() const
 {
 	#ifdef DEBUG
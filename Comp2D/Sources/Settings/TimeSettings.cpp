@@ -0,0 +1,253 @@
+/* TimeSettings.cpp -- 'Comp2D' Game Engine 'TimeSettings' class source file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#include "Comp2D/Headers/Settings/TimeSettings.h"
+
+#include <SDL.h>
+
+Comp2D::Settings::TimeSettings::TimeSettings()
+	:
+	m_throttleWhenUnfocused{ DEFAULT_THROTTLE_WHEN_UNFOCUSED },
+	m_maximumFixedUpdatesPerFrame{ DEFAULT_MAXIMUM_FIXED_UPDATES_PER_FRAME },
+	m_maximumPostedProceduresPerFrame{ DEFAULT_MAXIMUM_POSTED_PROCEDURES_PER_FRAME },
+	m_deltaTimeSmoothingFactor{ DEFAULT_DELTA_TIME_SMOOTHING_FACTOR },
+	m_fixedDeltaTimeInSeconds{ DEFAULT_FIXED_DELTA_TIME_IN_SECONDS },
+	m_frameBudgetInSeconds{ DEFAULT_FRAME_BUDGET_IN_SECONDS },
+	m_headlessSimulationSpeed{ DEFAULT_HEADLESS_SIMULATION_SPEED },
+	m_throttledTicksPerSecond{ DEFAULT_THROTTLED_TICKS_PER_SECOND }
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeSettings Constructor body Start\n" );
+	#endif
+
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeSettings Constructor body End\n" );
+	#endif
+}
+
+Comp2D::Settings::TimeSettings::~TimeSettings()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeSettings Destroying\n" );
+	#endif
+
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeSettings Destroyed\n" );
+	#endif
+}
+
+void Comp2D::Settings::TimeSettings::setDeltaTimeSmoothingFactor( float deltaTimeSmoothingFactor )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeSettings setDeltaTimeSmoothingFactor: deltaTimeSmoothingFactor = %f\n", deltaTimeSmoothingFactor );
+	#endif
+
+	if( deltaTimeSmoothingFactor > 0.0f && deltaTimeSmoothingFactor <= 1.0f )
+	{
+		m_deltaTimeSmoothingFactor = deltaTimeSmoothingFactor;
+	}
+	else
+	{
+		m_deltaTimeSmoothingFactor = DEFAULT_DELTA_TIME_SMOOTHING_FACTOR;
+	}
+}
+
+void Comp2D::Settings::TimeSettings::setFixedDeltaTimeInSeconds( float fixedDeltaTimeInSeconds )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeSettings setFixedDeltaTimeInSeconds: fixedDeltaTimeInSeconds = %f\n", fixedDeltaTimeInSeconds );
+	#endif
+
+	if( fixedDeltaTimeInSeconds > 0.0f )
+	{
+		m_fixedDeltaTimeInSeconds = fixedDeltaTimeInSeconds;
+	}
+	else
+	{
+		m_fixedDeltaTimeInSeconds = DEFAULT_FIXED_DELTA_TIME_IN_SECONDS;
+	}
+}
+
+void Comp2D::Settings::TimeSettings::setFrameBudgetInSeconds( float frameBudgetInSeconds )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeSettings setFrameBudgetInSeconds: frameBudgetInSeconds = %f\n", frameBudgetInSeconds );
+	#endif
+
+	if( frameBudgetInSeconds > 0.0f )
+	{
+		m_frameBudgetInSeconds = frameBudgetInSeconds;
+	}
+	else
+	{
+		m_frameBudgetInSeconds = DEFAULT_FRAME_BUDGET_IN_SECONDS;
+	}
+}
+
+void Comp2D::Settings::TimeSettings::setHeadlessSimulationSpeed( float headlessSimulationSpeed )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeSettings setHeadlessSimulationSpeed: headlessSimulationSpeed = %f\n", headlessSimulationSpeed );
+	#endif
+
+	if( headlessSimulationSpeed >= 0.0f )
+	{
+		m_headlessSimulationSpeed = headlessSimulationSpeed;
+	}
+	else
+	{
+		m_headlessSimulationSpeed = DEFAULT_HEADLESS_SIMULATION_SPEED;
+	}
+}
+
+void Comp2D::Settings::TimeSettings::setMaximumFixedUpdatesPerFrame( Uint32 maximumFixedUpdatesPerFrame )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeSettings setMaximumFixedUpdatesPerFrame: maximumFixedUpdatesPerFrame = %u\n", maximumFixedUpdatesPerFrame );
+	#endif
+
+	if( maximumFixedUpdatesPerFrame > 0 )
+	{
+		m_maximumFixedUpdatesPerFrame = maximumFixedUpdatesPerFrame;
+	}
+	else
+	{
+		m_maximumFixedUpdatesPerFrame = DEFAULT_MAXIMUM_FIXED_UPDATES_PER_FRAME;
+	}
+}
+
+void Comp2D::Settings::TimeSettings::setMaximumPostedProceduresPerFrame( Uint32 maximumPostedProceduresPerFrame )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeSettings setMaximumPostedProceduresPerFrame: maximumPostedProceduresPerFrame = %u\n", maximumPostedProceduresPerFrame );
+	#endif
+
+	if( maximumPostedProceduresPerFrame > 0 )
+	{
+		m_maximumPostedProceduresPerFrame = maximumPostedProceduresPerFrame;
+	}
+	else
+	{
+		m_maximumPostedProceduresPerFrame = DEFAULT_MAXIMUM_POSTED_PROCEDURES_PER_FRAME;
+	}
+}
+
+void Comp2D::Settings::TimeSettings::setThrottleWhenUnfocused( bool throttleWhenUnfocused )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeSettings setThrottleWhenUnfocused: throttleWhenUnfocused = %i\n", throttleWhenUnfocused );
+	#endif
+
+	m_throttleWhenUnfocused = throttleWhenUnfocused;
+}
+
+void Comp2D::Settings::TimeSettings::setThrottledTicksPerSecond( float throttledTicksPerSecond )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeSettings setThrottledTicksPerSecond: throttledTicksPerSecond = %f\n", throttledTicksPerSecond );
+	#endif
+
+	if( throttledTicksPerSecond > 0.0f )
+	{
+		m_throttledTicksPerSecond = throttledTicksPerSecond;
+	}
+	else
+	{
+		m_throttledTicksPerSecond = DEFAULT_THROTTLED_TICKS_PER_SECOND;
+	}
+}
+
+bool Comp2D::Settings::TimeSettings::isThrottleWhenUnfocusedEnabled() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeSettings isThrottleWhenUnfocusedEnabled\n" );
+	#endif
+
+	return m_throttleWhenUnfocused;
+}
+
+Uint32 Comp2D::Settings::TimeSettings::getMaximumFixedUpdatesPerFrame() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeSettings getMaximumFixedUpdatesPerFrame\n" );
+	#endif
+
+	return m_maximumFixedUpdatesPerFrame;
+}
+
+Uint32 Comp2D::Settings::TimeSettings::getMaximumPostedProceduresPerFrame() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeSettings getMaximumPostedProceduresPerFrame\n" );
+	#endif
+
+	return m_maximumPostedProceduresPerFrame;
+}
+
+float Comp2D::Settings::TimeSettings::getDeltaTimeSmoothingFactor() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeSettings getDeltaTimeSmoothingFactor\n" );
+	#endif
+
+	return m_deltaTimeSmoothingFactor;
+}
+
+float Comp2D::Settings::TimeSettings::getFixedDeltaTimeInSeconds() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeSettings getFixedDeltaTimeInSeconds\n" );
+	#endif
+
+	return m_fixedDeltaTimeInSeconds;
+}
+
+float Comp2D::Settings::TimeSettings::getFrameBudgetInSeconds() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeSettings getFrameBudgetInSeconds\n" );
+	#endif
+
+	return m_frameBudgetInSeconds;
+}
+
+float Comp2D::Settings::TimeSettings::getHeadlessSimulationSpeed() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeSettings getHeadlessSimulationSpeed\n" );
+	#endif
+
+	return m_headlessSimulationSpeed;
+}
+
+float Comp2D::Settings::TimeSettings::getThrottledTicksPerSecond() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeSettings getThrottledTicksPerSecond\n" );
+	#endif
+
+	return m_throttledTicksPerSecond;
+}
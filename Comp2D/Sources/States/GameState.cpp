@@ -26,6 +26,7 @@
 
 #include "Comp2D/Headers/States/GameState.h"
 
+#include <algorithm>
 #include <functional>
 #include <iterator>
 #include <list>
@@ -33,35 +34,42 @@
 #include <string>
 #include <typeindex>
 #include <typeinfo>
+#include <unordered_map>
 #include <vector>
 
 #include <SDL.h>
 #include <SDL_thread.h>
 
 #include "Comp2D/Headers/Game.h"
+#include "Comp2D/Headers/GameContext.h"
 #include "Comp2D/Headers/Animations/Animation.h"
 #include "Comp2D/Headers/Components/AnimationsControllerComponent.h"
 #include "Comp2D/Headers/Components/Component.h"
+#include "Comp2D/Headers/Components/ComponentType.h"
 #include "Comp2D/Headers/Components/GameObjectBehavior.h"
+#include "Comp2D/Headers/Components/PhysicsTransformComponent.h"
 #include "Comp2D/Headers/Components/Renderable.h"
 #include "Comp2D/Headers/Components/ResourceComponent.h"
 #include "Comp2D/Headers/Components/TimelinesControllerComponent.h"
 #include "Comp2D/Headers/Components/TransformComponent.h"
+#include "Comp2D/Headers/Components/TransformComponentsStorage.h"
+#include "Comp2D/Headers/Jobs/JobSystem.h"
+#include "Comp2D/Headers/Jobs/SeparateThreadFunctionCall.h"
+#include "Comp2D/Headers/Jobs/TimerFunctionCall.h"
+#include "Comp2D/Headers/Memory/MemoryArena.h"
+#include "Comp2D/Headers/Memory/MemoryArenaScope.h"
 #include "Comp2D/Headers/Objects/Dependency.h"
 #include "Comp2D/Headers/Objects/GameObject.h"
+#include "Comp2D/Headers/Profiling/ProfilerZone.h"
+#include "Comp2D/Headers/Rendering/RenderPipeline.h"
+#include "Comp2D/Headers/States/EventSubscribers.h"
+#include "Comp2D/Headers/States/GameStateCommand.h"
 #include "Comp2D/Headers/States/GameStateBehavior.h"
-#include "Comp2D/Headers/Time/TimedProcedure.h"
+#include "Comp2D/Headers/Time/TimeConversions.h"
+#include "Comp2D/Headers/Time/TimedProcedureHandle.h"
+#include "Comp2D/Headers/Time/TimedProceduresScheduler.h"
 #include "Comp2D/Headers/Time/TimeManager.h"
 
-unsigned int Comp2D::States::GameState::currentGameStateTimedProcedureID = 0;
-
-std::list<SDL_TimerID> Comp2D::States::GameState::currentGameStateTimerFunctionsIDs;
-
-std::list<SDL_Thread*> Comp2D::States::GameState::currentGameStateSeparateThreadFunctions;
-
-std::list<Comp2D::Time::TimedProcedure*> Comp2D::States::GameState::currentGameStateTimedProcedures;
-std::list<Comp2D::Time::TimedProcedure*> Comp2D::States::GameState::currentGameStatePausableTimedProcedures;
-
 Comp2D::States::GameState::GameState( Uint32 stateID )
 	:
 	m_id{ stateID }
@@ -92,60 +100,121 @@ void Comp2D::States::GameState::checkGameStateTimedProcedures()
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState checkTimedProcedures\n" );
 	#endif
 
-	Uint32 currentTime = Comp2D::Game::timeManager->getTimeSinceSDLInitializationInMilliseconds();
+	Comp2D::GameContext::getCurrent()->gameStates[Comp2D::Game::getCurrentStateID()]->m_timedProceduresScheduler.update( Comp2D::Game::getTimeManager()->getTimeSinceSDLInitializationInNanoseconds() );
+}
 
-	for
-	(
-		std::list<Comp2D::Time::TimedProcedure*>::iterator gameStateTimedProcedureIt = currentGameStateTimedProcedures.begin();
-		gameStateTimedProcedureIt != currentGameStateTimedProcedures.end();
-		++gameStateTimedProcedureIt
-	)
-	{
-		Comp2D::Time::TimedProcedure* currentGameStateTimedProcedure = (*gameStateTimedProcedureIt);
+void Comp2D::States::GameState::pauseGameStateTimedProcedures()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState pauseGameStateTimedProcedures\n" );
+	#endif
 
-		if( currentGameStateTimedProcedure->checkCallbackTime( currentTime ) )
-		{
-			currentGameStatePausableTimedProcedures.remove( currentGameStateTimedProcedure );
-			currentGameStateTimedProcedures.remove( currentGameStateTimedProcedure );
-			delete currentGameStateTimedProcedure;
+	Comp2D::GameContext::getCurrent()->gameStates[Comp2D::Game::getCurrentStateID()]->m_timedProceduresScheduler.pause( Comp2D::Game::getTimeManager()->getTimeSinceSDLInitializationInNanoseconds() );
+}
 
-			--gameStateTimedProcedureIt;
-		}
+void Comp2D::States::GameState::unpauseGameStateTimedProcedures()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState unpauseGameStateTimedProcedures\n" );
+	#endif
+
+	Comp2D::GameContext::getCurrent()->gameStates[Comp2D::Game::getCurrentStateID()]->m_timedProceduresScheduler.unpause( Comp2D::Game::getTimeManager()->getTimeSinceSDLInitializationInNanoseconds() );
+}
+
+Comp2D::States::GameState* Comp2D::States::GameState::getSchedulingGameState()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState getSchedulingGameState\n" );
+	#endif
+
+	Comp2D::GameContext* gameContext = Comp2D::GameContext::getCurrent();
+
+	if( gameContext->settingUpGameState != nullptr )
+	{
+		return gameContext->settingUpGameState;
 	}
+
+	return gameContext->gameStates[gameContext->currentStateID];
 }
 
-void Comp2D::States::GameState::pauseGameStateTimedProcedures()
+bool Comp2D::States::GameState::canCoalesceMotionEvents( const SDL_Event& pendingMotionEvent, const SDL_Event& motionEvent )
 {
 	#ifdef DEBUG
-		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState pauseGameStateTimedProcedures\n" );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState canCoalesceMotionEvents\n" );
 	#endif
 
-	for
-	(
-		std::list<Comp2D::Time::TimedProcedure*>::iterator gameStatePausableTimedProcedureIt = currentGameStatePausableTimedProcedures.begin();
-		gameStatePausableTimedProcedureIt != currentGameStatePausableTimedProcedures.end();
-		++gameStatePausableTimedProcedureIt
-	)
+	if( pendingMotionEvent.type != motionEvent.type )
 	{
-		(*gameStatePausableTimedProcedureIt)->pause();
+		return false;
+	}
+
+	switch( motionEvent.type )
+	{
+		case SDL_MOUSEMOTION:
+			return
+				pendingMotionEvent.motion.windowID == motionEvent.motion.windowID &&
+				pendingMotionEvent.motion.which == motionEvent.motion.which;
+
+		case SDL_FINGERMOTION:
+			return
+				pendingMotionEvent.tfinger.touchId == motionEvent.tfinger.touchId &&
+				pendingMotionEvent.tfinger.fingerId == motionEvent.tfinger.fingerId;
+
+		case SDL_JOYAXISMOTION:
+			return
+				pendingMotionEvent.jaxis.which == motionEvent.jaxis.which &&
+				pendingMotionEvent.jaxis.axis == motionEvent.jaxis.axis;
+
+		case SDL_CONTROLLERAXISMOTION:
+			return
+				pendingMotionEvent.caxis.which == motionEvent.caxis.which &&
+				pendingMotionEvent.caxis.axis == motionEvent.caxis.axis;
+
+		default:
+			return false;
 	}
 }
 
-void Comp2D::States::GameState::unpauseGameStateTimedProcedures()
+bool Comp2D::States::GameState::isMotionEvent( const SDL_Event& e )
 {
 	#ifdef DEBUG
-		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState unpauseGameStateTimedProcedures\n" );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState isMotionEvent: event of type %u\n", e.type );
 	#endif
 
-	for
+	return
+		e.type == SDL_MOUSEMOTION ||
+		e.type == SDL_FINGERMOTION ||
+		e.type == SDL_JOYAXISMOTION ||
+		e.type == SDL_CONTROLLERAXISMOTION;
+}
+
+bool Comp2D::States::GameState::isRenderedBefore( const Comp2D::Components::Renderable* renderableA, const Comp2D::Components::Renderable* renderableB )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState isRenderedBefore\n" );
+	#endif
+
+	if
 	(
-		std::list<Comp2D::Time::TimedProcedure*>::iterator gameStatePausableTimedProcedureIt = currentGameStatePausableTimedProcedures.begin();
-		gameStatePausableTimedProcedureIt != currentGameStatePausableTimedProcedures.end();
-		++gameStatePausableTimedProcedureIt
+		static_cast<int>( renderableA->renderLayer ) < static_cast<int>( renderableB->renderLayer ) ||
+		(
+			renderableA->renderLayer == renderableB->renderLayer &&
+			renderableA->orderInRenderLayer < renderableB->orderInRenderLayer
+		)
 	)
 	{
-		(*gameStatePausableTimedProcedureIt)->unpause();
+		return true;
 	}
+	return false;
+}
+
+Uint64 Comp2D::States::GameState::getEventSubscribersKey( Uint32 eventType, SDL_Keycode key )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState getEventSubscribersKey: eventType = %u; key = %i\n", eventType, key );
+	#endif
+
+	return ( static_cast<Uint64>( eventType ) << 32 ) | static_cast<Uint32>( key );
 }
 
 void Comp2D::States::GameState::beforeSetup()
@@ -172,6 +241,13 @@ void Comp2D::States::GameState::finalize()
 	deleteGameObjects();
 }
 
+void Comp2D::States::GameState::fixedUpdate()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u fixedUpdate\n", m_id );
+	#endif
+}
+
 void Comp2D::States::GameState::onEvent( SDL_Event e )
 {
 	#ifdef DEBUG
@@ -183,105 +259,328 @@ void Comp2D::States::GameState::onEvent( SDL_Event e )
 		Comp2D::Game::quitGame();
 	}
 
-	Comp2D::States::GameStateBehavior* currentGameStateBehavior = nullptr;
+	if( isMotionEvent( e ) )
+	{
+		pendMotionEvent( e );
+		return;
+	}
+
+	dispatchPendingMotionEvent();
+	dispatchEvent( e );
+}
+
+void Comp2D::States::GameState::render()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u render\n", m_stateID );
+	#endif
+
+	COMP2D_PROFILE_ZONE( "GameState::render" );
 
-	// gameStateBehaviorsOnEvent( e )
 	for
 	(
-		std::list<Comp2D::States::GameStateBehavior*>::iterator behaviorIt = m_gameStateBehaviors.begin();
-		behaviorIt != m_gameStateBehaviors.end();
-		++behaviorIt
+		std::list<Comp2D::Components::Renderable*>::iterator renderableComponentIt = m_renderableComponents.begin();
+		renderableComponentIt != m_renderableComponents.end();
+		++renderableComponentIt
 	)
 	{
-		currentGameStateBehavior = (*behaviorIt);
+		Comp2D::Components::Renderable* currentRenderable = *renderableComponentIt;
+		Comp2D::Components::Component* currentComponent = currentRenderable->component;
 
-		if( currentGameStateBehavior->isEnabled() )
+		if
+		(
+			//currentComponent != nullptr &&
+			currentComponent->isActiveInHierarchy() &&
+			currentComponent->isEnabled()
+		)
 		{
-			currentGameStateBehavior->onEvent( e );
+			Comp2D::Game::renderPipeline->setCurrentRenderLayer( static_cast<int>( currentRenderable->renderLayer ) );
+
+			currentRenderable->render();
 		}
 	}
+}
+
+void Comp2D::States::GameState::update()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u update\n", m_stateID );
+	#endif
+
+	COMP2D_PROFILE_ZONE( "GameState::update" );
+
+	dispatchPendingMotionEvent();
+
+	Uint64 currentTimeSinceSDLInitializationInNanoseconds = Comp2D::Game::getTimeManager()->getTimeSinceSDLInitializationInNanoseconds();
+
+	updateGameStateBehaviors();
+
+	applyGameObjectsActivityChanges();
+
+	updateGameObjectsAnimationsControllerComponent( currentTimeSinceSDLInitializationInNanoseconds );
+
+	updateGameObjectsTimelinesControllerComponent( currentTimeSinceSDLInitializationInNanoseconds );
+
+	// After the animations and timelines, so what they moved is seen by the
+	// behaviors on the same frame
+	updateGameObjectsTransformComponent();
+
+	updateGameObjectsBehaviors();
+
+	// Before the render, so it already sees the changes of the frame
+	applyGameStateCommands();
+}
+
+void Comp2D::States::GameState::applyGameObjectsActivityChanges()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u applyGameObjectsActivityChanges\n", m_id );
+	#endif
+
+	auto creationOrderLess =
+	[]( const Comp2D::Objects::GameObject* a, const Comp2D::Objects::GameObject* b )
+	{
+		return a->m_creationOrder < b->m_creationOrder;
+	};
+
+	auto patch =
+	[ &creationOrderLess ]( std::vector<Comp2D::Objects::GameObject*>& gameObjects, Comp2D::Objects::GameObject* gameObject, bool& inGameObjects, bool shouldBeIn )
+	{
+		if( inGameObjects == shouldBeIn )
+		{
+			return false;
+		}
+
+		std::vector<Comp2D::Objects::GameObject*>::iterator position = std::lower_bound( gameObjects.begin(), gameObjects.end(), gameObject, creationOrderLess );
+
+		if( shouldBeIn )
+		{
+			gameObjects.insert( position, gameObject );
+		}
+		else
+		{
+			gameObjects.erase( position );
+		}
+
+		inGameObjects = shouldBeIn;
+
+		return true;
+	};
 
-	// gameObjectsOnEvent( e )
 	Comp2D::Objects::GameObject* currentGameObject = nullptr;
 
+	bool shouldBeActive = false;
+
+	if( !m_activityChangedGameObjects.empty() )
+	{
+		m_transformsHierarchyChanged = true;
+	}
+
 	for
 	(
-		std::list<Comp2D::Objects::GameObject*>::iterator gameObjectIt = m_gameObjects.begin();
-		gameObjectIt != m_gameObjects.end();
+		std::vector<Comp2D::Objects::GameObject*>::iterator gameObjectIt = m_activityChangedGameObjects.begin();
+		gameObjectIt != m_activityChangedGameObjects.end();
 		++gameObjectIt
 	)
 	{
 		currentGameObject = (*gameObjectIt);
+		currentGameObject->m_activityChangePending = false;
 
-		if( currentGameObject->isActive() && currentGameObject->isActiveInHierarchy() )
+		// Reactivated or reparented, its children follow it
+		if( currentGameObject->transform != nullptr )
 		{
-			// gameObjectOnEvent( currentGameObject, e );
-			Comp2D::Components::GameObjectBehavior* currentGameObjectBehavior = nullptr;
+			currentGameObject->transform->markDirty();
+		}
 
-			for
-			(
-				//std::list<Comp2D::Components::Component*>::iterator it = currentGameObject->activeInHierarchyComponents.begin();
-				//it != currentGameObject->activeInHierarchyComponents.end();
-				std::vector<Comp2D::Components::Component*>::iterator it = currentGameObject->components.begin();
-				it != currentGameObject->components.end();
-				++it
-			)
-			{
-				currentGameObjectBehavior = dynamic_cast<Comp2D::Components::GameObjectBehavior*>( *it );
+		shouldBeActive = currentGameObject->isActive() && currentGameObject->isActiveInHierarchy();
 
-				if
-				(
-					currentGameObjectBehavior != nullptr &&
-					currentGameObjectBehavior->isEnabled() &&
-					currentGameObjectBehavior->isActiveInHierarchy()
-				)
-				{
-					currentGameObjectBehavior->onEvent( e );
-				}
+		if( patch( m_activeGameObjects, currentGameObject, currentGameObject->m_inActiveGameObjects, shouldBeActive ) )
+		{
+			if( !shouldBeActive )
+			{
+				currentGameObject->m_updatableBehaviorsCount = 0;
 			}
+
+			m_updatableBehaviorsChanged = true;
 		}
+
+		patch
+		(
+			m_activeRootGameObjects,
+			currentGameObject,
+			currentGameObject->m_inActiveRootGameObjects,
+			shouldBeActive && currentGameObject->parentGameObject == nullptr
+		);
+	}
+
+	m_activityChangedGameObjects.clear();
+
+	if( m_updatableBehaviorsChanged )
+	{
+		updateUpdatableBehaviors();
 	}
 }
 
-void Comp2D::States::GameState::render()
+void Comp2D::States::GameState::applyGameStateCommands()
 {
 	#ifdef DEBUG
-		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u render\n", m_stateID );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u applyGameStateCommands\n", m_id );
 	#endif
 
+	SDL_AtomicLock( &m_gameStateCommandsLock );
+	m_appliedGameStateCommands.swap( m_gameStateCommands );
+	SDL_AtomicUnlock( &m_gameStateCommandsLock );
+
+	if( m_appliedGameStateCommands.empty() )
+	{
+		return;
+	}
+
+	COMP2D_PROFILE_ZONE( "GameState::applyGameStateCommands" );
+
+	size_t createdGameObjectsCount = 0;
+
 	for
 	(
-		std::list<Comp2D::Components::Renderable*>::iterator renderableComponentIt = m_renderableComponents.begin();
-		renderableComponentIt != m_renderableComponents.end();
-		++renderableComponentIt
+		std::vector<Comp2D::States::GameStateCommand>::iterator gameStateCommandIt = m_appliedGameStateCommands.begin();
+		gameStateCommandIt != m_appliedGameStateCommands.end();
+		++gameStateCommandIt
 	)
 	{
-		Comp2D::Components::Renderable* currentRenderable = *renderableComponentIt;
-		Comp2D::Components::Component* currentComponent = dynamic_cast<Comp2D::Components::Component*>( currentRenderable );
+		if( gameStateCommandIt->type == Comp2D::States::EGameStateCommandType::CreateGameObject )
+		{
+			++createdGameObjectsCount;
+		}
+	}
 
-		if
-		(
-			//currentComponent != nullptr &&
-			currentComponent->isActiveInHierarchy() &&
-			currentComponent->isEnabled()
-		)
+	// Grown once for the whole batch
+	if( createdGameObjectsCount > 0 )
+	{
+		m_activeGameObjects.reserve( m_activeGameObjects.size() + createdGameObjectsCount );
+		m_gameObjectsByID.reserve( m_gameObjectsByID.size() + createdGameObjectsCount );
+		m_gameObjectsByName.reserve( m_gameObjectsByName.size() + createdGameObjectsCount );
+	}
+
+	Comp2D::Objects::GameObject* currentGameObject = nullptr;
+
+	for
+	(
+		std::vector<Comp2D::States::GameStateCommand>::iterator gameStateCommandIt = m_appliedGameStateCommands.begin();
+		gameStateCommandIt != m_appliedGameStateCommands.end();
+		++gameStateCommandIt
+	)
+	{
+		currentGameObject = gameStateCommandIt->component != nullptr ? gameStateCommandIt->component->gameObject : gameStateCommandIt->gameObject;
+
+		// Destroyed by an earlier command of the batch
+		if( currentGameObject->m_destroyPending )
 		{
-			currentRenderable->render();
+			continue;
 		}
+
+		switch( gameStateCommandIt->type )
+		{
+			case Comp2D::States::EGameStateCommandType::CreateGameObject:
+				createGameObject( currentGameObject );
+
+				if( gameStateCommandIt->parentGameObject != nullptr && !gameStateCommandIt->parentGameObject->m_destroyPending )
+				{
+					gameStateCommandIt->parentGameObject->addChildGameObject
+					(
+						currentGameObject,
+						currentGameObject->isActive(),
+						gameStateCommandIt->parentGameObject->isActiveInHierarchy()
+					);
+				}
+
+				m_commandCreatedGameObjects.push_back( currentGameObject );
+				break;
+
+			case Comp2D::States::EGameStateCommandType::DestroyGameObject:
+				if( currentGameObject->parentGameObject != nullptr )
+				{
+					currentGameObject->parentGameObject->removeChildGameObject( currentGameObject, false );
+				}
+
+				collectDestroyedGameObject( currentGameObject );
+				break;
+
+			case Comp2D::States::EGameStateCommandType::ReparentGameObject:
+				reparentGameObject( currentGameObject, gameStateCommandIt->parentGameObject );
+				break;
+
+			case Comp2D::States::EGameStateCommandType::SetComponentEnabled:
+				currentGameObject->setComponentEnabled( gameStateCommandIt->component, gameStateCommandIt->value );
+				break;
+
+			case Comp2D::States::EGameStateCommandType::SetGameObjectActive:
+				if( currentGameObject->parentGameObject != nullptr )
+				{
+					currentGameObject->parentGameObject->setChildGameObjectActive( currentGameObject, gameStateCommandIt->value );
+				}
+				else
+				{
+					currentGameObject->setActive( gameStateCommandIt->value );
+				}
+				break;
+		}
+	}
+
+	m_appliedGameStateCommands.clear();
+
+	if( !m_commandDestroyedGameObjects.empty() )
+	{
+		deleteDestroyedGameObjects();
+	}
+
+	if( !m_commandCreatedGameObjects.empty() )
+	{
+		if( m_componentsInitialized )
+		{
+			initializeCreatedGameObjects();
+		}
+
+		m_commandCreatedGameObjects.clear();
 	}
 }
 
-void Comp2D::States::GameState::update()
+void Comp2D::States::GameState::collectResourcesNamesFromAnimationsControllerComponent( Comp2D::Components::AnimationsControllerComponent* animationsControllerComponent )
 {
 	#ifdef DEBUG
-		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u update\n", m_stateID );
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u collectResourcesNamesFromAnimationsControllerComponent: animationsControllerComponent with ID %u\n", m_id, animationsControllerComponent->getID() );
 	#endif
 
-	Uint32 currentTimeSinceSDLInitializationInMilliseconds = Comp2D::Game::timeManager->getTimeSinceSDLInitializationInMilliseconds();
+	std::string animationsControllerComponentACResourceName = animationsControllerComponent->getAnimationsControllerResource()->getName();
 
-	updateGameStateBehaviors();
+	m_resourceComponentsResourcesNames.emplace( animationsControllerComponentACResourceName );
+
+	// Collected again once the controller is loaded, it is not loaded here
+	// so the preload can run it on the job workers
+	if( !animationsControllerComponent->getAnimationsControllerResource()->isLoaded() )
+	{
+		return;
+	}
+
+	const std::vector<std::string> animationsControllerComponentAnimationsResourcesNames
+		= animationsControllerComponent->getAnimationsController()->getAnimationsResourcesNames();
+
+	for
+	(
+		std::vector<std::string>::const_iterator animationResourceNameConstIt = animationsControllerComponentAnimationsResourcesNames.cbegin();
+		animationResourceNameConstIt != animationsControllerComponentAnimationsResourcesNames.cend();
+		++animationResourceNameConstIt
+	)
+	{
+		m_resourceComponentsResourcesNames.emplace( *animationResourceNameConstIt );
+	}
+}
+
+void Comp2D::States::GameState::collectResourcesNamesFromResourceComponents()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u collectResourcesNamesFromResourceComponents\n", m_id );
+	#endif
 
-	// updateGameObjects()
 	Comp2D::Objects::GameObject* currentGameObject = nullptr;
 
 	for
@@ -293,19 +592,113 @@ void Comp2D::States::GameState::update()
 	{
 		currentGameObject = (*gameObjectIt);
 
-		if( currentGameObject->isActive() && currentGameObject->isActiveInHierarchy() )
+		for
+		(
+			std::vector<Comp2D::Components::ResourceComponent*>::iterator resourceComponentIt = currentGameObject->resourceComponents.begin();
+			resourceComponentIt != currentGameObject->resourceComponents.end();
+			++resourceComponentIt
+		)
 		{
-			// updateGameObject( currentGameObject, currentTimeSinceSDLInitializationInMilliseconds )
-			updateGameObjectAnimationsControllerComponent( currentGameObject, currentTimeSinceSDLInitializationInMilliseconds );
+			m_resourceComponentsResourcesNames.emplace( (*resourceComponentIt)->getResource()->getName() );
+		}
 
-			updateGameObjectTimelinesControllerComponent( currentGameObject, currentTimeSinceSDLInitializationInMilliseconds );
+		for
+		(
+			std::vector<Comp2D::Components::AnimationsControllerComponent*>::iterator animationsControllerComponentIt = currentGameObject->animationsControllerComponents.begin();
+			animationsControllerComponentIt != currentGameObject->animationsControllerComponents.end();
+			++animationsControllerComponentIt
+		)
+		{
+			collectResourcesNamesFromAnimationsControllerComponent( *animationsControllerComponentIt );
+		}
 
-			if( currentGameObject->parentGameObject == nullptr )
-			{
-				updateGameObjectTransformComponent( currentGameObject );
-			}
+		for
+		(
+			std::vector<Comp2D::Components::TimelinesControllerComponent*>::iterator timelinesControllerComponentIt = currentGameObject->timelinesControllerComponents.begin();
+			timelinesControllerComponentIt != currentGameObject->timelinesControllerComponents.end();
+			++timelinesControllerComponentIt
+		)
+		{
+			collectResourcesNamesFromTimelinesControllerComponent( *timelinesControllerComponentIt );
+		}
+	}
+}
 
-			updateGameObjectBehaviors( currentGameObject );
+void Comp2D::States::GameState::collectResourcesNamesFromTimelinesControllerComponent( Comp2D::Components::TimelinesControllerComponent* timelinesControllerComponent )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u collectResourcesNamesFromTimelinesControllerComponent: timelinesControllerComponent with ID %u\n", m_id, timelinesControllerComponent->getID() );
+	#endif
+
+	std::string timelinesControllerComponentTCResourceName = timelinesControllerComponent->getTimelinesControllerResource()->getName();
+
+	m_resourceComponentsResourcesNames.emplace( timelinesControllerComponentTCResourceName );
+
+	// Collected again once the controller is loaded, it is not loaded here
+	// so the preload can run it on the job workers
+	if( !timelinesControllerComponent->getTimelinesControllerResource()->isLoaded() )
+	{
+		return;
+	}
+
+	const std::vector<std::string> timelinesControllerComponentTimelinesResourcesNames
+		= timelinesControllerComponent->getTimelinesController()->getTimelinesResourcesNames();
+
+	for
+	(
+		std::vector<std::string>::const_iterator timelineResourceNameConstIt = timelinesControllerComponentTimelinesResourcesNames.cbegin();
+		timelineResourceNameConstIt != timelinesControllerComponentTimelinesResourcesNames.cend();
+		++timelineResourceNameConstIt
+	)
+	{
+		m_resourceComponentsResourcesNames.emplace( *timelineResourceNameConstIt );
+	}
+}
+
+void Comp2D::States::GameState::collectDestroyedGameObject( Comp2D::Objects::GameObject* gameObject )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u collectDestroyedGameObject: gameObject with ID %u\n", m_id, gameObject->getID() );
+	#endif
+
+	gameObject->m_destroyPending = true;
+	m_commandDestroyedGameObjects.push_back( gameObject );
+
+	// Clears their updatable entries and event subscriptions
+	for
+	(
+		std::vector<Comp2D::Components::GameObjectBehavior*>::iterator behaviorIt = gameObject->behaviors.begin();
+		behaviorIt != gameObject->behaviors.end();
+		++behaviorIt
+	)
+	{
+		onGameObjectBehaviorRemoved( *behaviorIt );
+	}
+
+	std::unordered_map<unsigned int, Comp2D::Objects::GameObject*>::iterator gameObjectByIDIt = m_gameObjectsByID.find( gameObject->getID() );
+
+	if( gameObjectByIDIt != m_gameObjectsByID.end() && gameObjectByIDIt->second == gameObject )
+	{
+		m_gameObjectsByID.erase( gameObjectByIDIt );
+	}
+
+	std::unordered_map<std::string, Comp2D::Objects::GameObject*>::iterator gameObjectByNameIt = m_gameObjectsByName.find( gameObject->getName() );
+
+	if( gameObjectByNameIt != m_gameObjectsByName.end() && gameObjectByNameIt->second == gameObject )
+	{
+		m_gameObjectsByName.erase( gameObjectByNameIt );
+	}
+
+	for
+	(
+		std::vector<Comp2D::Objects::GameObject*>::iterator childGameObjectIt = gameObject->childGameObjects.begin();
+		childGameObjectIt != gameObject->childGameObjects.end();
+		++childGameObjectIt
+	)
+	{
+		if( !(*childGameObjectIt)->m_destroyPending )
+		{
+			collectDestroyedGameObject( *childGameObjectIt );
 		}
 	}
 }
@@ -355,6 +748,110 @@ void Comp2D::States::GameState::deleteComponents()
 	m_componentID = 0;
 }
 
+void Comp2D::States::GameState::deleteDestroyedGameObjects()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u deleteDestroyedGameObjects\n", m_id );
+	#endif
+
+	// Each array is compacted in a single pass for the whole batch
+	auto isDestroyed =
+	[]( const Comp2D::Objects::GameObject* gameObject )
+	{
+		return gameObject->m_destroyPending;
+	};
+
+	m_gameObjects.remove_if( isDestroyed );
+	m_activeGameObjects.erase( std::remove_if( m_activeGameObjects.begin(), m_activeGameObjects.end(), isDestroyed ), m_activeGameObjects.end() );
+	m_activeRootGameObjects.erase( std::remove_if( m_activeRootGameObjects.begin(), m_activeRootGameObjects.end(), isDestroyed ), m_activeRootGameObjects.end() );
+	m_activityChangedGameObjects.erase( std::remove_if( m_activityChangedGameObjects.begin(), m_activityChangedGameObjects.end(), isDestroyed ), m_activityChangedGameObjects.end() );
+
+	m_renderableComponents.remove_if
+	(
+		[]( Comp2D::Components::Renderable* renderable )
+		{
+			return renderable->component->gameObject->m_destroyPending;
+		}
+	);
+
+	m_transformsHierarchyChanged = true;
+	m_updatableBehaviorsChanged = true;
+
+	Comp2D::Objects::GameObject* currentGameObject = nullptr;
+
+	// The bodies go first, while every GameObject of the batch is still
+	// whole, as their touching contacts end with the surviving ones
+	for
+	(
+		std::vector<Comp2D::Objects::GameObject*>::reverse_iterator gameObjectReverseIt = m_commandDestroyedGameObjects.rbegin();
+		gameObjectReverseIt != m_commandDestroyedGameObjects.rend();
+		++gameObjectReverseIt
+	)
+	{
+		currentGameObject = (*gameObjectReverseIt);
+
+		if
+		(
+			currentGameObject->transform != nullptr &&
+			currentGameObject->transform->hasRole( Comp2D::Components::EComponentRole::PhysicsTransform )
+		)
+		{
+			static_cast<Comp2D::Components::PhysicsTransformComponent*>( currentGameObject->transform )->destroyBody();
+		}
+	}
+
+	// Children were collected after their parents, so they go first
+	for
+	(
+		std::vector<Comp2D::Objects::GameObject*>::reverse_iterator gameObjectReverseIt = m_commandDestroyedGameObjects.rbegin();
+		gameObjectReverseIt != m_commandDestroyedGameObjects.rend();
+		++gameObjectReverseIt
+	)
+	{
+		currentGameObject = (*gameObjectReverseIt);
+
+		if( m_componentsInitialized )
+		{
+			for
+			(
+				std::vector<Comp2D::Components::Component*>::reverse_iterator componentReverseIt = currentGameObject->components.rbegin();
+				componentReverseIt != currentGameObject->components.rend();
+				++componentReverseIt
+			)
+			{
+				(*componentReverseIt)->onFinalizeState();
+			}
+
+			if( currentGameObject->transform )
+			{
+				currentGameObject->transform->onFinalizeState();
+			}
+		}
+
+		for
+		(
+			std::vector<Comp2D::Components::Component*>::reverse_iterator componentReverseIt = currentGameObject->components.rbegin();
+			componentReverseIt != currentGameObject->components.rend();
+			++componentReverseIt
+		)
+		{
+			(*componentReverseIt)->onDelete();
+			delete (*componentReverseIt);
+		}
+
+		if( currentGameObject->transform )
+		{
+			currentGameObject->transform->onDelete();
+			delete currentGameObject->transform;
+			currentGameObject->transform = nullptr;
+		}
+
+		delete currentGameObject;
+	}
+
+	m_commandDestroyedGameObjects.clear();
+}
+
 void Comp2D::States::GameState::deleteGameObjects()
 {
 	#ifdef DEBUG
@@ -376,8 +873,40 @@ void Comp2D::States::GameState::deleteGameObjects()
 	}
 
 	m_gameObjects.clear();
-
+	m_activeGameObjects.clear();
+	m_activeRootGameObjects.clear();
+	m_activityChangedGameObjects.clear();
+	m_parallelUpdatableBehaviors.clear();
+	m_updatableBehaviors.clear();
+	m_hierarchyTransforms.clear();
+	m_hierarchyTransformsParentPositions.clear();
+	m_hierarchyTransformsRefreshed.clear();
+	m_hierarchyTransformsRootsBegins.clear();
+	m_parallelHierarchyTransformsRoots.clear();
+	m_serialHierarchyTransformsRoots.clear();
+	m_gameObjectsByID.clear();
+	m_gameObjectsByName.clear();
+	m_appliedGameStateCommands.clear();
+	m_gameStateCommands.clear();
+	m_commandCreatedGameObjects.clear();
+	m_commandDestroyedGameObjects.clear();
+
+	m_createdGameObjectsCount = 0;
 	m_gameObjectID = 0;
+	m_transformsHierarchyChanged = false;
+	m_updatableBehaviorsChanged = false;
+
+	#ifdef DEBUG
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"GameState with ID %u deleteGameObjects: releasing %u bytes of the memory arena\n",
+			m_id,
+			static_cast<unsigned int>( m_memoryArena.getUsedSize() )
+		);
+	#endif
+
+	m_memoryArena.reset();
 }
 
 void Comp2D::States::GameState::deleteGameStateBehaviors()
@@ -402,9 +931,144 @@ void Comp2D::States::GameState::deleteGameStateBehaviors()
 		currentGameStateBehavior = nullptr;
 	}
 
-	m_gameStateBehaviors.clear();
+	m_gameStateBehaviors.clear();
+	m_eventSubscribers.clear();
+
+	m_gameStateBehaviorID = 0;
+	m_motionEventPending = false;
+	m_unsubscribedEventSubscribers = false;
+}
+
+void Comp2D::States::GameState::dispatchEvent( const SDL_Event& e )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u dispatchEvent: event of type %u\n", m_id, e.type );
+	#endif
+
+	if( m_unsubscribedEventSubscribers )
+	{
+		removeUnsubscribedEventSubscribers();
+	}
+
+	Comp2D::States::EventSubscribers* eventTypeSubscribers = nullptr;
+	Comp2D::States::EventSubscribers* keySubscribers = nullptr;
+
+	std::unordered_map<Uint64, Comp2D::States::EventSubscribers>::iterator eventSubscribersIt =
+		m_eventSubscribers.find( getEventSubscribersKey( e.type, SDLK_UNKNOWN ) );
+
+	if( eventSubscribersIt != m_eventSubscribers.end() )
+	{
+		eventTypeSubscribers = &eventSubscribersIt->second;
+	}
+
+	if
+	(
+		( e.type == SDL_KEYDOWN || e.type == SDL_KEYUP ) &&
+		e.key.keysym.sym != SDLK_UNKNOWN
+	)
+	{
+		eventSubscribersIt = m_eventSubscribers.find( getEventSubscribersKey( e.type, e.key.keysym.sym ) );
+
+		if( eventSubscribersIt != m_eventSubscribers.end() )
+		{
+			keySubscribers = &eventSubscribersIt->second;
+		}
+	}
+
+	// Subscribing while an event is dispatched may add entries to the
+	// unordered_map, which keeps the references to its values valid
+	dispatchEventToGameStateBehaviors( e, eventTypeSubscribers );
+	dispatchEventToGameStateBehaviors( e, keySubscribers );
+	dispatchEventToGameObjectBehaviors( e, eventTypeSubscribers );
+	dispatchEventToGameObjectBehaviors( e, keySubscribers );
+}
+
+void Comp2D::States::GameState::dispatchEventToGameObjectBehaviors( const SDL_Event& e, Comp2D::States::EventSubscribers* eventSubscribers )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u dispatchEventToGameObjectBehaviors: event of type %u\n", m_id, e.type );
+	#endif
+
+	if( eventSubscribers == nullptr )
+	{
+		return;
+	}
+
+	Comp2D::Components::GameObjectBehavior* currentGameObjectBehavior = nullptr;
+
+	// Behaviors subscribed by the subscribers themselves start receiving
+	// on the next event
+	size_t subscribersCount = eventSubscribers->gameObjectBehaviors.size();
+
+	for
+	(
+		size_t subscriberIndex = 0;
+		subscriberIndex < subscribersCount;
+		++subscriberIndex
+	)
+	{
+		currentGameObjectBehavior = eventSubscribers->gameObjectBehaviors[subscriberIndex];
+
+		if
+		(
+			currentGameObjectBehavior != nullptr &&
+			currentGameObjectBehavior->isEnabled() &&
+			currentGameObjectBehavior->isActiveInHierarchy() &&
+			currentGameObjectBehavior->gameObject->isActive() &&
+			currentGameObjectBehavior->gameObject->isActiveInHierarchy()
+		)
+		{
+			currentGameObjectBehavior->onEvent( e );
+		}
+	}
+}
+
+void Comp2D::States::GameState::dispatchEventToGameStateBehaviors( const SDL_Event& e, Comp2D::States::EventSubscribers* eventSubscribers )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u dispatchEventToGameStateBehaviors: event of type %u\n", m_id, e.type );
+	#endif
+
+	if( eventSubscribers == nullptr )
+	{
+		return;
+	}
+
+	Comp2D::States::GameStateBehavior* currentGameStateBehavior = nullptr;
+
+	size_t subscribersCount = eventSubscribers->gameStateBehaviors.size();
+
+	for
+	(
+		size_t subscriberIndex = 0;
+		subscriberIndex < subscribersCount;
+		++subscriberIndex
+	)
+	{
+		currentGameStateBehavior = eventSubscribers->gameStateBehaviors[subscriberIndex];
+
+		if
+		(
+			currentGameStateBehavior != nullptr &&
+			currentGameStateBehavior->isEnabled()
+		)
+		{
+			currentGameStateBehavior->onEvent( e );
+		}
+	}
+}
+
+void Comp2D::States::GameState::dispatchPendingMotionEvent()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u dispatchPendingMotionEvent\n", m_id );
+	#endif
 
-	m_gameStateBehaviorID = 0;
+	if( m_motionEventPending )
+	{
+		m_motionEventPending = false;
+		dispatchEvent( m_pendingMotionEvent );
+	}
 }
 
 void Comp2D::States::GameState::finalizeComponents()
@@ -413,6 +1077,10 @@ void Comp2D::States::GameState::finalizeComponents()
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u finalizeComponents\n", m_id );
 	#endif
 
+	// Still pending GameObjects are finalized and deleted with the others
+	applyGameStateCommands();
+	m_componentsInitialized = false;
+
 	m_renderableComponents.clear();
 
 	Comp2D::Objects::GameObject* currentGameObject = nullptr;
@@ -449,27 +1117,7 @@ void Comp2D::States::GameState::finalizeGameSeparateThreadsFunctions()
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u finalizeGameSeparateThreadsFunctions\n", m_id );
 	#endif
 
-	for
-	(
-		std::list<SDL_Thread*>::reverse_iterator gameStateSeparateThreadFunctionReverseIt = currentGameStateSeparateThreadFunctions.rbegin();
-		gameStateSeparateThreadFunctionReverseIt != currentGameStateSeparateThreadFunctions.rend();
-		++gameStateSeparateThreadFunctionReverseIt
-	)
-	{
-		#ifdef DEBUG
-			SDL_LogDebug
-			(
-				SDL_LOG_CATEGORY_TEST,
-				"GameState with ID %u Waiting Separate Thread Function With Address %p\n",
-				m_id,
-				*gameStateSeparateThreadFunctionReverseIt
-			);
-		#endif
-
-		SDL_WaitThread( *gameStateSeparateThreadFunctionReverseIt, nullptr );
-	}
-
-	currentGameStateSeparateThreadFunctions.clear();
+	Comp2D::Jobs::SeparateThreadFunctionCall::waitForAll( m_separateThreadFunctions );
 }
 
 void Comp2D::States::GameState::finalizeGameStateBehaviors()
@@ -495,41 +1143,78 @@ void Comp2D::States::GameState::finalizeGameStateTimedProcedures()
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u finalizeGameStateTimedProcedures\n", m_id );
 	#endif
 
+	m_timedProceduresScheduler.clear();
+}
+
+void Comp2D::States::GameState::finalizeGameStateTimerFunctions()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u finalizeGameStateTimerFunctions\n", m_id );
+	#endif
+
 	for
 	(
-		std::list<Comp2D::Time::TimedProcedure*>::reverse_iterator currentGameStateTimedProcedureReverseIt = currentGameStateTimedProcedures.rbegin();
-		currentGameStateTimedProcedureReverseIt != currentGameStateTimedProcedures.rend();
-		++currentGameStateTimedProcedureReverseIt
+		std::list<SDL_TimerID>::reverse_iterator timerFunctionIDReverseIt = m_timerFunctionsIDs.rbegin();
+		timerFunctionIDReverseIt != m_timerFunctionsIDs.rend();
+		++timerFunctionIDReverseIt
 	)
 	{
-		delete (*currentGameStateTimedProcedureReverseIt);
+		#ifdef DEBUG
+			SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u Removing Timer Function with ID %i\n", m_id, *timerFunctionIDReverseIt );
+		#endif
+
+		Comp2D::Jobs::TimerFunctionCall::stop( *timerFunctionIDReverseIt );
 	}
 
-	currentGameStatePausableTimedProcedures.clear();
-	currentGameStateTimedProcedures.clear();
+	m_timerFunctionsIDs.clear();
 }
 
-void Comp2D::States::GameState::finalizeGameStateTimerFunctions()
+bool Comp2D::States::GameState::flattenGameObjectTransforms( Comp2D::Objects::GameObject* gameObject, Sint32 parentTransformPosition )
 {
 	#ifdef DEBUG
-		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u finalizeGameStateTimerFunctions\n", m_id );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u flattenGameObjectTransforms: gameObject with ID %u\n", m_id, gameObject->getID() );
 	#endif
 
+	bool physicsTransformFound = false;
+
+	// Children of a GameObject without a TransformComponent have no parent one
+	Sint32 childrenParentTransformPosition = -1;
+
+	if( gameObject->transform )
+	{
+		childrenParentTransformPosition = static_cast<Sint32>( m_hierarchyTransforms.size() );
+
+		m_hierarchyTransforms.push_back( gameObject->transform );
+		m_hierarchyTransformsParentPositions.push_back( parentTransformPosition );
+
+		physicsTransformFound = gameObject->transform->hasRole( Comp2D::Components::EComponentRole::PhysicsTransform );
+	}
+
+	Comp2D::Objects::GameObject* currentChildGameObject = nullptr;
+
 	for
 	(
-		std::list<SDL_TimerID>::reverse_iterator currentGameStateTimerFunctionIDReverseIt = currentGameStateTimerFunctionsIDs.rbegin();
-		currentGameStateTimerFunctionIDReverseIt != currentGameStateTimerFunctionsIDs.rend();
-		++currentGameStateTimerFunctionIDReverseIt
+		std::vector<Comp2D::Objects::GameObject*>::iterator gameObjectIt = gameObject->childGameObjects.begin();
+		gameObjectIt != gameObject->childGameObjects.end();
+		++gameObjectIt
 	)
 	{
-		#ifdef DEBUG
-			SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u Removing Timer Function with ID %i\n", m_id, *currentGameStateTimerFunctionIDReverseIt );
-		#endif
+		currentChildGameObject = (*gameObjectIt);
 
-		SDL_RemoveTimer( *currentGameStateTimerFunctionIDReverseIt );
+		if
+		(
+			currentChildGameObject->isActiveInHierarchy() &&
+			currentChildGameObject->isActive()
+		)
+		{
+			if( flattenGameObjectTransforms( currentChildGameObject, childrenParentTransformPosition ) )
+			{
+				physicsTransformFound = true;
+			}
+		}
 	}
 
-	currentGameStateTimerFunctionsIDs.clear();
+	return physicsTransformFound;
 }
 
 void Comp2D::States::GameState::freeResourcesFromResourceComponents()
@@ -538,7 +1223,7 @@ void Comp2D::States::GameState::freeResourcesFromResourceComponents()
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u freeResourcesFromResourceComponents\n", m_id );
 	#endif
 
-	Game::resourcesManager->freeResources( m_resourceComponentsResourcesNames );
+	Game::getResourcesManager()->freeResources( m_resourceComponentsResourcesNames );
 
 	m_resourceComponentsResourcesNames.clear();
 }
@@ -549,6 +1234,9 @@ void Comp2D::States::GameState::initialize()
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u initialize\n", m_id );
 	#endif
 
+	// The GameObjects created by setup are initialized with the others
+	applyGameStateCommands();
+
 	loadResourcesFromResourceComponents();
 	solveGameObjectsComponentsDependencies();
 	initializeGameStateBehaviors();
@@ -588,32 +1276,19 @@ void Comp2D::States::GameState::initializeComponents()
 			Comp2D::Components::Component* currentComponent = (*componentIt);
 
 			currentComponent->onInitializeState();
-
-			if( Comp2D::Components::Renderable* currentRenderableComponent = dynamic_cast<Comp2D::Components::Renderable*>( currentComponent ) )
-			{
-				m_renderableComponents.push_back( currentRenderableComponent );
-			}
 		}
+
+		m_renderableComponents.insert
+		(
+			m_renderableComponents.end(),
+			currentGameObject->renderables.begin(),
+			currentGameObject->renderables.end()
+		);
 	}
 
-	m_renderableComponents.sort
-	(
-		[]( const Comp2D::Components::Renderable* renderableA, const Comp2D::Components::Renderable* renderableB )
-		{
-			if
-			(
-				static_cast<int>( renderableA->renderLayer ) < static_cast<int>( renderableB->renderLayer ) ||
-				(
-					renderableA->renderLayer == renderableB->renderLayer &&
-					renderableA->orderInRenderLayer < renderableB->orderInRenderLayer
-				)
-			)
-			{
-				return true;
-			}
-			return false;
-		}
-	);
+	m_renderableComponents.sort( isRenderedBefore );
+
+	m_componentsInitialized = true;
 }
 
 void Comp2D::States::GameState::initializeGameStateBehaviors()
@@ -633,29 +1308,76 @@ void Comp2D::States::GameState::initializeGameStateBehaviors()
 	}
 }
 
-void Comp2D::States::GameState::loadResourcesFromAnimationsControllerComponent( Comp2D::Components::AnimationsControllerComponent* animationsControllerComponent )
+void Comp2D::States::GameState::initializeCreatedGameObjects()
 {
 	#ifdef DEBUG
-		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u loadResourcesFromAnimationsControllerComponent: animationsControllerComponent with ID %u\n", m_id, animationsControllerComponent->getID() );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u initializeCreatedGameObjects\n", m_id );
 	#endif
 
-	std::string animationsControllerComponentACResourceName = animationsControllerComponent->getAnimationsControllerResource()->getName();
+	std::list<Comp2D::Components::Renderable*> createdRenderables;
 
-	m_resourceComponentsResourcesNames.emplace( animationsControllerComponentACResourceName );
+	Comp2D::Objects::GameObject* currentGameObject = nullptr;
+
+	for
+	(
+		std::vector<Comp2D::Objects::GameObject*>::iterator gameObjectIt = m_commandCreatedGameObjects.begin();
+		gameObjectIt != m_commandCreatedGameObjects.end();
+		++gameObjectIt
+	)
+	{
+		currentGameObject = (*gameObjectIt);
 
-	Game::resourcesManager->loadResource( animationsControllerComponentACResourceName );
+		// Created and destroyed on the same batch
+		if( currentGameObject->m_destroyPending )
+		{
+			continue;
+		}
 
-	const std::vector<std::string> animationsControllerComponentAnimationsResourcesNames
-		= animationsControllerComponent->getAnimationsController()->getAnimationsResourcesNames();
+		solveGameObjectComponentsDependencies( currentGameObject );
 
+		if( currentGameObject->transform )
+		{
+			currentGameObject->transform->onInitializeState();
+		}
+
+		for
+		(
+			std::vector<Comp2D::Components::Component*>::iterator componentIt = currentGameObject->components.begin();
+			componentIt != currentGameObject->components.end();
+			++componentIt
+		)
+		{
+			(*componentIt)->onInitializeState();
+		}
+
+		createdRenderables.insert
+		(
+			createdRenderables.end(),
+			currentGameObject->renderables.begin(),
+			currentGameObject->renderables.end()
+		);
+	}
+
+	// Merged in one pass instead of sorting the whole list again
+	createdRenderables.sort( isRenderedBefore );
+	m_renderableComponents.merge( createdRenderables, isRenderedBefore );
+}
+
+void Comp2D::States::GameState::keepResourcesLoaded( const std::set<std::string>& resourcesNames )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u keepResourcesLoaded\n", m_id );
+	#endif
+
+	// Resources shared with another GameState are not freed with this one
 	for
 	(
-		std::vector<std::string>::const_iterator animationResourceNameConstIt = animationsControllerComponentAnimationsResourcesNames.cbegin();
-		animationResourceNameConstIt != animationsControllerComponentAnimationsResourcesNames.cend();
-		++animationResourceNameConstIt
+		std::set<std::string>::const_iterator resourceNameConstIt = resourcesNames.cbegin();
+		resourceNameConstIt != resourcesNames.cend();
+		++resourceNameConstIt
 	)
 	{
-		m_resourceComponentsResourcesNames.emplace( *animationResourceNameConstIt );
+		m_resourceComponentsResourcesNames.erase( *resourceNameConstIt );
 	}
 }
 
@@ -665,151 +1387,289 @@ void Comp2D::States::GameState::loadResourcesFromResourceComponents()
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u loadResourcesFromResourceComponents\n", m_id );
 	#endif
 
-	Comp2D::Objects::GameObject* currentGameObject = nullptr;
+	collectResourcesNamesFromResourceComponents();
+
+	Game::getResourcesManager()->loadResources( m_resourceComponentsResourcesNames );
+
+	// The animations and timelines Resources are only known once their
+	// controllers are loaded
+	collectResourcesNamesFromResourceComponents();
+
+	Game::getResourcesManager()->loadResources( m_resourceComponentsResourcesNames );
+}
+
+void Comp2D::States::GameState::onGameObjectActivityChanged( Comp2D::Objects::GameObject* gameObject )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u onGameObjectActivityChanged: gameObject with ID %u\n", m_id, gameObject->getID() );
+	#endif
+
+	if( !gameObject->m_activityChangePending )
+	{
+		gameObject->m_activityChangePending = true;
+		m_activityChangedGameObjects.push_back( gameObject );
+	}
+}
+
+void Comp2D::States::GameState::onGameObjectBehaviorRemoved( Comp2D::Components::GameObjectBehavior* behavior )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u onGameObjectBehaviorRemoved: behavior with ID %u\n", m_id, behavior->getID() );
+	#endif
+
+	unsubscribeFromEvents( behavior );
+
+	Comp2D::Objects::GameObject* gameObject = behavior->gameObject;
+
+	Uint32 updatableBehaviorsEnd = gameObject->m_updatableBehaviorsIndex + gameObject->m_updatableBehaviorsCount;
 
 	for
 	(
-		std::list<Comp2D::Objects::GameObject*>::iterator gameObjectIt = m_gameObjects.begin();
-		gameObjectIt != m_gameObjects.end();
-		++gameObjectIt
+		Uint32 updatableBehaviorIndex = gameObject->m_updatableBehaviorsIndex;
+		updatableBehaviorIndex < updatableBehaviorsEnd;
+		++updatableBehaviorIndex
 	)
 	{
-		currentGameObject = (*gameObjectIt);
+		if( m_updatableBehaviors[updatableBehaviorIndex] == behavior )
+		{
+			m_updatableBehaviors[updatableBehaviorIndex] = nullptr;
+		}
+	}
 
-		Comp2D::Components::ResourceComponent* currentResourceComponent = nullptr;
+	Uint32 parallelUpdatableBehaviorsEnd = gameObject->m_parallelUpdatableBehaviorsIndex + gameObject->m_parallelUpdatableBehaviorsCount;
 
-		for
-		(
-			std::vector<Comp2D::Components::Component*>::iterator componentIt = currentGameObject->components.begin();
-			componentIt != currentGameObject->components.end();
-			++componentIt
-		)
+	for
+	(
+		Uint32 parallelUpdatableBehaviorIndex = gameObject->m_parallelUpdatableBehaviorsIndex;
+		parallelUpdatableBehaviorIndex < parallelUpdatableBehaviorsEnd;
+		++parallelUpdatableBehaviorIndex
+	)
+	{
+		if( m_parallelUpdatableBehaviors[parallelUpdatableBehaviorIndex] == behavior )
 		{
-			currentResourceComponent = dynamic_cast<Comp2D::Components::ResourceComponent*>( *componentIt );
+			m_parallelUpdatableBehaviors[parallelUpdatableBehaviorIndex] = nullptr;
+		}
+	}
 
-			if( currentResourceComponent )
-			{
-				m_resourceComponentsResourcesNames.emplace( currentResourceComponent->getResource()->getName() );
-			}
-			else
-			{
-				Comp2D::Components::AnimationsControllerComponent* currentAnimationsControllerComponent
-					= dynamic_cast<Comp2D::Components::AnimationsControllerComponent*>( *componentIt );
+	m_updatableBehaviorsChanged = true;
+}
 
-				if( currentAnimationsControllerComponent )
-				{
-					loadResourcesFromAnimationsControllerComponent( currentAnimationsControllerComponent );
-				}
-				else
-				{
-					Comp2D::Components::TimelinesControllerComponent* currentTimelinesControllerComponent
-						= dynamic_cast<Comp2D::Components::TimelinesControllerComponent*>( *componentIt );
+void Comp2D::States::GameState::onGameObjectBehaviorsChanged()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u onGameObjectBehaviorsChanged\n", m_id );
+	#endif
 
-					if( currentTimelinesControllerComponent )
-					{
-						loadResourcesFromTimelinesControllerComponent( currentTimelinesControllerComponent );
-					}
-				}
-			}
-		}
-	}
+	m_updatableBehaviorsChanged = true;
+}
+
+void Comp2D::States::GameState::pause()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u pause\n", m_id );
+	#endif
 
-	Game::resourcesManager->loadResources( m_resourceComponentsResourcesNames );
+	pauseGameStateTimedProcedures();
+	pauseGameStateBehaviors();
+	pauseGameObjectsComponents();
 }
 
-void Comp2D::States::GameState::loadResourcesFromTimelinesControllerComponent( Comp2D::Components::TimelinesControllerComponent* timelinesControllerComponent )
+void Comp2D::States::GameState::pauseGameObjectComponents( Comp2D::Objects::GameObject* gameObject )
 {
 	#ifdef DEBUG
-		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u loadResourcesFromTimelinesControllerComponent: timelinesControllerComponent with ID %u\n", m_id, timelinesControllerComponent->getID() );
+		/*
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"GameState with ID %u pauseGameObjectComponents: gameObject with ID %u\n",
+			m_id,
+			gameObject->getID()
+		);
+		*/
 	#endif
 
-	std::string timelinesControllerComponentTCResourceName = timelinesControllerComponent->getTimelinesControllerResource()->getName();
+	for
+	(
+		std::vector<Comp2D::Components::Component*>::iterator gameObjectComponentIt = gameObject->components.begin();
+		gameObjectComponentIt != gameObject->components.end();
+		++gameObjectComponentIt
+	)
+	{
+		(*gameObjectComponentIt)->onPaused();
+	}
+}
 
-	m_resourceComponentsResourcesNames.emplace( timelinesControllerComponentTCResourceName );
+void Comp2D::States::GameState::pauseGameObjectsComponents()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u pauseGameObjectsComponents\n", m_id );
+	#endif
 
-	Game::resourcesManager->loadResource( timelinesControllerComponentTCResourceName );
+	for
+	(
+		std::list<Comp2D::Objects::GameObject*>::iterator gameObjectIt = m_gameObjects.begin();
+		gameObjectIt != m_gameObjects.end();
+		++gameObjectIt
+	)
+	{
+		pauseGameObjectComponents( *gameObjectIt );
+	}
+}
 
-	const std::vector<std::string> timelinesControllerComponentTimelinesResourcesNames
-		= timelinesControllerComponent->getTimelinesController()->getTimelinesResourcesNames();
+void Comp2D::States::GameState::pauseGameStateBehaviors()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u pauseGameStateBehaviors\n", m_id );
+	#endif
 
 	for
 	(
-		std::vector<std::string>::const_iterator timelineResourceNameConstIt = timelinesControllerComponentTimelinesResourcesNames.cbegin();
-		timelineResourceNameConstIt != timelinesControllerComponentTimelinesResourcesNames.cend();
-		++timelineResourceNameConstIt
+		std::list<Comp2D::States::GameStateBehavior*>::iterator gameStateBehaviorIt = m_gameStateBehaviors.begin();
+		gameStateBehaviorIt != m_gameStateBehaviors.end();
+		++gameStateBehaviorIt
+	)
+	{
+		(*gameStateBehaviorIt)->onPaused();
+	}
+}
+
+void Comp2D::States::GameState::pendMotionEvent( const SDL_Event& e )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u pendMotionEvent: event of type %u\n", m_id, e.type );
+	#endif
+
+	// Nobody would receive it
+	if( m_eventSubscribers.find( getEventSubscribersKey( e.type, SDLK_UNKNOWN ) ) == m_eventSubscribers.end() )
+	{
+		return;
+	}
+
+	if
+	(
+		m_motionEventPending &&
+		!canCoalesceMotionEvents( m_pendingMotionEvent, e )
 	)
 	{
-		m_resourceComponentsResourcesNames.emplace( *timelineResourceNameConstIt );
+		dispatchPendingMotionEvent();
+	}
+
+	if( !m_motionEventPending )
+	{
+		m_motionEventPending = true;
+		m_pendingMotionEvent = e;
+		return;
+	}
+
+	// The latest event wins, except for the relative motions, which add up
+	SDL_Event coalescedMotionEvent = e;
+
+	if( e.type == SDL_MOUSEMOTION )
+	{
+		coalescedMotionEvent.motion.xrel += m_pendingMotionEvent.motion.xrel;
+		coalescedMotionEvent.motion.yrel += m_pendingMotionEvent.motion.yrel;
+	}
+	else if( e.type == SDL_FINGERMOTION )
+	{
+		coalescedMotionEvent.tfinger.dx += m_pendingMotionEvent.tfinger.dx;
+		coalescedMotionEvent.tfinger.dy += m_pendingMotionEvent.tfinger.dy;
 	}
+
+	m_pendingMotionEvent = coalescedMotionEvent;
 }
 
-void Comp2D::States::GameState::pause()
+void Comp2D::States::GameState::pushGameStateCommand( const Comp2D::States::GameStateCommand& gameStateCommand )
 {
 	#ifdef DEBUG
-		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u pause\n", m_id );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u pushGameStateCommand\n", m_id );
 	#endif
 
-	pauseGameStateTimedProcedures();
-	pauseGameStateBehaviors();
-	pauseGameObjectsComponents();
+	SDL_AtomicLock( &m_gameStateCommandsLock );
+	m_gameStateCommands.push_back( gameStateCommand );
+	SDL_AtomicUnlock( &m_gameStateCommandsLock );
 }
 
-void Comp2D::States::GameState::pauseGameObjectComponents( Comp2D::Objects::GameObject* gameObject )
+void Comp2D::States::GameState::removeUnsubscribedEventSubscribers()
 {
 	#ifdef DEBUG
-		/*
-		SDL_LogDebug
-		(
-			SDL_LOG_CATEGORY_TEST,
-			"GameState with ID %u pauseGameObjectComponents: gameObject with ID %u\n",
-			m_id,
-			gameObject->getID()
-		);
-		*/
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u removeUnsubscribedEventSubscribers\n", m_id );
 	#endif
 
-	for
-	(
-		std::vector<Comp2D::Components::Component*>::iterator gameObjectComponentIt = gameObject->components.begin();
-		gameObjectComponentIt != gameObject->components.end();
-		++gameObjectComponentIt
-	)
+	std::unordered_map<Uint64, Comp2D::States::EventSubscribers>::iterator eventSubscribersIt = m_eventSubscribers.begin();
+
+	while( eventSubscribersIt != m_eventSubscribers.end() )
 	{
-		(*gameObjectComponentIt)->onPaused();
+		Comp2D::States::EventSubscribers& eventSubscribers = eventSubscribersIt->second;
+
+		eventSubscribers.gameStateBehaviors.erase
+		(
+			std::remove( eventSubscribers.gameStateBehaviors.begin(), eventSubscribers.gameStateBehaviors.end(), nullptr ),
+			eventSubscribers.gameStateBehaviors.end()
+		);
+		eventSubscribers.gameObjectBehaviors.erase
+		(
+			std::remove( eventSubscribers.gameObjectBehaviors.begin(), eventSubscribers.gameObjectBehaviors.end(), nullptr ),
+			eventSubscribers.gameObjectBehaviors.end()
+		);
+
+		if( eventSubscribers.gameStateBehaviors.empty() && eventSubscribers.gameObjectBehaviors.empty() )
+		{
+			eventSubscribersIt = m_eventSubscribers.erase( eventSubscribersIt );
+		}
+		else
+		{
+			++eventSubscribersIt;
+		}
 	}
+
+	m_unsubscribedEventSubscribers = false;
 }
 
-void Comp2D::States::GameState::pauseGameObjectsComponents()
+void Comp2D::States::GameState::reparentGameObject( Comp2D::Objects::GameObject* gameObject, Comp2D::Objects::GameObject* parentGameObject )
 {
 	#ifdef DEBUG
-		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u pauseGameObjectsComponents\n", m_id );
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u reparentGameObject: gameObject with ID %u\n", m_id, gameObject->getID() );
 	#endif
 
+	if( gameObject->parentGameObject == parentGameObject || ( parentGameObject != nullptr && parentGameObject->m_destroyPending ) )
+	{
+		return;
+	}
+
+	// A GameObject cannot be moved under itself
 	for
 	(
-		std::list<Comp2D::Objects::GameObject*>::iterator gameObjectIt = m_gameObjects.begin();
-		gameObjectIt != m_gameObjects.end();
-		++gameObjectIt
+		Comp2D::Objects::GameObject* ancestorGameObject = parentGameObject;
+		ancestorGameObject != nullptr;
+		ancestorGameObject = ancestorGameObject->parentGameObject
 	)
 	{
-		pauseGameObjectComponents( *gameObjectIt );
+		if( ancestorGameObject == gameObject )
+		{
+			SDL_LogError( SDL_LOG_CATEGORY_APPLICATION, "GameObject with ID %u can not be reparented under its own child GameObject with ID %u!\n", gameObject->getID(), parentGameObject->getID() );
+
+			return;
+		}
 	}
-}
 
-void Comp2D::States::GameState::pauseGameStateBehaviors()
-{
-	#ifdef DEBUG
-		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u pauseGameStateBehaviors\n", m_id );
-	#endif
+	if( gameObject->parentGameObject != nullptr )
+	{
+		gameObject->parentGameObject->removeChildGameObject( gameObject, false );
+	}
 
-	for
-	(
-		std::list<Comp2D::States::GameStateBehavior*>::iterator gameStateBehaviorIt = m_gameStateBehaviors.begin();
-		gameStateBehaviorIt != m_gameStateBehaviors.end();
-		++gameStateBehaviorIt
-	)
+	if( parentGameObject != nullptr )
 	{
-		(*gameStateBehaviorIt)->onPaused();
+		parentGameObject->addChildGameObject( gameObject, gameObject->isActive(), parentGameObject->isActiveInHierarchy() );
+	}
+	else
+	{
+		gameObject->setActiveInHierarchy( true );
+	}
+
+	// Its world transform follows the new parent
+	if( gameObject->transform != nullptr )
+	{
+		gameObject->transform->markDirty();
 	}
 }
 
@@ -826,46 +1686,41 @@ void Comp2D::States::GameState::solveGameObjectComponentDependency( Comp2D::Obje
 		*/
 	#endif
 
+	std::unordered_map<std::string, Comp2D::Objects::GameObject*>::const_iterator requiredGameObjectIt =
+		m_gameObjectsByName.find( componentDependency->requiredGameObjectName );
+
+	if( requiredGameObjectIt == m_gameObjectsByName.cend() )
+	{
+		return;
+	}
+
+	Comp2D::Objects::GameObject* requiredGameObject = requiredGameObjectIt->second;
+
+	if( componentDependency->requiredObjectType == Comp2D::Objects::ERequiredObjectType::GameObject )
+	{
+		(*componentDependency->dependentPointerToRequiredObject) = requiredGameObject;
+
+		return;
+	}
+
+	unsigned int requiredGameObjectComponentIndex = 0;
+
 	for
 	(
-		std::list<Comp2D::Objects::GameObject*>::iterator gameObjectIt = m_gameObjects.begin();
-		gameObjectIt != m_gameObjects.end();
-		++gameObjectIt
+		std::vector<Comp2D::Components::Component*>::iterator requiredGameObjectComponentIt = requiredGameObject->components.begin();
+		requiredGameObjectComponentIt != requiredGameObject->components.end();
+		++requiredGameObjectComponentIt
 	)
 	{
-		Comp2D::Objects::GameObject* currentGameObject = *gameObjectIt;
+		Comp2D::Components::Component* currentRequiredGameObjectComponent = *requiredGameObjectComponentIt;
 
-		if( currentGameObject->getName().compare( componentDependency->requiredGameObjectName ) == 0 )
+		if
+		(
+			std::type_index( typeid( *currentRequiredGameObjectComponent ) ) == componentDependency->requiredComponentType &&
+			requiredGameObjectComponentIndex++ == componentDependency->requiredComponentIndex
+		)
 		{
-			if( componentDependency->requiredObjectType == Comp2D::Objects::ERequiredObjectType::GameObject )
-			{
-				(*componentDependency->dependentPointerToRequiredObject) = currentGameObject;
-			}
-			else
-			{
-				unsigned int currentGameObjectComponentIndex = 0;
-
-				for
-				(
-					std::vector<Comp2D::Components::Component*>::iterator gameObjectComponentIt = currentGameObject->components.begin();
-					gameObjectComponentIt != currentGameObject->components.end();
-					++gameObjectComponentIt
-				)
-				{
-					Comp2D::Components::Component* currentGameObjectComponent = *gameObjectComponentIt;
-
-					if
-					(
-						typeid( *currentGameObjectComponent ).hash_code() == componentDependency->requiredComponentType.hash_code() &&
-						currentGameObjectComponentIndex++ == componentDependency->requiredComponentIndex
-					)
-					{
-						(*componentDependency->dependentPointerToRequiredObject) = currentGameObjectComponent;
-
-						break;
-					}
-				}
-			}
+			(*componentDependency->dependentPointerToRequiredObject) = currentRequiredGameObjectComponent;
 
 			break;
 		}
@@ -995,14 +1850,14 @@ void Comp2D::States::GameState::unpauseGameStateBehaviors()
 	}
 }
 
-void Comp2D::States::GameState::updateGameObjectAnimationsControllerComponent( Comp2D::Objects::GameObject* gameObject, Uint32 currentTime )
+void Comp2D::States::GameState::updateGameObjectAnimationsControllerComponent( Comp2D::Objects::GameObject* gameObject, Uint64 currentTime )
 {
 	#ifdef DEBUG
 		/*
 		SDL_LogDebug
 		(
 			SDL_LOG_CATEGORY_TEST,
-			"GameState with ID %u updateGameObjectAnimationsControllerComponent: gameObject with ID %u; currentTime = %u\n",
+			"GameState with ID %u updateGameObjectAnimationsControllerComponent: gameObject with ID %u; currentTime = %" SDL_PRIu64 "\n",
 			m_stateID,
 			gameObject->getID(),
 			currentTime
@@ -1014,18 +1869,15 @@ void Comp2D::States::GameState::updateGameObjectAnimationsControllerComponent( C
 
 	for
 	(
-		//std::list<Comp2D::Components::Component*>::iterator activeInHierarchyComponentIt = gameObject->activeInHierarchyComponents.begin();
-		//activeInHierarchyComponentIt != gameObject->activeInHierarchyComponents.end();
-		std::vector<Comp2D::Components::Component*>::iterator activeInHierarchyComponentIt = gameObject->components.begin();
-		activeInHierarchyComponentIt != gameObject->components.end();
-		++activeInHierarchyComponentIt
+		std::vector<Comp2D::Components::AnimationsControllerComponent*>::iterator animationsControllerComponentIt = gameObject->animationsControllerComponents.begin();
+		animationsControllerComponentIt != gameObject->animationsControllerComponents.end();
+		++animationsControllerComponentIt
 	)
 	{
-		currentAnimationsControllerComponent = dynamic_cast<Comp2D::Components::AnimationsControllerComponent*>( *activeInHierarchyComponentIt );
+		currentAnimationsControllerComponent = *animationsControllerComponentIt;
 
 		if
 		(
-			currentAnimationsControllerComponent != nullptr &&
 			currentAnimationsControllerComponent->isEnabled() &&
 			currentAnimationsControllerComponent->isActiveInHierarchy()
 		)
@@ -1051,17 +1903,18 @@ void Comp2D::States::GameState::updateGameObjectBehaviors( Comp2D::Objects::Game
 
 	Comp2D::Components::GameObjectBehavior* currentBehavior = nullptr;
 
+	Uint32 updatableBehaviorsEnd = gameObject->m_updatableBehaviorsIndex + gameObject->m_updatableBehaviorsCount;
+
 	for
 	(
-		//std::list<Comp2D::Components::Component*>::iterator it = gameObject->activeInHierarchyComponents.begin();
-		//it != gameObject->activeInHierarchyComponents.end();
-		std::vector<Comp2D::Components::Component*>::iterator it = gameObject->components.begin();
-		it != gameObject->components.end();
-		++it
+		Uint32 updatableBehaviorIndex = gameObject->m_updatableBehaviorsIndex;
+		updatableBehaviorIndex < updatableBehaviorsEnd;
+		++updatableBehaviorIndex
 	)
 	{
-		currentBehavior = dynamic_cast<Comp2D::Components::GameObjectBehavior*>( *it );
+		currentBehavior = m_updatableBehaviors[updatableBehaviorIndex];
 
+		// Removed, disabled or deactivated since the last sync
 		if
 		(
 			currentBehavior != nullptr &&
@@ -1069,46 +1922,231 @@ void Comp2D::States::GameState::updateGameObjectBehaviors( Comp2D::Objects::Game
 			currentBehavior->isActiveInHierarchy()
 		)
 		{
+			COMP2D_PROFILE_ZONE( "GameObjectBehavior::update" );
+
 			currentBehavior->update();
 		}
 	}
 }
 
-void Comp2D::States::GameState::updateGameObjectsTransformComponent()
+void Comp2D::States::GameState::updateGameObjectsAnimationsControllerComponent( Uint64 currentTime )
 {
 	#ifdef DEBUG
-		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u updateGameObjectsTransformComponent\n", m_id );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u updateGameObjectsAnimationsControllerComponent: currentTime = %" SDL_PRIu64 "\n", m_id, currentTime );
 	#endif
 
+	COMP2D_PROFILE_ZONE( "GameState::updateGameObjectsAnimationsControllerComponent" );
+
 	Comp2D::Objects::GameObject* currentGameObject = nullptr;
 
 	for
 	(
-		std::list<Comp2D::Objects::GameObject*>::iterator gameObjectIt = m_gameObjects.begin();
-		gameObjectIt != m_gameObjects.end();
+		std::vector<Comp2D::Objects::GameObject*>::iterator gameObjectIt = m_activeGameObjects.begin();
+		gameObjectIt != m_activeGameObjects.end();
+		++gameObjectIt
+	)
+	{
+		currentGameObject = (*gameObjectIt);
+
+		// Deactivations on the phase take effect on the next sync
+		if( currentGameObject->isActive() && currentGameObject->isActiveInHierarchy() )
+		{
+			updateGameObjectAnimationsControllerComponent( currentGameObject, currentTime );
+		}
+	}
+}
+
+void Comp2D::States::GameState::updateGameObjectsBehaviors()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u updateGameObjectsBehaviors\n", m_id );
+	#endif
+
+	COMP2D_PROFILE_ZONE( "GameState::updateGameObjectsBehaviors" );
+
+	Comp2D::Objects::GameObject* currentGameObject = nullptr;
+
+	for
+	(
+		std::vector<Comp2D::Objects::GameObject*>::iterator gameObjectIt = m_activeGameObjects.begin();
+		gameObjectIt != m_activeGameObjects.end();
+		++gameObjectIt
+	)
+	{
+		currentGameObject = (*gameObjectIt);
+
+		// Deactivations on the phase take effect on the next sync
+		if( currentGameObject->isActive() && currentGameObject->isActiveInHierarchy() )
+		{
+			updateGameObjectBehaviors( currentGameObject );
+		}
+	}
+
+	// The parallel safe behaviors make no structural changes, so the arrays
+	// stay as they are until they are all done
+	Uint32 parallelUpdatableBehaviorsCount = static_cast<Uint32>( m_parallelUpdatableBehaviors.size() );
+
+	m_parallelUpdatableBehaviorsUpdating = true;
+
+	if
+	(
+		parallelUpdatableBehaviorsCount < PARALLEL_PHASE_MIN_COUNT ||
+		Comp2D::Game::jobSystem->getWorkersCount() == 0
+	)
+	{
+		updateParallelUpdatableBehaviors( 0, parallelUpdatableBehaviorsCount );
+	}
+	else
+	{
+		Comp2D::Game::jobSystem->parallelFor
+		(
+			parallelUpdatableBehaviorsCount,
+			0,
+			[this]( Uint32 firstIndex, Uint32 endIndex )
+			{
+				updateParallelUpdatableBehaviors( firstIndex, endIndex );
+			}
+		);
+	}
+
+	m_parallelUpdatableBehaviorsUpdating = false;
+}
+
+void Comp2D::States::GameState::updateGameObjectsTimelinesControllerComponent( Uint64 currentTime )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u updateGameObjectsTimelinesControllerComponent: currentTime = %" SDL_PRIu64 "\n", m_id, currentTime );
+	#endif
+
+	COMP2D_PROFILE_ZONE( "GameState::updateGameObjectsTimelinesControllerComponent" );
+
+	Comp2D::Objects::GameObject* currentGameObject = nullptr;
+
+	for
+	(
+		std::vector<Comp2D::Objects::GameObject*>::iterator gameObjectIt = m_activeGameObjects.begin();
+		gameObjectIt != m_activeGameObjects.end();
 		++gameObjectIt
 	)
 	{
 		currentGameObject = (*gameObjectIt);
 
+		// Deactivations on the phase take effect on the next sync
 		if( currentGameObject->isActive() && currentGameObject->isActiveInHierarchy() )
 		{
-			if( currentGameObject->parentGameObject == nullptr )
+			updateGameObjectTimelinesControllerComponent( currentGameObject, currentTime );
+		}
+	}
+}
+
+void Comp2D::States::GameState::updateGameObjectsTransformComponent()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u updateGameObjectsTransformComponent\n", m_id );
+	#endif
+
+	COMP2D_PROFILE_ZONE( "GameState::updateGameObjectsTransformComponent" );
+
+	applyGameObjectsActivityChanges();
+
+	if( m_transformsHierarchyChanged )
+	{
+		m_hierarchyTransforms.clear();
+		m_hierarchyTransformsParentPositions.clear();
+		m_hierarchyTransformsRootsBegins.clear();
+		m_parallelHierarchyTransformsRoots.clear();
+		m_serialHierarchyTransformsRoots.clear();
+
+		Uint32 rootBegin = 0;
+
+		bool physicsTransformFound = false;
+
+		for
+		(
+			std::vector<Comp2D::Objects::GameObject*>::iterator rootGameObjectIt = m_activeRootGameObjects.begin();
+			rootGameObjectIt != m_activeRootGameObjects.end();
+			++rootGameObjectIt
+		)
+		{
+			rootBegin = static_cast<Uint32>( m_hierarchyTransforms.size() );
+
+			physicsTransformFound = flattenGameObjectTransforms( *rootGameObjectIt, -1 );
+
+			if( m_hierarchyTransforms.size() == rootBegin )
+			{
+				continue;
+			}
+
+			if( physicsTransformFound )
+			{
+				m_serialHierarchyTransformsRoots.push_back( static_cast<Uint32>( m_hierarchyTransformsRootsBegins.size() ) );
+			}
+			else
+			{
+				m_parallelHierarchyTransformsRoots.push_back( static_cast<Uint32>( m_hierarchyTransformsRootsBegins.size() ) );
+			}
+
+			m_hierarchyTransformsRootsBegins.push_back( rootBegin );
+		}
+
+		// Ends the last root hierarchy
+		m_hierarchyTransformsRootsBegins.push_back( static_cast<Uint32>( m_hierarchyTransforms.size() ) );
+
+		m_transformsHierarchyChanged = false;
+	}
+
+	Uint32 hierarchyTransformsCount = static_cast<Uint32>( m_hierarchyTransforms.size() );
+	m_hierarchyTransformsRefreshed.resize( hierarchyTransformsCount );
+
+	if
+	(
+		hierarchyTransformsCount < PARALLEL_PHASE_MIN_COUNT ||
+		m_parallelHierarchyTransformsRoots.size() < 2 ||
+		Comp2D::Game::jobSystem->getWorkersCount() == 0
+	)
+	{
+		updateHierarchyTransforms( 0, hierarchyTransformsCount );
+
+		return;
+	}
+
+	Comp2D::Game::jobSystem->parallelFor
+	(
+		static_cast<Uint32>( m_parallelHierarchyTransformsRoots.size() ),
+		0,
+		[this]( Uint32 firstRoot, Uint32 endRoot )
+		{
+			Uint32 rootIndex = 0;
+
+			for( Uint32 root = firstRoot; root < endRoot; ++root )
 			{
-				updateGameObjectTransformComponent( currentGameObject );
+				rootIndex = m_parallelHierarchyTransformsRoots[root];
+
+				updateHierarchyTransforms( m_hierarchyTransformsRootsBegins[rootIndex], m_hierarchyTransformsRootsBegins[rootIndex + 1] );
 			}
 		}
+	);
+
+	// The bodies are moved in the b2World, which is not thread safe
+	for
+	(
+		std::vector<Uint32>::iterator rootIndexIt = m_serialHierarchyTransformsRoots.begin();
+		rootIndexIt != m_serialHierarchyTransformsRoots.end();
+		++rootIndexIt
+	)
+	{
+		updateHierarchyTransforms( m_hierarchyTransformsRootsBegins[*rootIndexIt], m_hierarchyTransformsRootsBegins[*rootIndexIt + 1] );
 	}
 }
 
-void Comp2D::States::GameState::updateGameObjectTimelinesControllerComponent( Comp2D::Objects::GameObject* gameObject, Uint32 currentTime )
+void Comp2D::States::GameState::updateGameObjectTimelinesControllerComponent( Comp2D::Objects::GameObject* gameObject, Uint64 currentTime )
 {
 	#ifdef DEBUG
 		/*
 		SDL_LogDebug
 		(
 			SDL_LOG_CATEGORY_TEST,
-			"GameState with ID %u updateGameObjectTimelinesControllerComponent: gameObject with ID %u; currentTime = %u\n",
+			"GameState with ID %u updateGameObjectTimelinesControllerComponent: gameObject with ID %u; currentTime = %" SDL_PRIu64 "\n",
 			m_stateID,
 			gameObject->getID(),
 			currentTime
@@ -1116,96 +2154,190 @@ void Comp2D::States::GameState::updateGameObjectTimelinesControllerComponent( Co
 		*/
 	#endif
 
-	Comp2D::Components::TimelinesControllerComponent* currentTimelinesControllerComponent = nullptr;
+	Comp2D::Components::TimelinesControllerComponent* currentTimelinesControllerComponent = nullptr;
+
+	for
+	(
+		std::vector<Comp2D::Components::TimelinesControllerComponent*>::iterator timelinesControllerComponentIt = gameObject->timelinesControllerComponents.begin();
+		timelinesControllerComponentIt != gameObject->timelinesControllerComponents.end();
+		++timelinesControllerComponentIt
+	)
+	{
+		currentTimelinesControllerComponent = *timelinesControllerComponentIt;
+
+		if
+		(
+			currentTimelinesControllerComponent->isEnabled() &&
+			currentTimelinesControllerComponent->isActiveInHierarchy()
+		)
+		{
+			currentTimelinesControllerComponent->update( currentTime );
+		}
+	}
+}
+
+void Comp2D::States::GameState::updateGameStateBehaviors()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u updateGameStateBehaviors\n", m_id );
+	#endif
+
+	Comp2D::States::GameStateBehavior* currentGameStateBehavior = nullptr;
+
+	for
+	(
+		std::list<Comp2D::States::GameStateBehavior*>::iterator gameStateBehaviorIt = m_gameStateBehaviors.begin();
+		gameStateBehaviorIt != m_gameStateBehaviors.end();
+		++gameStateBehaviorIt
+	)
+	{
+		currentGameStateBehavior = (*gameStateBehaviorIt);
+
+		if( currentGameStateBehavior->isEnabled() )
+		{
+			currentGameStateBehavior->update();
+		}
+	}
+}
+
+void Comp2D::States::GameState::updateHierarchyTransforms( Uint32 firstPosition, Uint32 endPosition )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u updateHierarchyTransforms: firstPosition = %u; endPosition = %u\n", m_id, firstPosition, endPosition );
+	#endif
+
+	// Parents come first, so whether one was refreshed is known before
+	// getting to its children
+	Comp2D::Components::TransformComponent* currentTransform = nullptr;
+
+	Sint32 currentParentTransformPosition = -1;
 
 	for
 	(
-		//std::list<Comp2D::Components::Component*>::iterator activeInHierarchyComponentIt = gameObject->activeInHierarchyComponents.begin();
-		//activeInHierarchyComponentIt != gameObject->activeInHierarchyComponents.end();
-		std::vector<Comp2D::Components::Component*>::iterator activeInHierarchyComponentIt = gameObject->components.begin();
-		activeInHierarchyComponentIt != gameObject->components.end();
-		++activeInHierarchyComponentIt
+		Uint32 hierarchyTransformPosition = firstPosition;
+		hierarchyTransformPosition < endPosition;
+		++hierarchyTransformPosition
 	)
 	{
-		currentTimelinesControllerComponent = dynamic_cast<Comp2D::Components::TimelinesControllerComponent*>( *activeInHierarchyComponentIt );
+		currentTransform = m_hierarchyTransforms[hierarchyTransformPosition];
+		currentParentTransformPosition = m_hierarchyTransformsParentPositions[hierarchyTransformPosition];
 
 		if
 		(
-			currentTimelinesControllerComponent != nullptr &&
-			currentTimelinesControllerComponent->isEnabled() &&
-			currentTimelinesControllerComponent->isActiveInHierarchy()
+			currentTransform->isDirty() ||
+			(
+				currentParentTransformPosition >= 0 &&
+				m_hierarchyTransformsRefreshed[currentParentTransformPosition] != 0
+			)
 		)
 		{
-			currentTimelinesControllerComponent->update( currentTime );
+			currentTransform->refreshTransform();
+			m_hierarchyTransformsRefreshed[hierarchyTransformPosition] = 1;
+		}
+		else
+		{
+			m_hierarchyTransformsRefreshed[hierarchyTransformPosition] = 0;
 		}
 	}
 }
 
-void Comp2D::States::GameState::updateGameObjectTransformComponent( Comp2D::Objects::GameObject* gameObject )
+void Comp2D::States::GameState::updateParallelUpdatableBehaviors( Uint32 firstIndex, Uint32 endIndex )
 {
 	#ifdef DEBUG
-		/*
-		SDL_LogDebug
-		(
-			SDL_LOG_CATEGORY_TEST,
-			"GameState with ID %u updateGameObjectTransformComponent: gameObject with ID %u\n",
-			m_id,
-			gameObject->getID()
-		);
-		*/
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u updateParallelUpdatableBehaviors: firstIndex = %u; endIndex = %u\n", m_id, firstIndex, endIndex );
 	#endif
 
-	if( gameObject->transform )
-	{
-		gameObject->transform->updateTransform();
-	}
-
-	Comp2D::Objects::GameObject* currentChildGameObject = nullptr;
+	Comp2D::Components::GameObjectBehavior* currentBehavior = nullptr;
 
 	for
 	(
-		//std::list<Comp2D::Objects::GameObject*>::iterator gameObjectIt = gameObject->activeInHierarchyChildGameObjects.begin();
-		//gameObjectIt != gameObject->activeInHierarchyChildGameObjects.end();
-		std::vector<Comp2D::Objects::GameObject*>::iterator gameObjectIt = gameObject->childGameObjects.begin();
-		gameObjectIt != gameObject->childGameObjects.end();
-		++gameObjectIt
+		Uint32 parallelUpdatableBehaviorIndex = firstIndex;
+		parallelUpdatableBehaviorIndex < endIndex;
+		++parallelUpdatableBehaviorIndex
 	)
 	{
-		currentChildGameObject = (*gameObjectIt);
+		currentBehavior = m_parallelUpdatableBehaviors[parallelUpdatableBehaviorIndex];
 
+		// Removed, disabled or deactivated since the last sync
 		if
 		(
-			currentChildGameObject->isActiveInHierarchy() &&
-			currentChildGameObject->isActive()
+			currentBehavior != nullptr &&
+			currentBehavior->isEnabled() &&
+			currentBehavior->isActiveInHierarchy()
 		)
 		{
-			updateGameObjectTransformComponent( currentChildGameObject );
+			#ifdef DEBUG
+				SDL_assert
+				(
+					currentBehavior->gameObject->transform == nullptr ||
+					!currentBehavior->gameObject->transform->hasRole( Comp2D::Components::EComponentRole::PhysicsTransform )
+				);
+			#endif
+
+			COMP2D_PROFILE_ZONE( "GameObjectBehavior::update" );
+
+			currentBehavior->update();
 		}
 	}
 }
 
-void Comp2D::States::GameState::updateGameStateBehaviors()
+void Comp2D::States::GameState::updateUpdatableBehaviors()
 {
 	#ifdef DEBUG
-		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u updateGameStateBehaviors\n", m_id );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u updateUpdatableBehaviors\n", m_id );
 	#endif
 
-	Comp2D::States::GameStateBehavior* currentGameStateBehavior = nullptr;
+	m_parallelUpdatableBehaviors.clear();
+	m_updatableBehaviors.clear();
+
+	Comp2D::Objects::GameObject* currentGameObject = nullptr;
+	Comp2D::Components::GameObjectBehavior* currentBehavior = nullptr;
+	bool physicsGameObject = false;
 
 	for
 	(
-		std::list<Comp2D::States::GameStateBehavior*>::iterator gameStateBehaviorIt = m_gameStateBehaviors.begin();
-		gameStateBehaviorIt != m_gameStateBehaviors.end();
-		++gameStateBehaviorIt
+		std::vector<Comp2D::Objects::GameObject*>::iterator gameObjectIt = m_activeGameObjects.begin();
+		gameObjectIt != m_activeGameObjects.end();
+		++gameObjectIt
 	)
 	{
-		currentGameStateBehavior = (*gameStateBehaviorIt);
+		currentGameObject = (*gameObjectIt);
+		// Its body lives in the b2World, which is not thread safe
+		physicsGameObject =
+			currentGameObject->transform != nullptr &&
+			currentGameObject->transform->hasRole( Comp2D::Components::EComponentRole::PhysicsTransform );
+		currentGameObject->m_parallelUpdatableBehaviorsIndex = static_cast<Uint32>( m_parallelUpdatableBehaviors.size() );
+		currentGameObject->m_updatableBehaviorsIndex = static_cast<Uint32>( m_updatableBehaviors.size() );
 
-		if( currentGameStateBehavior->isEnabled() )
+		for
+		(
+			std::vector<Comp2D::Components::GameObjectBehavior*>::iterator behaviorIt = currentGameObject->behaviors.begin();
+			behaviorIt != currentGameObject->behaviors.end();
+			++behaviorIt
+		)
 		{
-			currentGameStateBehavior->update();
+			currentBehavior = (*behaviorIt);
+
+			if( !currentBehavior->isEnabled() || !currentBehavior->isActiveInHierarchy() )
+			{
+				continue;
+			}
+
+			if( currentBehavior->isParallelSafe() && !physicsGameObject )
+			{
+				m_parallelUpdatableBehaviors.push_back( currentBehavior );
+			}
+			else
+			{
+				m_updatableBehaviors.push_back( currentBehavior );
+			}
 		}
+
+		currentGameObject->m_parallelUpdatableBehaviorsCount = static_cast<Uint32>( m_parallelUpdatableBehaviors.size() ) - currentGameObject->m_parallelUpdatableBehaviorsIndex;
+		currentGameObject->m_updatableBehaviorsCount = static_cast<Uint32>( m_updatableBehaviors.size() ) - currentGameObject->m_updatableBehaviorsIndex;
 	}
+
+	m_updatableBehaviorsChanged = false;
 }
 
 Comp2D::States::GameStateBehavior* Comp2D::States::GameState::attachGameStateBehavior
@@ -1249,16 +2381,12 @@ void Comp2D::States::GameState::callFunctionAfterTimeOnSeparateThread
 		);
 	#endif
 
-	currentGameStateTimerFunctionsIDs.push_back
-	(
-		SDL_AddTimer
-		(
-			callbackTimeInMilliseconds,
-			//timerFunction.target<Uint32(Uint32, void*)>(),
-			timerFunction,
-			param
-		)
-	);
+	SDL_TimerID timerFunctionID = Comp2D::Jobs::TimerFunctionCall::start( timerFunction, param, callbackTimeInMilliseconds );
+
+	if( timerFunctionID != 0 )
+	{
+		getSchedulingGameState()->m_timerFunctionsIDs.push_back( timerFunctionID );
+	}
 }
 
 void Comp2D::States::GameState::callFunctionOnSeparateThread
@@ -1272,18 +2400,15 @@ void Comp2D::States::GameState::callFunctionOnSeparateThread
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState callFunctionOnSeparateThread: threadName = %s\n", threadName.c_str() );
 	#endif
 
-	currentGameStateSeparateThreadFunctions.push_back
-	(
-		SDL_CreateThread
-		(
-			separateThreadFunction,
-			threadName.c_str(),
-			data
-		)
-	);
+	Comp2D::Jobs::SeparateThreadFunctionCall* separateThreadFunctionCall = Comp2D::Jobs::SeparateThreadFunctionCall::start( separateThreadFunction, data, threadName );
+
+	if( separateThreadFunctionCall != nullptr )
+	{
+		getSchedulingGameState()->m_separateThreadFunctions.push_back( separateThreadFunctionCall );
+	}
 }
 
-void Comp2D::States::GameState::callProcedureAfterTimeOnGameThread
+Comp2D::Time::TimedProcedureHandle Comp2D::States::GameState::callProcedureAfterTimeOnGameThread
 (
 	std::function<void()> timedProcedure,
 	Uint32 callbackTimeInMilliseconds,
@@ -1302,25 +2427,13 @@ void Comp2D::States::GameState::callProcedureAfterTimeOnGameThread
 		);
 	#endif
 
-	Comp2D::Time::TimedProcedure* createGameStateTimedProcedure = new Comp2D::Time::TimedProcedure
+	return getSchedulingGameState()->m_timedProceduresScheduler.schedule
 	(
-		currentGameStateTimedProcedureID++,
 		timedProcedure,
-		Comp2D::Game::timeManager->getTimeSinceSDLInitializationInMilliseconds() + callbackTimeInMilliseconds,
-		pausable
+		Comp2D::Time::millisecondsToNanoseconds( callbackTimeInMilliseconds ),
+		pausable,
+		Comp2D::Game::getTimeManager()->getTimeSinceSDLInitializationInNanoseconds()
 	);
-
-	if( createGameStateTimedProcedure->isPausable() )
-	{
-		if( Comp2D::Game::isPaused() )
-		{
-			createGameStateTimedProcedure->pause();
-		}
-
-		currentGameStatePausableTimedProcedures.push_back( createGameStateTimedProcedure );
-	}
-
-	currentGameStateTimedProcedures.push_back( createGameStateTimedProcedure );
 }
 
 void Comp2D::States::GameState::resetState()
@@ -1331,11 +2444,29 @@ void Comp2D::States::GameState::resetState()
 
 	finalize();
 
+	runSetup();
+	initialize();
+
+	Comp2D::Game::getTimeManager()->setCurrentStateInitializedTime( Comp2D::Game::getTimeManager()->getTimeSinceSDLInitializationInNanoseconds() );
+}
+
+void Comp2D::States::GameState::runSetup()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u runSetup\n", m_id );
+	#endif
+
+	Comp2D::Memory::MemoryArenaScope memoryArenaScope( &m_memoryArena );
+
+	Comp2D::GameContext* gameContext = Comp2D::GameContext::getCurrent();
+	Comp2D::States::GameState* previousSettingUpGameState = gameContext->settingUpGameState;
+
+	gameContext->settingUpGameState = this;
+
 	beforeSetup();
 	setup();
-	initialize();
 
-	Comp2D::Game::timeManager->setCurrentStateInitializedTime( Comp2D::Game::timeManager->getTimeSinceSDLInitializationInMilliseconds() );
+	gameContext->settingUpGameState = previousSettingUpGameState;
 }
 
 void Comp2D::States::GameState::setup()
@@ -1345,6 +2476,148 @@ void Comp2D::States::GameState::setup()
 	#endif
 }
 
+void Comp2D::States::GameState::subscribeToEvent( Comp2D::Components::GameObjectBehavior* gameObjectBehavior, Uint32 eventType, SDL_Keycode key )
+{
+	#ifdef DEBUG
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"GameState with ID %u subscribeToEvent: gameObjectBehavior with ID %u; eventType = %u; key = %i\n",
+			m_id,
+			gameObjectBehavior->getID(),
+			eventType,
+			key
+		);
+	#endif
+
+	std::vector<Comp2D::Components::GameObjectBehavior*>& gameObjectBehaviors =
+		m_eventSubscribers[getEventSubscribersKey( eventType, key )].gameObjectBehaviors;
+
+	if( std::find( gameObjectBehaviors.begin(), gameObjectBehaviors.end(), gameObjectBehavior ) == gameObjectBehaviors.end() )
+	{
+		gameObjectBehaviors.push_back( gameObjectBehavior );
+	}
+}
+
+void Comp2D::States::GameState::subscribeToEvent( Comp2D::States::GameStateBehavior* gameStateBehavior, Uint32 eventType, SDL_Keycode key )
+{
+	#ifdef DEBUG
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"GameState with ID %u subscribeToEvent: gameStateBehavior with ID %u; eventType = %u; key = %i\n",
+			m_id,
+			gameStateBehavior->getID(),
+			eventType,
+			key
+		);
+	#endif
+
+	std::vector<Comp2D::States::GameStateBehavior*>& gameStateBehaviors =
+		m_eventSubscribers[getEventSubscribersKey( eventType, key )].gameStateBehaviors;
+
+	if( std::find( gameStateBehaviors.begin(), gameStateBehaviors.end(), gameStateBehavior ) == gameStateBehaviors.end() )
+	{
+		gameStateBehaviors.push_back( gameStateBehavior );
+	}
+}
+
+void Comp2D::States::GameState::unsubscribeFromEvent( Comp2D::Components::GameObjectBehavior* gameObjectBehavior, Uint32 eventType, SDL_Keycode key )
+{
+	#ifdef DEBUG
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"GameState with ID %u unsubscribeFromEvent: gameObjectBehavior with ID %u; eventType = %u; key = %i\n",
+			m_id,
+			gameObjectBehavior->getID(),
+			eventType,
+			key
+		);
+	#endif
+
+	std::unordered_map<Uint64, Comp2D::States::EventSubscribers>::iterator eventSubscribersIt =
+		m_eventSubscribers.find( getEventSubscribersKey( eventType, key ) );
+
+	if( eventSubscribersIt != m_eventSubscribers.end() )
+	{
+		std::vector<Comp2D::Components::GameObjectBehavior*>& gameObjectBehaviors = eventSubscribersIt->second.gameObjectBehaviors;
+
+		std::replace( gameObjectBehaviors.begin(), gameObjectBehaviors.end(), gameObjectBehavior, static_cast<Comp2D::Components::GameObjectBehavior*>( nullptr ) );
+
+		m_unsubscribedEventSubscribers = true;
+	}
+}
+
+void Comp2D::States::GameState::unsubscribeFromEvent( Comp2D::States::GameStateBehavior* gameStateBehavior, Uint32 eventType, SDL_Keycode key )
+{
+	#ifdef DEBUG
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"GameState with ID %u unsubscribeFromEvent: gameStateBehavior with ID %u; eventType = %u; key = %i\n",
+			m_id,
+			gameStateBehavior->getID(),
+			eventType,
+			key
+		);
+	#endif
+
+	std::unordered_map<Uint64, Comp2D::States::EventSubscribers>::iterator eventSubscribersIt =
+		m_eventSubscribers.find( getEventSubscribersKey( eventType, key ) );
+
+	if( eventSubscribersIt != m_eventSubscribers.end() )
+	{
+		std::vector<Comp2D::States::GameStateBehavior*>& gameStateBehaviors = eventSubscribersIt->second.gameStateBehaviors;
+
+		std::replace( gameStateBehaviors.begin(), gameStateBehaviors.end(), gameStateBehavior, static_cast<Comp2D::States::GameStateBehavior*>( nullptr ) );
+
+		m_unsubscribedEventSubscribers = true;
+	}
+}
+
+void Comp2D::States::GameState::unsubscribeFromEvents( Comp2D::Components::GameObjectBehavior* gameObjectBehavior )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u unsubscribeFromEvents: gameObjectBehavior with ID %u\n", m_id, gameObjectBehavior->getID() );
+	#endif
+
+	for
+	(
+		std::unordered_map<Uint64, Comp2D::States::EventSubscribers>::iterator eventSubscribersIt = m_eventSubscribers.begin();
+		eventSubscribersIt != m_eventSubscribers.end();
+		++eventSubscribersIt
+	)
+	{
+		std::vector<Comp2D::Components::GameObjectBehavior*>& gameObjectBehaviors = eventSubscribersIt->second.gameObjectBehaviors;
+
+		std::replace( gameObjectBehaviors.begin(), gameObjectBehaviors.end(), gameObjectBehavior, static_cast<Comp2D::Components::GameObjectBehavior*>( nullptr ) );
+	}
+
+	m_unsubscribedEventSubscribers = true;
+}
+
+void Comp2D::States::GameState::unsubscribeFromEvents( Comp2D::States::GameStateBehavior* gameStateBehavior )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u unsubscribeFromEvents: gameStateBehavior with ID %u\n", m_id, gameStateBehavior->getID() );
+	#endif
+
+	for
+	(
+		std::unordered_map<Uint64, Comp2D::States::EventSubscribers>::iterator eventSubscribersIt = m_eventSubscribers.begin();
+		eventSubscribersIt != m_eventSubscribers.end();
+		++eventSubscribersIt
+	)
+	{
+		std::vector<Comp2D::States::GameStateBehavior*>& gameStateBehaviors = eventSubscribersIt->second.gameStateBehaviors;
+
+		std::replace( gameStateBehaviors.begin(), gameStateBehaviors.end(), gameStateBehavior, static_cast<Comp2D::States::GameStateBehavior*>( nullptr ) );
+	}
+
+	m_unsubscribedEventSubscribers = true;
+}
+
 Uint32 Comp2D::States::GameState::getID() const
 {
 	#ifdef DEBUG
@@ -1354,6 +2627,52 @@ Uint32 Comp2D::States::GameState::getID() const
 	return m_id;
 }
 
+Comp2D::Objects::GameObject* Comp2D::States::GameState::getGameObject( unsigned int id ) const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u getGameObject: id = %u\n", m_id, id );
+	#endif
+
+	std::unordered_map<unsigned int, Comp2D::Objects::GameObject*>::const_iterator gameObjectIt = m_gameObjectsByID.find( id );
+
+	if( gameObjectIt != m_gameObjectsByID.cend() )
+	{
+		return gameObjectIt->second;
+	}
+
+	return nullptr;
+}
+
+Comp2D::Objects::GameObject* Comp2D::States::GameState::getGameObject( const std::string& name ) const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u getGameObject: name = %s\n", m_id, name.c_str() );
+	#endif
+
+	std::unordered_map<std::string, Comp2D::Objects::GameObject*>::const_iterator gameObjectIt = m_gameObjectsByName.find( name );
+
+	if( gameObjectIt != m_gameObjectsByName.cend() )
+	{
+		return gameObjectIt->second;
+	}
+
+	return nullptr;
+}
+
+Comp2D::Components::TransformComponentsStorage* Comp2D::States::GameState::getTransformComponentsStorage()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u getTransformComponentsStorage\n", m_id );
+	#endif
+
+	if( m_transformComponentsStorageEnabled )
+	{
+		return &m_transformComponentsStorage;
+	}
+
+	return nullptr;
+}
+
 Comp2D::Components::Component* Comp2D::States::GameState::createComponent
 (
 	Comp2D::Components::Component* component,
@@ -1399,7 +2718,9 @@ Comp2D::Components::TransformComponent*  Comp2D::States::GameState::createTransf
 	#endif
 
 	transformComponent->onInstantiated();
+	transformComponent->m_roles = Comp2D::Components::ComponentType::getRoles( transformComponent );
 	transformComponent->gameObject->transform = transformComponent;
+	m_transformsHierarchyChanged = true;
 	transformComponent->setActiveInHierarchy( transformComponent->gameObject->isActiveInHierarchy() );
 	transformComponent->setEnabled( enabled );
 	return transformComponent;
@@ -1420,5 +2741,80 @@ Comp2D::Objects::GameObject* Comp2D::States::GameState::createGameObject( Comp2D
 	#endif
 
 	m_gameObjects.push_back( gameObject );
+	m_gameObjectsByID.emplace( gameObject->getID(), gameObject );
+	m_gameObjectsByName.emplace( gameObject->getName(), gameObject );
+
+	gameObject->m_creationOrder = m_createdGameObjectsCount++;
+	gameObject->notifyActivityChanged();
+
 	return gameObject;
 }
+
+void Comp2D::States::GameState::deferCreateGameObject( Comp2D::Objects::GameObject* gameObject, Comp2D::Objects::GameObject* parentGameObject )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u deferCreateGameObject: gameObject with ID %u\n", m_id, gameObject->getID() );
+	#endif
+
+	Comp2D::States::GameStateCommand gameStateCommand;
+	gameStateCommand.type = Comp2D::States::EGameStateCommandType::CreateGameObject;
+	gameStateCommand.gameObject = gameObject;
+	gameStateCommand.parentGameObject = parentGameObject;
+
+	pushGameStateCommand( gameStateCommand );
+}
+
+void Comp2D::States::GameState::deferDestroyGameObject( Comp2D::Objects::GameObject* gameObject )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u deferDestroyGameObject: gameObject with ID %u\n", m_id, gameObject->getID() );
+	#endif
+
+	Comp2D::States::GameStateCommand gameStateCommand;
+	gameStateCommand.type = Comp2D::States::EGameStateCommandType::DestroyGameObject;
+	gameStateCommand.gameObject = gameObject;
+
+	pushGameStateCommand( gameStateCommand );
+}
+
+void Comp2D::States::GameState::deferReparentGameObject( Comp2D::Objects::GameObject* gameObject, Comp2D::Objects::GameObject* parentGameObject )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u deferReparentGameObject: gameObject with ID %u\n", m_id, gameObject->getID() );
+	#endif
+
+	Comp2D::States::GameStateCommand gameStateCommand;
+	gameStateCommand.type = Comp2D::States::EGameStateCommandType::ReparentGameObject;
+	gameStateCommand.gameObject = gameObject;
+	gameStateCommand.parentGameObject = parentGameObject;
+
+	pushGameStateCommand( gameStateCommand );
+}
+
+void Comp2D::States::GameState::deferSetComponentEnabled( Comp2D::Components::Component* component, bool enabled )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u deferSetComponentEnabled: component with ID %u; enabled = %i\n", m_id, component->getID(), enabled );
+	#endif
+
+	Comp2D::States::GameStateCommand gameStateCommand;
+	gameStateCommand.type = Comp2D::States::EGameStateCommandType::SetComponentEnabled;
+	gameStateCommand.value = enabled;
+	gameStateCommand.component = component;
+
+	pushGameStateCommand( gameStateCommand );
+}
+
+void Comp2D::States::GameState::deferSetGameObjectActive( Comp2D::Objects::GameObject* gameObject, bool active )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameState with ID %u deferSetGameObjectActive: gameObject with ID %u; active = %i\n", m_id, gameObject->getID(), active );
+	#endif
+
+	Comp2D::States::GameStateCommand gameStateCommand;
+	gameStateCommand.type = Comp2D::States::EGameStateCommandType::SetGameObjectActive;
+	gameStateCommand.value = active;
+	gameStateCommand.gameObject = gameObject;
+
+	pushGameStateCommand( gameStateCommand );
+}
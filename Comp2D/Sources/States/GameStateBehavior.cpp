@@ -242,6 +242,24 @@ void Comp2D::States::GameStateBehavior::setEnabled( bool enabled )
 	}
 }
 
+void Comp2D::States::GameStateBehavior::subscribeToEvent( Uint32 eventType, SDL_Keycode key )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameStateBehavior with ID %u subscribeToEvent: eventType = %u; key = %i\n", m_id, eventType, key );
+	#endif
+
+	gameState->subscribeToEvent( this, eventType, key );
+}
+
+void Comp2D::States::GameStateBehavior::unsubscribeFromEvent( Uint32 eventType, SDL_Keycode key )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "GameStateBehavior with ID %u unsubscribeFromEvent: eventType = %u; key = %i\n", m_id, eventType, key );
+	#endif
+
+	gameState->unsubscribeFromEvent( this, eventType, key );
+}
+
 bool Comp2D::States::GameStateBehavior::isEnabled() const
 {
 	#ifdef DEBUG
@@ -34,6 +34,7 @@
 #include "Box2D/Dynamics/b2WorldCallbacks.h"
 #include "Box2D/Dynamics/Contacts/b2Contact.h"
 
+#include "Comp2D/Headers/Memory/MemoryArena.h"
 #include "Comp2D/Headers/Objects/GameObject.h"
 
 Comp2D::States::PhysicsEvent::PhysicsEvent
@@ -96,3 +97,21 @@ Comp2D::States::PhysicsEvent::~PhysicsEvent()
 		*/
 	#endif
 }
+
+void* Comp2D::States::PhysicsEvent::operator new( size_t size )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "PhysicsEvent operator new: size = %u\n", static_cast<unsigned int>( size ) );
+	#endif
+
+	return Comp2D::Memory::MemoryArena::allocate( size );
+}
+
+void Comp2D::States::PhysicsEvent::operator delete( void* pointer )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "PhysicsEvent operator delete\n" );
+	#endif
+
+	Comp2D::Memory::MemoryArena::deallocate( pointer );
+}
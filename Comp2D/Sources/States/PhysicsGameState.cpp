@@ -26,6 +26,7 @@
 
 #include "Comp2D/Headers/States/PhysicsGameState.h"
 
+#include <algorithm>
 #include <iterator>
 #include <list>
 
@@ -34,12 +35,19 @@
 #include "Box2D/Collision/b2Collision.h"
 #include "Box2D/Common/b2Math.h"
 #include "Box2D/Common/b2Settings.h"
+#include "Box2D/Dynamics/b2Body.h"
 #include "Box2D/Dynamics/b2World.h"
 #include "Box2D/Dynamics/b2WorldCallbacks.h"
 #include "Box2D/Dynamics/Contacts/b2Contact.h"
 
 #include "Comp2D/Headers/Game.h"
+#include "Comp2D/Headers/Components/ComponentType.h"
+#include "Comp2D/Headers/Components/PhysicsTransformComponent.h"
+#include "Comp2D/Headers/Memory/MemoryArena.h"
+#include "Comp2D/Headers/Memory/MemoryArenaScope.h"
 #include "Comp2D/Headers/Objects/GameObject.h"
+#include "Comp2D/Headers/Profiling/ProfilerZone.h"
+#include "Comp2D/Headers/Quality/QualityGovernor.h"
 #include "Comp2D/Headers/States/GameState.h"
 #include "Comp2D/Headers/States/GameStateBehavior.h"
 #include "Comp2D/Headers/States/BeginContactPhysicsEvent.h"
@@ -62,6 +70,9 @@ Comp2D::States::PhysicsGameState::PhysicsGameState
 	:
 	Comp2D::States::GameState( stateID ),
 	b2ContactListener(),
+	m_physicsQualityFeatureID{ 0 },
+	m_governedVelocityIterations{ velocityIterations },
+	m_governedPositionIterations{ positionIterations },
 	m_velocityIterations{ velocityIterations },
 	m_positionIterations{ positionIterations },
 	m_timeStep{ timeStep },
@@ -93,6 +104,8 @@ void Comp2D::States::PhysicsGameState::beforeSetup()
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "PhysicsGameState with ID %u beforeSetup\n", m_id );
 	#endif
 
+	Comp2D::Game::getTimeManager()->setFixedDeltaTime( m_timeStep );
+
 	initializePhysicsWorld();
 }
 
@@ -114,50 +127,148 @@ void Comp2D::States::PhysicsGameState::finalize()
 	finalizePhysicsWorld();
 }
 
-void Comp2D::States::PhysicsGameState::update()
+void Comp2D::States::PhysicsGameState::fixedUpdate()
 {
 	#ifdef DEBUG
-		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "PhysicsGameState with ID %u update\n", m_stateID );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "PhysicsGameState with ID %u fixedUpdate\n", m_id );
 	#endif
 
-	Uint32 currentTimeSinceSDLInitializationInMilliseconds = Comp2D::Game::timeManager->getTimeSinceSDLInitializationInMilliseconds();
+	COMP2D_PROFILE_ZONE( "PhysicsGameState::fixedUpdate" );
 
-	world->Step
-	(
-		m_timeStep * Comp2D::Game::timeManager->getTimeScale(),
-		m_velocityIterations,
-		m_positionIterations
-	);
+	if( m_transformComponentsStorageEnabled )
+	{
+		m_transformComponentsStorage.savePreviousWorldTransforms();
+	}
+	else
+	{
+		for
+		(
+			b2Body* body = world->GetBodyList();
+			body != nullptr;
+			body = body->GetNext()
+		)
+		{
+			Comp2D::Objects::GameObject* bodyGameObject = static_cast<Comp2D::Objects::GameObject*>( body->GetUserData() );
+
+			if
+			(
+				bodyGameObject != nullptr &&
+				bodyGameObject->transform != nullptr &&
+				bodyGameObject->transform->hasRole( Comp2D::Components::EComponentRole::PhysicsTransform )
+			)
+			{
+				static_cast<Comp2D::Components::PhysicsTransformComponent*>( bodyGameObject->transform )->savePreviousWorldTransform();
+			}
+		}
+	}
 
-	triggerPhysicsEvents();
+	#ifdef PROFILING
+		Uint64 stepBeginCounter = SDL_GetPerformanceCounter();
+	#endif
 
-	updateGameStateBehaviors();
+	{
+		Comp2D::Memory::MemoryArenaScope memoryArenaScope( &m_physicsEventsMemoryArena );
 
-	// updateGameObjects()
-	Comp2D::Objects::GameObject* currentGameObject = nullptr;
+		world->Step
+		(
+			Comp2D::Game::getTimeManager()->getFixedDeltaTimeInSeconds(),
+			m_governedVelocityIterations,
+			m_governedPositionIterations
+		);
+	}
 
-	for
-	(
-		std::list<Comp2D::Objects::GameObject*>::iterator gameObjectIt = m_gameObjects.begin();
-		gameObjectIt != m_gameObjects.end();
-		++gameObjectIt
-	)
-	{
-		currentGameObject = (*gameObjectIt);
+	#ifdef PROFILING
+		addPhysicsWorldStepZones( stepBeginCounter, SDL_GetPerformanceCounter() );
+	#endif
 
-		if( currentGameObject->isActive() && currentGameObject->isActiveInHierarchy() )
+	// Only what the step may have moved gets its transform refreshed
+	if( m_transformComponentsStorageEnabled )
+	{
+		m_transformComponentsStorage.markAwakeBodiesDirty();
+	}
+	else
+	{
+		for
+		(
+			b2Body* body = world->GetBodyList();
+			body != nullptr;
+			body = body->GetNext()
+		)
 		{
-			// updateGameObject( currentGameObject, currentTimeSinceSDLInitializationInMilliseconds )
-			updateGameObjectAnimationsControllerComponent( currentGameObject, currentTimeSinceSDLInitializationInMilliseconds );
+			if
+			(
+				body->GetType() == b2_staticBody ||
+				!body->IsAwake()
+			)
+			{
+				continue;
+			}
 
-			updateGameObjectTimelinesControllerComponent( currentGameObject, currentTimeSinceSDLInitializationInMilliseconds );
+			Comp2D::Objects::GameObject* bodyGameObject = static_cast<Comp2D::Objects::GameObject*>( body->GetUserData() );
 
-			if( currentGameObject->parentGameObject == nullptr )
+			if
+			(
+				bodyGameObject != nullptr &&
+				bodyGameObject->transform != nullptr &&
+				bodyGameObject->transform->hasRole( Comp2D::Components::EComponentRole::PhysicsTransform )
+			)
 			{
-				updateGameObjectTransformComponent( currentGameObject );
+				bodyGameObject->transform->markDirty();
 			}
+		}
+	}
+
+	// Contacts are only valid until the next step
+	triggerPhysicsEvents();
+}
+
+#ifdef PROFILING
+void Comp2D::States::PhysicsGameState::addPhysicsWorldStepZones( Uint64 stepBeginCounter, Uint64 stepEndCounter )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "PhysicsGameState with ID %u addPhysicsWorldStepZones\n", m_id );
+	#endif
 
-			updateGameObjectBehaviors( currentGameObject );
+	Comp2D::Profiling::Profiler::addZone( "b2World::Step", stepBeginCounter, stepEndCounter );
+
+	// b2World::Step only reports how long each of its phases took, in
+	// milliseconds, so the phases are laid out one after the other from the
+	// start of the step, which is the order Box2D runs them in
+	const b2Profile& stepProfile = world->GetProfile();
+
+	double counterTicksPerMillisecond = static_cast<double>( SDL_GetPerformanceFrequency() ) / 1000.0;
+
+	// Clamped, since b2Timer and the performance counter may disagree slightly
+	Uint64 collideEndCounter = std::min( stepBeginCounter + static_cast<Uint64>( stepProfile.collide * counterTicksPerMillisecond ), stepEndCounter );
+	Uint64 solveEndCounter = std::min( collideEndCounter + static_cast<Uint64>( stepProfile.solve * counterTicksPerMillisecond ), stepEndCounter );
+	Uint64 solveTOIEndCounter = std::min( solveEndCounter + static_cast<Uint64>( stepProfile.solveTOI * counterTicksPerMillisecond ), stepEndCounter );
+
+	Comp2D::Profiling::Profiler::addZone( "b2World::Step collide", stepBeginCounter, collideEndCounter );
+	Comp2D::Profiling::Profiler::addZone( "b2World::Step solve", collideEndCounter, solveEndCounter );
+	Comp2D::Profiling::Profiler::addZone( "b2World::Step solveTOI", solveEndCounter, solveTOIEndCounter );
+}
+#endif
+
+void Comp2D::States::PhysicsGameState::endContactGameStateBehaviors( b2Contact* contact, Comp2D::Objects::GameObject* gameObjectA, Comp2D::Objects::GameObject* gameObjectB )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "PhysicsGameState with ID %u endContactGameStateBehaviors\n", m_id );
+	#endif
+
+	Comp2D::States::GameStateBehavior* currentGameStateBehavior = nullptr;
+
+	for
+	(
+		std::list<Comp2D::States::GameStateBehavior*>::iterator gameStateBehaviorIt = m_gameStateBehaviors.begin();
+		gameStateBehaviorIt != m_gameStateBehaviors.end();
+		++gameStateBehaviorIt
+	)
+	{
+		currentGameStateBehavior = (*gameStateBehaviorIt);
+
+		if( currentGameStateBehavior->isEnabled() )
+		{
+			currentGameStateBehavior->endContact( contact, gameObjectA, gameObjectB );
 		}
 	}
 }
@@ -168,6 +279,8 @@ void Comp2D::States::PhysicsGameState::finalizePhysicsWorld()
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "PhysicsGameState with ID %u finalizePhysicsWorld\n", m_id );
 	#endif
 
+	Comp2D::Game::getQualityGovernor()->unregisterFeature( m_physicsQualityFeatureID );
+
 	delete world;
 	world = nullptr;
 }
@@ -180,6 +293,35 @@ void Comp2D::States::PhysicsGameState::initializePhysicsWorld()
 
 	world = new b2World( m_gravity );
 	world->SetContactListener( this );
+
+	m_governedVelocityIterations = m_velocityIterations;
+	m_governedPositionIterations = m_positionIterations;
+
+	// Degraded after the render scale, as fewer iterations change how the
+	// bodies behave
+	m_physicsQualityFeatureID = Comp2D::Game::getQualityGovernor()->registerFeature
+	(
+		"Physics iterations",
+		PHYSICS_QUALITY_LEVELS_COUNT,
+		[this]( Uint32 physicsQualityLevel )
+		{
+			setPhysicsQualityLevel( physicsQualityLevel );
+		},
+		1
+	);
+}
+
+void Comp2D::States::PhysicsGameState::setPhysicsQualityLevel( Uint32 physicsQualityLevel )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "PhysicsGameState with ID %u setPhysicsQualityLevel: physicsQualityLevel = %u\n", m_id, physicsQualityLevel );
+	#endif
+
+	// Every level takes a quarter of the configured iterations away
+	int32 keptQuarters = 4 - static_cast<int32>( physicsQualityLevel );
+
+	m_governedVelocityIterations = std::max( 1, m_velocityIterations * keptQuarters / 4 );
+	m_governedPositionIterations = std::max( 1, m_positionIterations * keptQuarters / 4 );
 }
 
 void Comp2D::States::PhysicsGameState::triggerPhysicsEvents()
@@ -210,6 +352,7 @@ void Comp2D::States::PhysicsGameState::triggerPhysicsEvents()
 	}
 
 	m_physicsEvents.clear();
+	m_physicsEventsMemoryArena.reset();
 }
 
 void Comp2D::States::PhysicsGameState::setup()
@@ -249,6 +392,27 @@ void Comp2D::States::PhysicsGameState::EndContact( b2Contact* contact )
 	Comp2D::Objects::GameObject* gameObjectA = reinterpret_cast<Comp2D::Objects::GameObject*>( contact->GetFixtureA()->GetUserData() );
 	Comp2D::Objects::GameObject* gameObjectB = reinterpret_cast<Comp2D::Objects::GameObject*>( contact->GetFixtureB()->GetUserData() );
 
+	// Outside the step the contact ends because a body or fixture is being
+	// destroyed or deactivated, and it is freed before the events would be
+	// triggered. It is dispatched right away, skipping the GameObjects
+	// being destroyed
+	if( !world->IsLocked() )
+	{
+		endContactGameStateBehaviors( contact, gameObjectA, gameObjectB );
+
+		if( !gameObjectA->isDestroyPending() )
+		{
+			gameObjectA->endContact( contact, gameObjectB );
+		}
+
+		if( !gameObjectB->isDestroyPending() )
+		{
+			gameObjectB->endContact( contact, gameObjectA );
+		}
+
+		return;
+	}
+
 	m_physicsEvents.push_back
 	(
 		new EndContactPhysicsEvent
@@ -0,0 +1,263 @@
+/* FrameStatistics.cpp -- 'Comp2D' Game Engine 'FrameStatistics' class source file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#include "Comp2D/Headers/Time/FrameStatistics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <SDL.h>
+
+Comp2D::Time::FrameStatistics::FrameStatistics()
+	:
+	m_frameBudgetInNanoseconds{ 0 }
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "FrameStatistics Constructor body Start\n" );
+	#endif
+
+	m_sortedFrameTimesInNanoseconds.reserve( FRAME_TIMES_RING_CAPACITY );
+
+	reset();
+
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "FrameStatistics Constructor body End\n" );
+	#endif
+}
+
+Comp2D::Time::FrameStatistics::~FrameStatistics()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "FrameStatistics Destroying\n" );
+	#endif
+
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "FrameStatistics Destroyed\n" );
+	#endif
+}
+
+void Comp2D::Time::FrameStatistics::updateRollingStatistics()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "FrameStatistics updateRollingStatistics\n" );
+	#endif
+
+	// Sorted at most once per frame, and only when a getter asks for it
+	m_sortedFrameTimesInNanoseconds.assign( m_frameTimesRingInNanoseconds, m_frameTimesRingInNanoseconds + m_frameTimesRingSize );
+
+	std::sort( m_sortedFrameTimesInNanoseconds.begin(), m_sortedFrameTimesInNanoseconds.end() );
+
+	m_maximumFrameTimeInNanoseconds = m_sortedFrameTimesInNanoseconds.empty() ? 0 : m_sortedFrameTimesInNanoseconds.back();
+
+	m_rollingStatisticsOutdated = false;
+}
+
+Uint32 Comp2D::Time::FrameStatistics::getHistogramBucketIndex( Uint64 frameTimeInNanoseconds )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "FrameStatistics getHistogramBucketIndex\n" );
+	#endif
+
+	Uint64 frameTimeInMicroseconds = frameTimeInNanoseconds / 1000;
+
+	Uint32 bucketIndex = 0;
+
+	while( frameTimeInMicroseconds > 1 && bucketIndex < HISTOGRAM_BUCKETS_COUNT - 1 )
+	{
+		frameTimeInMicroseconds >>= 1;
+		++bucketIndex;
+	}
+
+	return bucketIndex;
+}
+
+void Comp2D::Time::FrameStatistics::addFrameTime( Uint64 frameTimeInNanoseconds )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "FrameStatistics addFrameTime: frameTimeInNanoseconds = %" SDL_PRIu64 "\n", frameTimeInNanoseconds );
+	#endif
+
+	m_frameTimesRingInNanoseconds[m_frameTimesRingNextIndex] = frameTimeInNanoseconds;
+
+	m_frameTimesRingNextIndex = ( m_frameTimesRingNextIndex + 1 ) % FRAME_TIMES_RING_CAPACITY;
+
+	if( m_frameTimesRingSize < FRAME_TIMES_RING_CAPACITY )
+	{
+		++m_frameTimesRingSize;
+	}
+
+	++m_histogramBucketsFramesCounts[getHistogramBucketIndex( frameTimeInNanoseconds )];
+
+	if( m_frameBudgetInNanoseconds > 0 && frameTimeInNanoseconds > m_frameBudgetInNanoseconds )
+	{
+		++m_overBudgetFramesCount;
+	}
+
+	++m_recordedFramesCount;
+
+	m_rollingStatisticsOutdated = true;
+}
+
+void Comp2D::Time::FrameStatistics::reset()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "FrameStatistics reset\n" );
+	#endif
+
+	m_rollingStatisticsOutdated = false;
+
+	m_frameTimesRingNextIndex = 0;
+	m_frameTimesRingSize = 0;
+
+	m_maximumFrameTimeInNanoseconds = 0;
+	m_overBudgetFramesCount = 0;
+	m_recordedFramesCount = 0;
+
+	std::fill( m_frameTimesRingInNanoseconds, m_frameTimesRingInNanoseconds + FRAME_TIMES_RING_CAPACITY, 0 );
+	std::fill( m_histogramBucketsFramesCounts, m_histogramBucketsFramesCounts + HISTOGRAM_BUCKETS_COUNT, 0 );
+
+	m_sortedFrameTimesInNanoseconds.clear();
+}
+
+void Comp2D::Time::FrameStatistics::setFrameBudget( Uint64 frameBudgetInNanoseconds )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "FrameStatistics setFrameBudget: frameBudgetInNanoseconds = %" SDL_PRIu64 "\n", frameBudgetInNanoseconds );
+	#endif
+
+	m_frameBudgetInNanoseconds = frameBudgetInNanoseconds;
+}
+
+Uint32 Comp2D::Time::FrameStatistics::getRecentFramesCount() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "FrameStatistics getRecentFramesCount\n" );
+	#endif
+
+	return m_frameTimesRingSize;
+}
+
+Uint64 Comp2D::Time::FrameStatistics::getFrameBudgetInNanoseconds() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "FrameStatistics getFrameBudgetInNanoseconds\n" );
+	#endif
+
+	return m_frameBudgetInNanoseconds;
+}
+
+Uint64 Comp2D::Time::FrameStatistics::getHistogramBucketFramesCount( Uint32 bucketIndex ) const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "FrameStatistics getHistogramBucketFramesCount: bucketIndex = %u\n", bucketIndex );
+	#endif
+
+	if( bucketIndex < HISTOGRAM_BUCKETS_COUNT )
+	{
+		return m_histogramBucketsFramesCounts[bucketIndex];
+	}
+
+	return 0;
+}
+
+Uint64 Comp2D::Time::FrameStatistics::getOverBudgetFramesCount() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "FrameStatistics getOverBudgetFramesCount\n" );
+	#endif
+
+	return m_overBudgetFramesCount;
+}
+
+Uint64 Comp2D::Time::FrameStatistics::getRecordedFramesCount() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "FrameStatistics getRecordedFramesCount\n" );
+	#endif
+
+	return m_recordedFramesCount;
+}
+
+Uint64 Comp2D::Time::FrameStatistics::getFrameTimePercentileInNanoseconds( float percentile )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "FrameStatistics getFrameTimePercentileInNanoseconds: percentile = %f\n", percentile );
+	#endif
+
+	if( m_rollingStatisticsOutdated )
+	{
+		updateRollingStatistics();
+	}
+
+	if( m_sortedFrameTimesInNanoseconds.empty() )
+	{
+		return 0;
+	}
+
+	if( percentile <= 0.0f )
+	{
+		return m_sortedFrameTimesInNanoseconds.front();
+	}
+
+	if( percentile >= 100.0f )
+	{
+		return m_sortedFrameTimesInNanoseconds.back();
+	}
+
+	// Nearest rank
+	Uint32 rank = static_cast<Uint32>( std::ceil( percentile / 100.0f * static_cast<float>( m_sortedFrameTimesInNanoseconds.size() ) ) );
+
+	return m_sortedFrameTimesInNanoseconds[rank > 0 ? rank - 1 : 0];
+}
+
+Uint64 Comp2D::Time::FrameStatistics::getMaximumFrameTimeInNanoseconds()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "FrameStatistics getMaximumFrameTimeInNanoseconds\n" );
+	#endif
+
+	if( m_rollingStatisticsOutdated )
+	{
+		updateRollingStatistics();
+	}
+
+	return m_maximumFrameTimeInNanoseconds;
+}
+
+Uint64 Comp2D::Time::FrameStatistics::getHistogramBucketLowerBoundInNanoseconds( Uint32 bucketIndex )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "FrameStatistics getHistogramBucketLowerBoundInNanoseconds: bucketIndex = %u\n", bucketIndex );
+	#endif
+
+	if( bucketIndex == 0 )
+	{
+		return 0;
+	}
+
+	return ( static_cast<Uint64>( 1 ) << bucketIndex ) * 1000;
+}
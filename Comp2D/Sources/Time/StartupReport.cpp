@@ -0,0 +1,242 @@
+/* StartupReport.cpp -- 'Comp2D' Game Engine 'StartupReport' class source file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#include "Comp2D/Headers/Time/StartupReport.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_atomic.h>
+
+#include "Comp2D/Headers/Time/StartupReportEntry.h"
+#include "Comp2D/Headers/Time/TimeConversions.h"
+
+SDL_atomic_t Comp2D::Time::StartupReport::recording;
+
+Uint64 Comp2D::Time::StartupReport::performanceCounterFrequency = 1;
+Uint64 Comp2D::Time::StartupReport::performanceCounterOnBegin = 0;
+
+SDL_SpinLock Comp2D::Time::StartupReport::entriesLock = 0;
+
+std::vector<Comp2D::Time::StartupReportEntry> Comp2D::Time::StartupReport::entries;
+
+void Comp2D::Time::StartupReport::addEntry( const std::string& name, bool resource, Uint64 startCounter )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "StartupReport addEntry: name = %s; resource = %i\n", name.c_str(), resource );
+	#endif
+
+	if( !SDL_AtomicGet( &recording ) )
+	{
+		return;
+	}
+
+	Uint64 endCounter = SDL_GetPerformanceCounter();
+
+	Uint64 startTimeInNanoseconds = counterToNanoseconds( startCounter - performanceCounterOnBegin );
+	Uint64 durationInNanoseconds = counterToNanoseconds( endCounter - startCounter );
+
+	SDL_AtomicLock( &entriesLock );
+
+	std::vector<StartupReportEntry>::iterator entryIt = entries.begin();
+
+	if( resource )
+	{
+		while
+		(
+			entryIt != entries.end() &&
+			( !entryIt->resource || entryIt->name != name )
+		)
+		{
+			++entryIt;
+		}
+	}
+	else
+	{
+		entryIt = entries.end();
+	}
+
+	if( entryIt == entries.end() )
+	{
+		StartupReportEntry entry;
+
+		entry.resource = resource;
+		entry.startTimeInNanoseconds = startTimeInNanoseconds;
+		entry.durationInNanoseconds = durationInNanoseconds;
+		entry.name = name;
+
+		entries.push_back( entry );
+	}
+	else
+	{
+		entryIt->durationInNanoseconds += durationInNanoseconds;
+	}
+
+	SDL_AtomicUnlock( &entriesLock );
+}
+
+Uint64 Comp2D::Time::StartupReport::counterToNanoseconds( Uint64 counter )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "StartupReport counterToNanoseconds\n" );
+	#endif
+
+	return static_cast<Uint64>( static_cast<double>( counter ) * static_cast<double>( NANOSECONDS_IN_SECOND ) / static_cast<double>( performanceCounterFrequency ) );
+}
+
+void Comp2D::Time::StartupReport::begin()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "StartupReport begin\n" );
+	#endif
+
+	performanceCounterFrequency = SDL_GetPerformanceFrequency();
+	performanceCounterOnBegin = SDL_GetPerformanceCounter();
+
+	SDL_AtomicLock( &entriesLock );
+	entries.clear();
+	SDL_AtomicUnlock( &entriesLock );
+
+	SDL_AtomicSet( &recording, 1 );
+}
+
+void Comp2D::Time::StartupReport::end()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "StartupReport end\n" );
+	#endif
+
+	if( !SDL_AtomicCAS( &recording, 1, 0 ) )
+	{
+		return;
+	}
+
+	Uint64 totalTimeInNanoseconds = counterToNanoseconds( SDL_GetPerformanceCounter() - performanceCounterOnBegin );
+
+	SDL_AtomicLock( &entriesLock );
+	std::vector<StartupReportEntry> reportedEntries;
+	reportedEntries.swap( entries );
+	SDL_AtomicUnlock( &entriesLock );
+
+	// Subsystems in the order they started, then the slowest Resources first
+	std::stable_sort
+	(
+		reportedEntries.begin(),
+		reportedEntries.end(),
+		[]( const StartupReportEntry& entry, const StartupReportEntry& otherEntry )
+		{
+			if( entry.resource != otherEntry.resource )
+			{
+				return !entry.resource;
+			}
+
+			if( entry.resource )
+			{
+				return entry.durationInNanoseconds > otherEntry.durationInNanoseconds;
+			}
+
+			return entry.startTimeInNanoseconds < otherEntry.startTimeInNanoseconds;
+		}
+	);
+
+	SDL_LogInfo( SDL_LOG_CATEGORY_APPLICATION, "Startup took %.3f ms\n", static_cast<double>( totalTimeInNanoseconds ) / NANOSECONDS_IN_MILLISECOND );
+
+	Uint64 resourcesTimeInNanoseconds = 0;
+	Uint32 resourcesCount = 0;
+
+	for
+	(
+		std::vector<StartupReportEntry>::const_iterator entryConstIt = reportedEntries.cbegin();
+		entryConstIt != reportedEntries.cend();
+		++entryConstIt
+	)
+	{
+		if( entryConstIt->resource )
+		{
+			resourcesTimeInNanoseconds += entryConstIt->durationInNanoseconds;
+			++resourcesCount;
+		}
+
+		SDL_LogInfo
+		(
+			SDL_LOG_CATEGORY_APPLICATION,
+			"  %s %s: started at %.3f ms, took %.3f ms\n",
+			entryConstIt->resource ? "Resource" : "Subsystem",
+			entryConstIt->name.c_str(),
+			static_cast<double>( entryConstIt->startTimeInNanoseconds ) / NANOSECONDS_IN_MILLISECOND,
+			static_cast<double>( entryConstIt->durationInNanoseconds ) / NANOSECONDS_IN_MILLISECOND
+		);
+	}
+
+	// Resources are loaded concurrently, so their total may exceed the
+	// wall time it took
+	SDL_LogInfo
+	(
+		SDL_LOG_CATEGORY_APPLICATION,
+		"  %u Resources took %.3f ms in total\n",
+		resourcesCount,
+		static_cast<double>( resourcesTimeInNanoseconds ) / NANOSECONDS_IN_MILLISECOND
+	);
+
+	if( totalTimeInNanoseconds > COLD_START_TARGET_IN_NANOSECONDS )
+	{
+		SDL_LogWarn
+		(
+			SDL_LOG_CATEGORY_APPLICATION,
+			"Startup took longer than the %.3f ms target\n",
+			static_cast<double>( COLD_START_TARGET_IN_NANOSECONDS ) / NANOSECONDS_IN_MILLISECOND
+		);
+	}
+}
+
+void Comp2D::Time::StartupReport::addResourceTime( const std::string& resourceName, Uint64 startCounter )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "StartupReport addResourceTime: resourceName = %s\n", resourceName.c_str() );
+	#endif
+
+	addEntry( resourceName, true, startCounter );
+}
+
+void Comp2D::Time::StartupReport::addSubsystemTime( const std::string& subsystemName, Uint64 startCounter )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "StartupReport addSubsystemTime: subsystemName = %s\n", subsystemName.c_str() );
+	#endif
+
+	addEntry( subsystemName, false, startCounter );
+}
+
+bool Comp2D::Time::StartupReport::isRecording()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "StartupReport isRecording\n" );
+	#endif
+
+	return SDL_AtomicGet( &recording ) != 0;
+}
@@ -31,22 +31,42 @@
 #include <SDL.h>
 
 #include "Comp2D/Headers/Game.h"
+#include "Comp2D/Headers/Time/TimeConversions.h"
 #include "Comp2D/Headers/Time/Timer.h"
 
 Comp2D::Time::TimeManager::TimeManager()
 	:
-	m_currentStateInitializedTime( 0 ),
+	m_clockSimulated( Comp2D::Game::gameSettings->isHeadless() ),
 	m_deltaTimeInMilliseconds( 0 ),
+	m_fixedDeltaTimeInMilliseconds( 0 ),
 	m_scaledDeltaTimeInMilliseconds( 0 ),
+	m_currentStateInitializedTimeInNanoseconds( 0 ),
+	m_deltaTimeInNanoseconds( 0 ),
+	m_framePhasesDurationsInNanoseconds{ 0 },
+	m_performanceCounterFrequency( SDL_GetPerformanceFrequency() ),
+	m_performanceCounterOnSDLInitialization( 0 ),
+	m_simulatedTimeSinceSDLInitializationInNanoseconds( 0 ),
 	m_deltaTimeInSeconds( 0.0f ),
+	m_fixedDeltaTimeInSeconds( 0.0f ),
+	m_fixedTimeStepInterpolationFactor( 0.0f ),
 	m_scaledDeltaTimeInSeconds( 0.0f ),
+	m_smoothedDeltaTimeInSeconds( 0.0f ),
 	m_timeScale( 1.0f )
 {
 	#ifdef DEBUG
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeManager Constructor body Start\n" );
 	#endif
 
-	pausableTimeSinceSDLInitializationTimer.start( SDL_GetTicks() );
+	// Aligns the performance counter origin with SDL_GetTicks, so both clocks
+	// keep measuring the time since SDL initialization
+	m_performanceCounterOnSDLInitialization = SDL_GetPerformanceCounter() -
+											  ( static_cast<Uint64>( SDL_GetTicks() ) * m_performanceCounterFrequency ) / 1000;
+
+	m_simulatedTimeSinceSDLInitializationInNanoseconds = getRealTimeSinceSDLInitializationInNanoseconds();
+
+	pausableTimeSinceSDLInitializationTimer.start( getTimeSinceSDLInitializationInNanoseconds() );
+
+	setFixedDeltaTime( Comp2D::Game::gameSettings->timeSettings.getFixedDeltaTimeInSeconds() );
 
 	#ifdef DEBUG
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeManager Constructor body End\n" );
@@ -64,6 +84,15 @@ Comp2D::Time::TimeManager::~TimeManager()
 	#endif
 }
 
+void Comp2D::Time::TimeManager::advanceSimulatedClock( Uint64 timeInNanoseconds )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeManager advanceSimulatedClock: timeInNanoseconds = %" SDL_PRIu64 "\n", timeInNanoseconds );
+	#endif
+
+	m_simulatedTimeSinceSDLInitializationInNanoseconds += timeInNanoseconds;
+}
+
 void Comp2D::Time::TimeManager::pause()
 {
 	#ifdef DEBUG
@@ -74,15 +103,15 @@ void Comp2D::Time::TimeManager::pause()
 	pausableTimeSinceStateInitializedTimer.pause();
 }
 
-void Comp2D::Time::TimeManager::setCurrentStateInitializedTime( Uint32 currentStateInitializedTime )
+void Comp2D::Time::TimeManager::setCurrentStateInitializedTime( Uint64 currentStateInitializedTimeInNanoseconds )
 {
 	#ifdef DEBUG
-		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeManager setCurrentStateInitializedTime: currentStateInitializedTime = %u\n", currentStateInitializedTime );
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeManager setCurrentStateInitializedTime: currentStateInitializedTimeInNanoseconds = %" SDL_PRIu64 "\n", currentStateInitializedTimeInNanoseconds );
 	#endif
 
-	m_currentStateInitializedTime = currentStateInitializedTime;
+	m_currentStateInitializedTimeInNanoseconds = currentStateInitializedTimeInNanoseconds;
 
-	pausableTimeSinceStateInitializedTimer.start( currentStateInitializedTime );
+	pausableTimeSinceStateInitializedTimer.start( currentStateInitializedTimeInNanoseconds );
 
 	if( Comp2D::Game::isPaused() )
 	{
@@ -90,16 +119,45 @@ void Comp2D::Time::TimeManager::setCurrentStateInitializedTime( Uint32 currentSt
 	}
 }
 
-void Comp2D::Time::TimeManager::setDeltaTime( Uint32 deltaTime )
+void Comp2D::Time::TimeManager::setDeltaTime( Uint64 deltaTimeInNanoseconds )
 {
 	#ifdef DEBUG
-		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeManager setDeltaTime: deltaTime = %u\n", deltaTime );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeManager setDeltaTime: deltaTimeInNanoseconds = %" SDL_PRIu64 "\n", deltaTimeInNanoseconds );
 	#endif
 
-	m_deltaTimeInMilliseconds = deltaTime;
-	m_scaledDeltaTimeInMilliseconds = static_cast<Uint32>( round( static_cast<float>( m_deltaTimeInMilliseconds ) * m_timeScale ) );
-	m_deltaTimeInSeconds = static_cast<float>( m_deltaTimeInMilliseconds ) / 1000.0f;
+	m_deltaTimeInNanoseconds = deltaTimeInNanoseconds;
+	m_deltaTimeInSeconds = Comp2D::Time::nanosecondsToSeconds( m_deltaTimeInNanoseconds );
+	m_deltaTimeInMilliseconds = static_cast<Uint32>( round( m_deltaTimeInSeconds * 1000.0f ) );
+	m_scaledDeltaTimeInMilliseconds = static_cast<Uint32>( round( m_deltaTimeInSeconds * 1000.0f * m_timeScale ) );
 	m_scaledDeltaTimeInSeconds = m_deltaTimeInSeconds * m_timeScale;
+
+	if( m_smoothedDeltaTimeInSeconds > 0.0f )
+	{
+		m_smoothedDeltaTimeInSeconds += Comp2D::Game::gameSettings->timeSettings.getDeltaTimeSmoothingFactor() *
+										( m_deltaTimeInSeconds - m_smoothedDeltaTimeInSeconds );
+	}
+	else
+	{
+		m_smoothedDeltaTimeInSeconds = m_deltaTimeInSeconds;
+	}
+}
+
+void Comp2D::Time::TimeManager::setFixedTimeStepInterpolationFactor( float fixedTimeStepInterpolationFactor )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeManager setFixedTimeStepInterpolationFactor: fixedTimeStepInterpolationFactor = %f\n", fixedTimeStepInterpolationFactor );
+	#endif
+
+	m_fixedTimeStepInterpolationFactor = fixedTimeStepInterpolationFactor;
+}
+
+void Comp2D::Time::TimeManager::setFramePhaseDuration( EFramePhase framePhase, Uint64 durationInNanoseconds )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeManager setFramePhaseDuration: framePhase = %i; durationInNanoseconds = %" SDL_PRIu64 "\n", static_cast<int>( framePhase ), durationInNanoseconds );
+	#endif
+
+	m_framePhasesDurationsInNanoseconds[static_cast<int>( framePhase )] = durationInNanoseconds;
 }
 
 void Comp2D::Time::TimeManager::unpause()
@@ -112,6 +170,19 @@ void Comp2D::Time::TimeManager::unpause()
 	pausableTimeSinceStateInitializedTimer.unpause();
 }
 
+void Comp2D::Time::TimeManager::setFixedDeltaTime( float fixedDeltaTimeInSeconds )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeManager setFixedDeltaTime: fixedDeltaTimeInSeconds = %f\n", fixedDeltaTimeInSeconds );
+	#endif
+
+	if( fixedDeltaTimeInSeconds > 0.0f )
+	{
+		m_fixedDeltaTimeInSeconds = fixedDeltaTimeInSeconds;
+		m_fixedDeltaTimeInMilliseconds = static_cast<Uint32>( round( m_fixedDeltaTimeInSeconds * 1000.0f ) );
+	}
+}
+
 void Comp2D::Time::TimeManager::setTimeScale( float timeScale )
 {
 	#ifdef DEBUG
@@ -120,10 +191,19 @@ void Comp2D::Time::TimeManager::setTimeScale( float timeScale )
 
 	m_timeScale = timeScale;
 
-	m_scaledDeltaTimeInMilliseconds = static_cast<Uint32>( round( static_cast<float>( m_deltaTimeInMilliseconds ) * m_timeScale ) );
+	m_scaledDeltaTimeInMilliseconds = static_cast<Uint32>( round( m_deltaTimeInSeconds * 1000.0f * m_timeScale ) );
 	m_scaledDeltaTimeInSeconds = m_deltaTimeInSeconds * m_timeScale;
 }
 
+bool Comp2D::Time::TimeManager::isClockSimulated() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeManager isClockSimulated\n" );
+	#endif
+
+	return m_clockSimulated;
+}
+
 Uint32 Comp2D::Time::TimeManager::getDeltaTimeInMilliseconds()
 {
 	#ifdef DEBUG
@@ -133,6 +213,15 @@ Uint32 Comp2D::Time::TimeManager::getDeltaTimeInMilliseconds()
 	return m_deltaTimeInMilliseconds;
 }
 
+Uint32 Comp2D::Time::TimeManager::getFixedDeltaTimeInMilliseconds()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeManager getFixedDeltaTimeInMilliseconds\n" );
+	#endif
+
+	return m_fixedDeltaTimeInMilliseconds;
+}
+
 Uint32 Comp2D::Time::TimeManager::getPausableTimeSinceSDLInitializationInMilliseconds()
 {
 	#ifdef DEBUG
@@ -166,7 +255,7 @@ Uint32 Comp2D::Time::TimeManager::getTimeSinceSDLInitializationInMilliseconds()
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeManager getTimeSinceSDLInitializationInMilliseconds\n" );
 	#endif
 
-	return SDL_GetTicks();
+	return Comp2D::Time::nanosecondsToMilliseconds( getTimeSinceSDLInitializationInNanoseconds() );
 }
 
 Uint32 Comp2D::Time::TimeManager::getTimeSinceStateInitializedInMilliseconds()
@@ -175,7 +264,79 @@ Uint32 Comp2D::Time::TimeManager::getTimeSinceStateInitializedInMilliseconds()
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeManager getTimeSinceStateInitializedInMilliseconds\n" );
 	#endif
 
-	return SDL_GetTicks() - m_currentStateInitializedTime;
+	return Comp2D::Time::nanosecondsToMilliseconds( getTimeSinceStateInitializedInNanoseconds() );
+}
+
+Uint64 Comp2D::Time::TimeManager::getDeltaTimeInNanoseconds()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeManager getDeltaTimeInNanoseconds\n" );
+	#endif
+
+	return m_deltaTimeInNanoseconds;
+}
+
+Uint64 Comp2D::Time::TimeManager::getFramePhaseDurationInNanoseconds( EFramePhase framePhase )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeManager getFramePhaseDurationInNanoseconds: framePhase = %i\n", static_cast<int>( framePhase ) );
+	#endif
+
+	return m_framePhasesDurationsInNanoseconds[static_cast<int>( framePhase )];
+}
+
+Uint64 Comp2D::Time::TimeManager::getPausableTimeSinceSDLInitializationInNanoseconds()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeManager getPausableTimeSinceSDLInitializationInNanoseconds\n" );
+	#endif
+
+	return pausableTimeSinceSDLInitializationTimer.getElapsedTimeInNanoseconds();
+}
+
+Uint64 Comp2D::Time::TimeManager::getPausableTimeSinceStateInitializedInNanoseconds()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeManager getPausableTimeSinceStateInitializedInNanoseconds\n" );
+	#endif
+
+	return pausableTimeSinceStateInitializedTimer.getElapsedTimeInNanoseconds();
+}
+
+Uint64 Comp2D::Time::TimeManager::getRealTimeSinceSDLInitializationInNanoseconds()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeManager getRealTimeSinceSDLInitializationInNanoseconds\n" );
+	#endif
+
+	Uint64 elapsedCounter = SDL_GetPerformanceCounter() - m_performanceCounterOnSDLInitialization;
+
+	// Split in whole seconds and remainder to avoid overflowing the multiplication
+	return ( elapsedCounter / m_performanceCounterFrequency ) * Comp2D::Time::NANOSECONDS_IN_SECOND +
+		   ( ( elapsedCounter % m_performanceCounterFrequency ) * Comp2D::Time::NANOSECONDS_IN_SECOND ) / m_performanceCounterFrequency;
+}
+
+Uint64 Comp2D::Time::TimeManager::getTimeSinceSDLInitializationInNanoseconds()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeManager getTimeSinceSDLInitializationInNanoseconds\n" );
+	#endif
+
+	if( m_clockSimulated )
+	{
+		return m_simulatedTimeSinceSDLInitializationInNanoseconds;
+	}
+
+	return getRealTimeSinceSDLInitializationInNanoseconds();
+}
+
+Uint64 Comp2D::Time::TimeManager::getTimeSinceStateInitializedInNanoseconds()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeManager getTimeSinceStateInitializedInNanoseconds\n" );
+	#endif
+
+	return getTimeSinceSDLInitializationInNanoseconds() - m_currentStateInitializedTimeInNanoseconds;
 }
 
 float Comp2D::Time::TimeManager::getDeltaTimeInSeconds()
@@ -187,6 +348,33 @@ float Comp2D::Time::TimeManager::getDeltaTimeInSeconds()
 	return m_deltaTimeInSeconds;
 }
 
+float Comp2D::Time::TimeManager::getFixedDeltaTimeInSeconds()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeManager getFixedDeltaTimeInSeconds\n" );
+	#endif
+
+	return m_fixedDeltaTimeInSeconds;
+}
+
+float Comp2D::Time::TimeManager::getFixedTimeStepInterpolationFactor()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeManager getFixedTimeStepInterpolationFactor\n" );
+	#endif
+
+	return m_fixedTimeStepInterpolationFactor;
+}
+
+float Comp2D::Time::TimeManager::getFramePhaseDurationInSeconds( EFramePhase framePhase )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeManager getFramePhaseDurationInSeconds: framePhase = %i\n", static_cast<int>( framePhase ) );
+	#endif
+
+	return Comp2D::Time::nanosecondsToSeconds( getFramePhaseDurationInNanoseconds( framePhase ) );
+}
+
 float Comp2D::Time::TimeManager::getPausableTimeSinceSDLInitializationInSeconds()
 {
 	#ifdef DEBUG
@@ -214,6 +402,24 @@ float Comp2D::Time::TimeManager::getScaledDeltaTimeInSeconds()
 	return m_scaledDeltaTimeInSeconds;
 }
 
+float Comp2D::Time::TimeManager::getScaledSmoothedDeltaTimeInSeconds()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeManager getScaledSmoothedDeltaTimeInSeconds\n" );
+	#endif
+
+	return m_smoothedDeltaTimeInSeconds * m_timeScale;
+}
+
+float Comp2D::Time::TimeManager::getSmoothedDeltaTimeInSeconds()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeManager getSmoothedDeltaTimeInSeconds\n" );
+	#endif
+
+	return m_smoothedDeltaTimeInSeconds;
+}
+
 float Comp2D::Time::TimeManager::getTimeScale()
 {
 	#ifdef DEBUG
@@ -229,7 +435,7 @@ float Comp2D::Time::TimeManager::getTimeSinceSDLInitializationInSeconds()
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeManager getTimeSinceSDLInitializationInSeconds\n" );
 	#endif
 
-	return static_cast<float>( SDL_GetTicks() ) / 1000.0f;
+	return Comp2D::Time::nanosecondsToSeconds( getTimeSinceSDLInitializationInNanoseconds() );
 }
 
 float Comp2D::Time::TimeManager::getTimeSinceStateInitializedInSeconds()
@@ -238,5 +444,5 @@ float Comp2D::Time::TimeManager::getTimeSinceStateInitializedInSeconds()
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimeManager getTimeSinceStateInitializedInSeconds\n" );
 	#endif
 
-	return static_cast<float>( SDL_GetTicks() - m_currentStateInitializedTime ) / 1000.0f;
+	return Comp2D::Time::nanosecondsToSeconds( getTimeSinceStateInitializedInNanoseconds() );
 }
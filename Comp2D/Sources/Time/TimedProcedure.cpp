@@ -27,48 +27,40 @@
 #include "Comp2D/Headers/Time/TimedProcedure.h"
 
 #include <functional>
+#include <utility>
 
 #include <SDL.h>
 
-#include "Comp2D/Headers/Game.h"
-#include "Comp2D/Headers/Time/TimeManager.h"
+#include "Comp2D/Headers/Time/TimeConversions.h"
 
-Comp2D::Time::TimedProcedure::TimedProcedure
-(
-	unsigned int id,
-	std::function<void()> timedProcedure,
-	Uint32 callbackTimeInMilliseconds,
-	bool pausable
-	/*bool useTimeScale,
-	bool useDeltaTime*/
-)
+Comp2D::Time::TimedProcedure::TimedProcedure()
 	:
-	m_pausable( pausable ),
-	m_paused( false ),
+	m_pausable( false ),
+	m_pending( false ),
 	/*m_useTimeScale( useTimeScale ),
 	m_useDeltaTime( useDeltaTime ),*/
-	m_id( id ),
-	m_callbackTimeInMilliseconds( callbackTimeInMilliseconds ),
-	m_timeSinceSDLInitializationInMillisecondsOnPaused( 0 ),
-	m_timedProcedure( timedProcedure )
+	m_id( 0 ),
+	m_generation( 0 ),
+	m_callbackTimeInNanoseconds( 0 ),
+	m_timedProcedure( nullptr )
 {
 	#ifdef DEBUG
-		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProcedure with ID %u Constructor body Start\n", m_id );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProcedure Constructor body Start\n" );
 	#endif
 
 	#ifdef DEBUG
-		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProcedure with ID %u Constructor body End\n", m_id );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProcedure Constructor body End\n" );
 	#endif
 }
 
 Comp2D::Time::TimedProcedure::~TimedProcedure()
 {
 	#ifdef DEBUG
-		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProcedure with ID %u Destroying\n", m_id );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProcedure with ID %u Destroying\n", m_id );
 	#endif
 
 	#ifdef DEBUG
-		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProcedure with ID %u Destroyed\n", m_id );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProcedure with ID %u Destroyed\n", m_id );
 	#endif
 }
 
@@ -90,32 +82,47 @@ bool Comp2D::Time::TimedProcedure::operator!=( const TimedProcedure& rhs ) const
 	return !(*this == rhs);
 }
 
-void Comp2D::Time::TimedProcedure::pause()
+void Comp2D::Time::TimedProcedure::reset
+(
+	unsigned int id,
+	std::function<void()> timedProcedure,
+	Uint64 callbackTimeInNanoseconds,
+	bool pausable
+	/*bool useTimeScale,
+	bool useDeltaTime*/
+)
 {
 	#ifdef DEBUG
-		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProcedure with ID %u pause\n", m_id );
-	#endif
-
-	//if( !isPaused() )
-	//{
-		m_timeSinceSDLInitializationInMillisecondsOnPaused = Comp2D::Game::timeManager->getTimeSinceSDLInitializationInMilliseconds();
-		m_paused = true;
-	//}
+		SDL_LogDebug
+		(
+			SDL_LOG_CATEGORY_TEST,
+			"TimedProcedure with ID %u reset: callbackTimeInNanoseconds = %" SDL_PRIu64 "; pausable = %i\n",
+			id,
+			callbackTimeInNanoseconds,
+			pausable
+		);
+	#endif
+
+	m_pausable = pausable;
+	m_pending = true;
+	m_id = id;
+	m_callbackTimeInNanoseconds = callbackTimeInNanoseconds;
+	m_timedProcedure = std::move( timedProcedure );
 }
 
-void Comp2D::Time::TimedProcedure::unpause()
+std::function<void()> Comp2D::Time::TimedProcedure::release()
 {
 	#ifdef DEBUG
-		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProcedure with ID %u unpause\n", m_id );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProcedure with ID %u release\n", m_id );
 	#endif
 
-	//if( isPaused() )
-	//{
-		Uint32 timeLeftToCallbackInMilliseconds = m_callbackTimeInMilliseconds - m_timeSinceSDLInitializationInMillisecondsOnPaused;
-		m_callbackTimeInMilliseconds = Comp2D::Game::timeManager->getTimeSinceSDLInitializationInMilliseconds() +
-									   timeLeftToCallbackInMilliseconds;
-		m_paused = false;
-	//}
+	std::function<void()> releasedTimedProcedure = std::move( m_timedProcedure );
+
+	m_timedProcedure = nullptr;
+	m_pending = false;
+	++m_generation;
+
+	return releasedTimedProcedure;
 }
 
 bool Comp2D::Time::TimedProcedure::isPausable() const
@@ -127,29 +134,13 @@ bool Comp2D::Time::TimedProcedure::isPausable() const
 	return m_pausable;
 }
 
-bool Comp2D::Time::TimedProcedure::isPaused() const
-{
-	#ifdef DEBUG
-		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProcedure with ID %u isPaused\n", m_id );
-	#endif
-
-	return m_paused;
-}
-
-bool Comp2D::Time::TimedProcedure::checkCallbackTime( Uint32 currentTime )
+bool Comp2D::Time::TimedProcedure::isPending() const
 {
 	#ifdef DEBUG
-		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProcedure with ID %u checkCallbackTime: currentTime = %u\n", m_id, currentTime );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProcedure with ID %u isPending\n", m_id );
 	#endif
 
-	if( !isPaused() && SDL_TICKS_PASSED( currentTime, getCallbackTimeInMilliseconds() ) )
-	{
-		m_timedProcedure();
-
-		return true;
-	}
-
-	return false;
+	return m_pending;
 }
 
 unsigned int Comp2D::Time::TimedProcedure::getID() const
@@ -161,38 +152,38 @@ unsigned int Comp2D::Time::TimedProcedure::getID() const
 	return m_id;
 }
 
-Uint32 Comp2D::Time::TimedProcedure::getCallbackTimeInMilliseconds()
+Uint32 Comp2D::Time::TimedProcedure::getCallbackTimeInMilliseconds() const
 {
 	#ifdef DEBUG
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProcedure with ID %u getCallbackTimeInMilliseconds\n", m_id );
 	#endif
 
-	return m_callbackTimeInMilliseconds;
+	return Comp2D::Time::nanosecondsToMilliseconds( m_callbackTimeInNanoseconds );
 }
 
-Uint32 Comp2D::Time::TimedProcedure::getTimeSinceSDLInitializationInMillisecondsOnPaused()
+Uint32 Comp2D::Time::TimedProcedure::getGeneration() const
 {
 	#ifdef DEBUG
-		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProcedure with ID %u getTimeSinceSDLInitializationInMillisecondsOnPaused\n", m_id );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProcedure with ID %u getGeneration\n", m_id );
 	#endif
 
-	return m_timeSinceSDLInitializationInMillisecondsOnPaused;
+	return m_generation;
 }
 
-float Comp2D::Time::TimedProcedure::getCallbackTimeInSeconds()
+Uint64 Comp2D::Time::TimedProcedure::getCallbackTimeInNanoseconds() const
 {
 	#ifdef DEBUG
-		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProcedure with ID %u getCallbackTimeInSeconds\n", m_id );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProcedure with ID %u getCallbackTimeInNanoseconds\n", m_id );
 	#endif
 
-	return static_cast<float>( getCallbackTimeInMilliseconds() ) / 1000.0f;
+	return m_callbackTimeInNanoseconds;
 }
 
-float Comp2D::Time::TimedProcedure::getTimeSinceSDLInitializationInSecondsOnPaused()
+float Comp2D::Time::TimedProcedure::getCallbackTimeInSeconds() const
 {
 	#ifdef DEBUG
-		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProcedure with ID %u getTimeSinceSDLInitializationInSecondsOnPaused\n", m_id );
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProcedure with ID %u getCallbackTimeInSeconds\n", m_id );
 	#endif
 
-	return static_cast<float>( getTimeSinceSDLInitializationInMillisecondsOnPaused() ) / 1000.0f;
+	return Comp2D::Time::nanosecondsToSeconds( getCallbackTimeInNanoseconds() );
 }
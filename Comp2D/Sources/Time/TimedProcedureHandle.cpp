@@ -0,0 +1,95 @@
+/* TimedProcedureHandle.cpp -- 'Comp2D' Game Engine 'TimedProcedureHandle' class source file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#include "Comp2D/Headers/Time/TimedProcedureHandle.h"
+
+#include <SDL.h>
+
+#include "Comp2D/Headers/Time/TimedProceduresScheduler.h"
+
+Comp2D::Time::TimedProcedureHandle::TimedProcedureHandle()
+	:
+	m_generation{ 0 },
+	m_nodeIndex{ 0 },
+	m_scheduler{ nullptr }
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProcedureHandle Constructor body Start\n" );
+	#endif
+
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProcedureHandle Constructor body End\n" );
+	#endif
+}
+
+Comp2D::Time::TimedProcedureHandle::TimedProcedureHandle
+(
+	TimedProceduresScheduler* scheduler,
+	Uint32 nodeIndex,
+	Uint32 generation
+)
+	:
+	m_generation{ generation },
+	m_nodeIndex{ nodeIndex },
+	m_scheduler{ scheduler }
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProcedureHandle Constructor body Start\n" );
+	#endif
+
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProcedureHandle Constructor body End\n" );
+	#endif
+}
+
+Comp2D::Time::TimedProcedureHandle::~TimedProcedureHandle()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProcedureHandle Destroying\n" );
+	#endif
+
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProcedureHandle Destroyed\n" );
+	#endif
+}
+
+bool Comp2D::Time::TimedProcedureHandle::cancel()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProcedureHandle cancel: nodeIndex = %u; generation = %u\n", m_nodeIndex, m_generation );
+	#endif
+
+	return m_scheduler != nullptr && m_scheduler->cancel( *this );
+}
+
+bool Comp2D::Time::TimedProcedureHandle::isPending() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProcedureHandle isPending\n" );
+	#endif
+
+	return m_scheduler != nullptr && m_scheduler->isPending( *this );
+}
@@ -0,0 +1,377 @@
+/* TimedProceduresScheduler.cpp -- 'Comp2D' Game Engine 'TimedProceduresScheduler' class source file
+  version 1.0.0, October 9th, 2019
+
+  Copyright (C) 2018-2019 Miguel Rodrigo Auto Gomes
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+	 claim that you wrote the original software. If you use this software
+	 in a product, an acknowledgment in the product documentation would be
+	 appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+	 misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+
+  Miguel Rodrigo Auto Gomes
+  migrodne@gmail.com
+
+*/
+
+#include "Comp2D/Headers/Time/TimedProceduresScheduler.h"
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include <SDL.h>
+
+#include "Comp2D/Headers/Time/TimedProcedure.h"
+#include "Comp2D/Headers/Time/TimedProcedureHandle.h"
+
+#define TIMED_PROCEDURES_SCHEDULER_MINIMUM_STALE_HEAP_ENTRIES_TO_COMPACT 64
+
+bool Comp2D::Time::TimedProceduresScheduler::HeapEntry::operator>( const HeapEntry& rhs ) const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProceduresScheduler HeapEntry operator>\n" );
+	#endif
+
+	// Procedures due at the same time are called in scheduling order
+	return
+		callbackTimeInNanoseconds > rhs.callbackTimeInNanoseconds ||
+		(
+			callbackTimeInNanoseconds == rhs.callbackTimeInNanoseconds &&
+			sequence > rhs.sequence
+		);
+}
+
+Comp2D::Time::TimedProceduresScheduler::TimedProceduresScheduler()
+	:
+	m_paused{ false },
+	m_nextID{ 0 },
+	m_nextSequence{ 0 },
+	m_pendingCount{ 0 },
+	m_pausedTimeInNanoseconds{ 0 },
+	m_timeOnPausedInNanoseconds{ 0 }
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProceduresScheduler Constructor body Start\n" );
+	#endif
+
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProceduresScheduler Constructor body End\n" );
+	#endif
+}
+
+Comp2D::Time::TimedProceduresScheduler::~TimedProceduresScheduler()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProceduresScheduler Destroying\n" );
+	#endif
+
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProceduresScheduler Destroyed\n" );
+	#endif
+}
+
+void Comp2D::Time::TimedProceduresScheduler::callDueProcedures
+(
+	std::vector<HeapEntry>& heap,
+	Uint64 domainTimeInNanoseconds,
+	Uint32 firstDeferredSequence
+)
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProceduresScheduler callDueProcedures: domainTimeInNanoseconds = %" SDL_PRIu64 "\n", domainTimeInNanoseconds );
+	#endif
+
+	while
+	(
+		!heap.empty() &&
+		heap.front().callbackTimeInNanoseconds <= domainTimeInNanoseconds &&
+		!( m_paused && &heap == &m_pausableHeap )
+	)
+	{
+		HeapEntry dueHeapEntry = heap.front();
+
+		std::pop_heap( heap.begin(), heap.end(), std::greater<HeapEntry>() );
+		heap.pop_back();
+
+		if( isHeapEntryStale( dueHeapEntry ) )
+		{
+			continue;
+		}
+
+		// Scheduled by a procedure called in this same update, so it waits
+		// for the next one
+		if( dueHeapEntry.sequence >= firstDeferredSequence )
+		{
+			m_deferredHeapEntries.push_back( dueHeapEntry );
+			continue;
+		}
+
+		// Released before the call, since the procedure may schedule new ones
+		// and grow the nodes pool
+		std::function<void()> dueTimedProcedure = m_nodes[dueHeapEntry.nodeIndex].release();
+		m_freeNodesIndices.push_back( dueHeapEntry.nodeIndex );
+		--m_pendingCount;
+
+		dueTimedProcedure();
+	}
+
+	for
+	(
+		std::vector<HeapEntry>::const_iterator deferredHeapEntryIt = m_deferredHeapEntries.cbegin();
+		deferredHeapEntryIt != m_deferredHeapEntries.cend();
+		++deferredHeapEntryIt
+	)
+	{
+		pushHeapEntry( heap, *deferredHeapEntryIt );
+	}
+
+	m_deferredHeapEntries.clear();
+}
+
+void Comp2D::Time::TimedProceduresScheduler::compactHeap( std::vector<HeapEntry>& heap )
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProceduresScheduler compactHeap\n" );
+	#endif
+
+	heap.erase
+	(
+		std::remove_if
+		(
+			heap.begin(),
+			heap.end(),
+			[this]( const HeapEntry& heapEntry )
+			{
+				return isHeapEntryStale( heapEntry );
+			}
+		),
+		heap.end()
+	);
+
+	std::make_heap( heap.begin(), heap.end(), std::greater<HeapEntry>() );
+}
+
+void Comp2D::Time::TimedProceduresScheduler::pushHeapEntry( std::vector<HeapEntry>& heap, const HeapEntry& heapEntry )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProceduresScheduler pushHeapEntry\n" );
+	#endif
+
+	heap.push_back( heapEntry );
+	std::push_heap( heap.begin(), heap.end(), std::greater<HeapEntry>() );
+}
+
+bool Comp2D::Time::TimedProceduresScheduler::isHeapEntryStale( const HeapEntry& heapEntry ) const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProceduresScheduler isHeapEntryStale\n" );
+	#endif
+
+	const TimedProcedure& node = m_nodes[heapEntry.nodeIndex];
+
+	return !node.isPending() || node.getGeneration() != heapEntry.generation;
+}
+
+Uint32 Comp2D::Time::TimedProceduresScheduler::acquireNode()
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProceduresScheduler acquireNode\n" );
+	#endif
+
+	if( !m_freeNodesIndices.empty() )
+	{
+		Uint32 nodeIndex = m_freeNodesIndices.back();
+		m_freeNodesIndices.pop_back();
+
+		return nodeIndex;
+	}
+
+	m_nodes.emplace_back();
+
+	return static_cast<Uint32>( m_nodes.size() - 1 );
+}
+
+Uint64 Comp2D::Time::TimedProceduresScheduler::getPausableTimeInNanoseconds( Uint64 currentTimeInNanoseconds ) const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProceduresScheduler getPausableTimeInNanoseconds\n" );
+	#endif
+
+	Uint64 domainTimeInNanoseconds = m_paused ? m_timeOnPausedInNanoseconds : currentTimeInNanoseconds;
+
+	if( domainTimeInNanoseconds < m_pausedTimeInNanoseconds )
+	{
+		return 0;
+	}
+
+	return domainTimeInNanoseconds - m_pausedTimeInNanoseconds;
+}
+
+void Comp2D::Time::TimedProceduresScheduler::clear()
+{
+	#ifdef DEBUG
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProceduresScheduler clear\n" );
+	#endif
+
+	m_freeNodesIndices.clear();
+
+	for( Uint32 i = 0; i < m_nodes.size(); ++i )
+	{
+		if( m_nodes[i].isPending() )
+		{
+			m_nodes[i].release();
+		}
+
+		m_freeNodesIndices.push_back( i );
+	}
+
+	m_pausableHeap.clear();
+	m_unpausableHeap.clear();
+
+	m_pendingCount = 0;
+}
+
+void Comp2D::Time::TimedProceduresScheduler::pause( Uint64 currentTimeInNanoseconds )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProceduresScheduler pause\n" );
+	#endif
+
+	if( !m_paused )
+	{
+		m_timeOnPausedInNanoseconds = currentTimeInNanoseconds;
+		m_paused = true;
+	}
+}
+
+void Comp2D::Time::TimedProceduresScheduler::unpause( Uint64 currentTimeInNanoseconds )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProceduresScheduler unpause\n" );
+	#endif
+
+	if( m_paused )
+	{
+		if( currentTimeInNanoseconds > m_timeOnPausedInNanoseconds )
+		{
+			m_pausedTimeInNanoseconds += currentTimeInNanoseconds - m_timeOnPausedInNanoseconds;
+		}
+
+		m_paused = false;
+	}
+}
+
+void Comp2D::Time::TimedProceduresScheduler::update( Uint64 currentTimeInNanoseconds )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProceduresScheduler update: currentTimeInNanoseconds = %" SDL_PRIu64 "\n", currentTimeInNanoseconds );
+	#endif
+
+	Uint32 firstDeferredSequence = m_nextSequence;
+
+	callDueProcedures( m_unpausableHeap, currentTimeInNanoseconds, firstDeferredSequence );
+	callDueProcedures( m_pausableHeap, getPausableTimeInNanoseconds( currentTimeInNanoseconds ), firstDeferredSequence );
+}
+
+bool Comp2D::Time::TimedProceduresScheduler::cancel( const TimedProcedureHandle& handle )
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProceduresScheduler cancel\n" );
+	#endif
+
+	if( !isPending( handle ) )
+	{
+		return false;
+	}
+
+	m_nodes[handle.m_nodeIndex].release();
+	m_freeNodesIndices.push_back( handle.m_nodeIndex );
+	--m_pendingCount;
+
+	// Stale entries are normally dropped when they reach the top, but far
+	// away cancelled procedures would otherwise pile up
+	Uint32 heapEntriesCount = static_cast<Uint32>( m_pausableHeap.size() + m_unpausableHeap.size() );
+
+	if( heapEntriesCount > 2 * m_pendingCount + TIMED_PROCEDURES_SCHEDULER_MINIMUM_STALE_HEAP_ENTRIES_TO_COMPACT )
+	{
+		compactHeap( m_pausableHeap );
+		compactHeap( m_unpausableHeap );
+	}
+
+	return true;
+}
+
+bool Comp2D::Time::TimedProceduresScheduler::isPaused() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProceduresScheduler isPaused\n" );
+	#endif
+
+	return m_paused;
+}
+
+bool Comp2D::Time::TimedProceduresScheduler::isPending( const TimedProcedureHandle& handle ) const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProceduresScheduler isPending\n" );
+	#endif
+
+	return
+		handle.m_scheduler == this &&
+		handle.m_nodeIndex < m_nodes.size() &&
+		m_nodes[handle.m_nodeIndex].isPending() &&
+		m_nodes[handle.m_nodeIndex].getGeneration() == handle.m_generation;
+}
+
+Uint32 Comp2D::Time::TimedProceduresScheduler::getPendingCount() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProceduresScheduler getPendingCount\n" );
+	#endif
+
+	return m_pendingCount;
+}
+
+Comp2D::Time::TimedProcedureHandle Comp2D::Time::TimedProceduresScheduler::schedule
+(
+	std::function<void()> timedProcedure,
+	Uint64 delayInNanoseconds,
+	bool pausable,
+	Uint64 currentTimeInNanoseconds
+)
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimedProceduresScheduler schedule: delayInNanoseconds = %" SDL_PRIu64 "; pausable = %i\n", delayInNanoseconds, pausable );
+	#endif
+
+	Uint32 nodeIndex = acquireNode();
+
+	Uint64 domainTimeInNanoseconds = pausable ? getPausableTimeInNanoseconds( currentTimeInNanoseconds ) : currentTimeInNanoseconds;
+
+	TimedProcedure& node = m_nodes[nodeIndex];
+
+	node.reset( m_nextID++, timedProcedure, domainTimeInNanoseconds + delayInNanoseconds, pausable );
+
+	HeapEntry heapEntry;
+	heapEntry.generation = node.getGeneration();
+	heapEntry.nodeIndex = nodeIndex;
+	heapEntry.sequence = m_nextSequence++;
+	heapEntry.callbackTimeInNanoseconds = node.getCallbackTimeInNanoseconds();
+
+	pushHeapEntry( pausable ? m_pausableHeap : m_unpausableHeap, heapEntry );
+
+	++m_pendingCount;
+
+	return TimedProcedureHandle( this, nodeIndex, heapEntry.generation );
+}
@@ -29,16 +29,15 @@
 #include <SDL.h>
 
 #include "Comp2D/Headers/Game.h"
+#include "Comp2D/Headers/Time/TimeConversions.h"
 #include "Comp2D/Headers/Time/TimeManager.h"
 
-Comp2D::Time::Timer::Timer( Uint32 timeOnStartInMilliseconds )
+Comp2D::Time::Timer::Timer( Uint64 timeOnStartInNanoseconds )
 	:
 	m_paused( false ),
 	m_started( false ),
-	m_timeOnPausedInMilliseconds( 0 ),
-    m_timeOnStartInMilliseconds( timeOnStartInMilliseconds ),
-	m_timeOnPausedInSeconds( 0.0f ),
-	m_timeOnStartInSeconds( static_cast<float>( timeOnStartInMilliseconds ) / 1000.0f )
+	m_timeOnPausedInNanoseconds( 0 ),
+	m_timeOnStartInNanoseconds( timeOnStartInNanoseconds )
 {
 	#ifdef DEBUG
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Timer Constructor body Start\n" );
@@ -66,26 +65,23 @@ void Comp2D::Time::Timer::pause()
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Timer pause\n" );
 	#endif
 
-    if( m_started && !m_paused )
-    {
-    	m_timeOnPausedInMilliseconds = Comp2D::Game::timeManager->getTimeSinceSDLInitializationInMilliseconds() - m_timeOnStartInMilliseconds;
-    	m_timeOnPausedInSeconds = static_cast<float>( m_timeOnPausedInMilliseconds ) / 1000.0f;
+	if( m_started && !m_paused )
+	{
+		m_timeOnPausedInNanoseconds = Comp2D::Game::getTimeManager()->getTimeSinceSDLInitializationInNanoseconds() - m_timeOnStartInNanoseconds;
 
-        m_paused = true;
+		m_paused = true;
 
-        m_timeOnStartInMilliseconds = 0;
-        m_timeOnStartInSeconds = 0.0f;
-    }
+		m_timeOnStartInNanoseconds = 0;
+	}
 }
 
-void Comp2D::Time::Timer::setTimeOnStart( Uint32 timeOnStartInMilliseconds )
+void Comp2D::Time::Timer::setTimeOnStart( Uint64 timeOnStartInNanoseconds )
 {
 	#ifdef DEBUG
-		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Timer setTimeOnStart: timeOnStartInMilliseconds = %u\n", timeOnStartInMilliseconds );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Timer setTimeOnStart: timeOnStartInNanoseconds = %" SDL_PRIu64 "\n", timeOnStartInNanoseconds );
 	#endif
 
-	m_timeOnStartInMilliseconds = timeOnStartInMilliseconds;
-	m_timeOnStartInSeconds = static_cast<float>( m_timeOnStartInMilliseconds ) / 1000.0f;
+	m_timeOnStartInNanoseconds = timeOnStartInNanoseconds;
 }
 
 void Comp2D::Time::Timer::start()
@@ -94,21 +90,20 @@ void Comp2D::Time::Timer::start()
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Timer start\n" );
 	#endif
 
-	start( Comp2D::Game::timeManager->getTimeSinceSDLInitializationInMilliseconds() );
+	start( Comp2D::Game::getTimeManager()->getTimeSinceSDLInitializationInNanoseconds() );
 }
 
-void Comp2D::Time::Timer::start( Uint32 timeOnStartInMilliseconds )
+void Comp2D::Time::Timer::start( Uint64 timeOnStartInNanoseconds )
 {
 	#ifdef DEBUG
-		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Timer start: timeOnStartInMilliseconds = %u\n", timeOnStartInMilliseconds );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Timer start: timeOnStartInNanoseconds = %" SDL_PRIu64 "\n", timeOnStartInNanoseconds );
 	#endif
 
 	m_paused = false;
 	m_started = true;
 
-	m_timeOnPausedInMilliseconds = 0;
-	m_timeOnPausedInSeconds = 0.0f;
-	setTimeOnStart( timeOnStartInMilliseconds );
+	m_timeOnPausedInNanoseconds = 0;
+	setTimeOnStart( timeOnStartInNanoseconds );
 }
 
 void Comp2D::Time::Timer::stop()
@@ -117,13 +112,11 @@ void Comp2D::Time::Timer::stop()
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Timer stop\n" );
 	#endif
 
-    m_paused = false;
-    m_started = false;
+	m_paused = false;
+	m_started = false;
 
-    m_timeOnPausedInMilliseconds = 0;
-    m_timeOnPausedInSeconds = 0.0f;
-	m_timeOnStartInMilliseconds = 0;
-	m_timeOnStartInSeconds = 0.0f;
+	m_timeOnPausedInNanoseconds = 0;
+	m_timeOnStartInNanoseconds = 0;
 }
 
 void Comp2D::Time::Timer::unpause()
@@ -132,16 +125,14 @@ void Comp2D::Time::Timer::unpause()
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Timer unpause\n" );
 	#endif
 
-    if( m_started && m_paused )
-    {
-        m_paused = false;
+	if( m_started && m_paused )
+	{
+		m_paused = false;
 
-        m_timeOnStartInMilliseconds = Comp2D::Game::timeManager->getTimeSinceSDLInitializationInMilliseconds() - m_timeOnPausedInMilliseconds;
-        m_timeOnStartInSeconds = static_cast<float>( m_timeOnStartInMilliseconds ) / 1000.0f;
+		m_timeOnStartInNanoseconds = Comp2D::Game::getTimeManager()->getTimeSinceSDLInitializationInNanoseconds() - m_timeOnPausedInNanoseconds;
 
-        m_timeOnPausedInMilliseconds = 0;
-        m_timeOnPausedInSeconds = 0.0f;
-    }
+		m_timeOnPausedInNanoseconds = 0;
+	}
 }
 
 bool Comp2D::Time::Timer::hasStarted() const
@@ -150,7 +141,7 @@ bool Comp2D::Time::Timer::hasStarted() const
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Timer isStarted\n" );
 	#endif
 
-    return m_started;
+	return m_started;
 }
 
 bool Comp2D::Time::Timer::isPaused() const
@@ -159,7 +150,7 @@ bool Comp2D::Time::Timer::isPaused() const
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Timer isPaused\n" );
 	#endif
 
-    return m_paused && m_started;
+	return m_paused && m_started;
 }
 
 Uint32 Comp2D::Time::Timer::getElapsedTimeInMilliseconds() const
@@ -168,21 +159,7 @@ Uint32 Comp2D::Time::Timer::getElapsedTimeInMilliseconds() const
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Timer getElapsedTimeInMilliseconds\n" );
 	#endif
 
-    Uint32 elapsedTime = 0;
-
-    if( m_started )
-    {
-        if( m_paused )
-        {
-            elapsedTime = m_timeOnPausedInMilliseconds;
-        }
-        else
-        {
-            elapsedTime = Comp2D::Game::timeManager->getTimeSinceSDLInitializationInMilliseconds() - m_timeOnStartInMilliseconds;
-        }
-    }
-
-    return elapsedTime;
+	return Comp2D::Time::nanosecondsToMilliseconds( getElapsedTimeInNanoseconds() );
 }
 
 Uint32 Comp2D::Time::Timer::getTimeOnPausedInMilliseconds() const
@@ -191,7 +168,7 @@ Uint32 Comp2D::Time::Timer::getTimeOnPausedInMilliseconds() const
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Timer getTimeOnPausedInMilliseconds\n" );
 	#endif
 
-	return m_timeOnPausedInMilliseconds;
+	return Comp2D::Time::nanosecondsToMilliseconds( m_timeOnPausedInNanoseconds );
 }
 
 Uint32 Comp2D::Time::Timer::getTimeOnStartInMilliseconds() const
@@ -200,7 +177,48 @@ Uint32 Comp2D::Time::Timer::getTimeOnStartInMilliseconds() const
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Timer getTimeOnStartInMilliseconds\n" );
 	#endif
 
-	return m_timeOnStartInMilliseconds;
+	return Comp2D::Time::nanosecondsToMilliseconds( m_timeOnStartInNanoseconds );
+}
+
+Uint64 Comp2D::Time::Timer::getElapsedTimeInNanoseconds() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Timer getElapsedTimeInNanoseconds\n" );
+	#endif
+
+	Uint64 elapsedTime = 0;
+
+	if( m_started )
+	{
+		if( m_paused )
+		{
+			elapsedTime = m_timeOnPausedInNanoseconds;
+		}
+		else
+		{
+			elapsedTime = Comp2D::Game::getTimeManager()->getTimeSinceSDLInitializationInNanoseconds() - m_timeOnStartInNanoseconds;
+		}
+	}
+
+	return elapsedTime;
+}
+
+Uint64 Comp2D::Time::Timer::getTimeOnPausedInNanoseconds() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Timer getTimeOnPausedInNanoseconds\n" );
+	#endif
+
+	return m_timeOnPausedInNanoseconds;
+}
+
+Uint64 Comp2D::Time::Timer::getTimeOnStartInNanoseconds() const
+{
+	#ifdef DEBUG
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Timer getTimeOnStartInNanoseconds\n" );
+	#endif
+
+	return m_timeOnStartInNanoseconds;
 }
 
 float Comp2D::Time::Timer::getElapsedTimeInSeconds() const
@@ -209,7 +227,7 @@ float Comp2D::Time::Timer::getElapsedTimeInSeconds() const
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Timer getElapsedTimeInSeconds\n" );
 	#endif
 
-	return static_cast<float>( getElapsedTimeInMilliseconds() ) / 1000.0f;
+	return Comp2D::Time::nanosecondsToSeconds( getElapsedTimeInNanoseconds() );
 }
 
 float Comp2D::Time::Timer::getTimeOnPausedInSeconds() const
@@ -218,7 +236,7 @@ float Comp2D::Time::Timer::getTimeOnPausedInSeconds() const
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Timer getTimeOnPausedInSeconds\n" );
 	#endif
 
-	return m_timeOnPausedInSeconds;
+	return Comp2D::Time::nanosecondsToSeconds( m_timeOnPausedInNanoseconds );
 }
 
 float Comp2D::Time::Timer::getTimeOnStartInSeconds() const
@@ -227,5 +245,5 @@ float Comp2D::Time::Timer::getTimeOnStartInSeconds() const
 		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Timer getTimeOnStartInSeconds\n" );
 	#endif
 
-	return m_timeOnStartInSeconds;
+	return Comp2D::Time::nanosecondsToSeconds( m_timeOnStartInNanoseconds );
 }
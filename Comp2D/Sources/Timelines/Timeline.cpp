@@ -33,6 +33,7 @@
 #include "Comp2D/Headers/Game.h"
 #include "Comp2D/Headers/Objects/GameObject.h"
 #include "Comp2D/Headers/Timelines/TimelineEvent.h"
+#include "Comp2D/Headers/Time/TimeConversions.h"
 #include "Comp2D/Headers/Time/TimeManager.h"
 
 Comp2D::Timelines::Timeline::Timeline
@@ -47,9 +48,9 @@ Comp2D::Timelines::Timeline::Timeline
 	m_playing( false ),
 	m_started( false ),
 	m_timelineEventCount( timelineEventCount ),
-	m_nextEventTimeSinceSDLInitializationInMilliseconds( 0 ),
-	m_timeSinceSDLInitializationInMillisecondsOnPaused( 0 ),
-	m_timeSinceSDLInitializationInMillisecondsOnStarted( 0 )/*,
+	m_nextEventTimeSinceSDLInitializationInNanoseconds( 0 ),
+	m_timeSinceSDLInitializationInNanosecondsOnPaused( 0 ),
+	m_timeSinceSDLInitializationInNanosecondsOnStarted( 0 )/*,
 	m_name( name )*/
 {
 	#ifdef DEBUG
@@ -109,7 +110,7 @@ void Comp2D::Timelines::Timeline::pause()
 		m_paused = true;
 		m_playing = false;
 
-		m_timeSinceSDLInitializationInMillisecondsOnPaused = Comp2D::Game::timeManager->getTimeSinceSDLInitializationInMilliseconds();
+		m_timeSinceSDLInitializationInNanosecondsOnPaused = Comp2D::Game::getTimeManager()->getTimeSinceSDLInitializationInNanoseconds();
 	}
 }
 
@@ -136,10 +137,10 @@ void Comp2D::Timelines::Timeline::start( Comp2D::Objects::GameObject* timelinesC
 
 	m_timelineEvents[m_currentTimelineEventIndex].callTimelineEventProcedure( timelinesControllerComponentGameObject );
 
-	m_timeSinceSDLInitializationInMillisecondsOnStarted = Comp2D::Game::timeManager->getTimeSinceSDLInitializationInMilliseconds();
+	m_timeSinceSDLInitializationInNanosecondsOnStarted = Comp2D::Game::getTimeManager()->getTimeSinceSDLInitializationInNanoseconds();
 
-	m_nextEventTimeSinceSDLInitializationInMilliseconds = getTimeSinceSDLInitializationInMillisecondsOnStarted() +
-														  getCurrentTimelineEvent().getDurationInMilliseconds();
+	m_nextEventTimeSinceSDLInitializationInNanoseconds = getTimeSinceSDLInitializationInNanosecondsOnStarted() +
+														  Comp2D::Time::millisecondsToNanoseconds( getCurrentTimelineEvent().getDurationInMilliseconds() );
 }
 
 void Comp2D::Timelines::Timeline::stop()
@@ -164,41 +165,41 @@ void Comp2D::Timelines::Timeline::unpause()
 		m_paused = false;
 		m_playing = true;
 
-		Uint32 timeLeftToNextEventInMilliseconds = getNextEventTimeSinceSDLInitializationInMilliseconds() -
-												   getTimeSinceSDLInitializationInMillisecondsOnPaused();
+		Uint64 timeLeftToNextEventInNanoseconds = getNextEventTimeSinceSDLInitializationInNanoseconds() -
+												   getTimeSinceSDLInitializationInNanosecondsOnPaused();
 
-		m_nextEventTimeSinceSDLInitializationInMilliseconds = Comp2D::Game::timeManager->getTimeSinceSDLInitializationInMilliseconds() +
-															  timeLeftToNextEventInMilliseconds;
+		m_nextEventTimeSinceSDLInitializationInNanoseconds = Comp2D::Game::getTimeManager()->getTimeSinceSDLInitializationInNanoseconds() +
+															  timeLeftToNextEventInNanoseconds;
 	}
 }
 
-void Comp2D::Timelines::Timeline::update( Uint32 currentTime, Comp2D::Objects::GameObject* timelinesControllerComponentGameObject )
+void Comp2D::Timelines::Timeline::update( Uint64 currentTime, Comp2D::Objects::GameObject* timelinesControllerComponentGameObject )
 {
 	#ifdef DEBUG
-		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Timeline named %s update: currentTime = %u; timelinesControllerComponentGameObject with ID %u\n", m_name.c_str(), currentTime, timelinesControllerComponentGameObject->getID() );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Timeline named %s update: currentTime = %" SDL_PRIu64 "; timelinesControllerComponentGameObject with ID %u\n", m_name.c_str(), currentTime, timelinesControllerComponentGameObject->getID() );
 	#endif
 
 	if
 	(
 		isPlaying() &&
-		SDL_TICKS_PASSED( currentTime, getNextEventTimeSinceSDLInitializationInMilliseconds() )
+		currentTime >= getNextEventTimeSinceSDLInitializationInNanoseconds()
 	)
 	{
 		if( getCurrentTimelineEventIndex() < getLastTimelineEventIndex() )
 		{
 			advanceToNextTimelineEvent();
 
-			m_nextEventTimeSinceSDLInitializationInMilliseconds = Comp2D::Game::timeManager->getTimeSinceSDLInitializationInMilliseconds() +
-																  getCurrentTimelineEvent().getDurationInMilliseconds();
+			m_nextEventTimeSinceSDLInitializationInNanoseconds = Comp2D::Game::getTimeManager()->getTimeSinceSDLInitializationInNanoseconds() +
+																  Comp2D::Time::millisecondsToNanoseconds( getCurrentTimelineEvent().getDurationInMilliseconds() );
 		}
 		else if( isLooping() )
 		{
 			setCurrentTimelineEvent( 0 );
 
-			m_timeSinceSDLInitializationInMillisecondsOnStarted = Comp2D::Game::timeManager->getTimeSinceSDLInitializationInMilliseconds();
+			m_timeSinceSDLInitializationInNanosecondsOnStarted = Comp2D::Game::getTimeManager()->getTimeSinceSDLInitializationInNanoseconds();
 
-			m_nextEventTimeSinceSDLInitializationInMilliseconds = getTimeSinceSDLInitializationInMillisecondsOnStarted() +
-																  getCurrentTimelineEvent().getDurationInMilliseconds();
+			m_nextEventTimeSinceSDLInitializationInNanoseconds = getTimeSinceSDLInitializationInNanosecondsOnStarted() +
+																  Comp2D::Time::millisecondsToNanoseconds( getCurrentTimelineEvent().getDurationInMilliseconds() );
 		}
 		else
 		{
@@ -272,31 +273,31 @@ int Comp2D::Timelines::Timeline::getLastTimelineEventIndex() const
 	return m_lastTimelineEventIndex;
 }
 
-Uint32 Comp2D::Timelines::Timeline::getNextEventTimeSinceSDLInitializationInMilliseconds() const
+Uint64 Comp2D::Timelines::Timeline::getNextEventTimeSinceSDLInitializationInNanoseconds() const
 {
 	#ifdef DEBUG
-		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Timeline named %s getNextEventTimeSinceSDLInitializationInMilliseconds\n", m_name.c_str() );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Timeline named %s getNextEventTimeSinceSDLInitializationInNanoseconds\n", m_name.c_str() );
 	#endif
 
-	return m_nextEventTimeSinceSDLInitializationInMilliseconds;
+	return m_nextEventTimeSinceSDLInitializationInNanoseconds;
 }
 
-Uint32 Comp2D::Timelines::Timeline::getTimeSinceSDLInitializationInMillisecondsOnPaused() const
+Uint64 Comp2D::Timelines::Timeline::getTimeSinceSDLInitializationInNanosecondsOnPaused() const
 {
 	#ifdef DEBUG
-		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Timeline named %s getTimeSinceSDLInitializationInMillisecondsOnPaused\n", m_name.c_str() );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Timeline named %s getTimeSinceSDLInitializationInNanosecondsOnPaused\n", m_name.c_str() );
 	#endif
 
-	return m_timeSinceSDLInitializationInMillisecondsOnPaused;
+	return m_timeSinceSDLInitializationInNanosecondsOnPaused;
 }
 
-Uint32 Comp2D::Timelines::Timeline::getTimeSinceSDLInitializationInMillisecondsOnStarted() const
+Uint64 Comp2D::Timelines::Timeline::getTimeSinceSDLInitializationInNanosecondsOnStarted() const
 {
 	#ifdef DEBUG
-		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Timeline named %s getTimeSinceSDLInitializationInMillisecondsOnStarted\n", m_name.c_str() );
+		//SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "Timeline named %s getTimeSinceSDLInitializationInNanosecondsOnStarted\n", m_name.c_str() );
 	#endif
 
-	return m_timeSinceSDLInitializationInMillisecondsOnStarted;
+	return m_timeSinceSDLInitializationInNanosecondsOnStarted;
 }
 
 const std::string& Comp2D::Timelines::Timeline::getName() const
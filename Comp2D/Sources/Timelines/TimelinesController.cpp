@@ -77,7 +77,7 @@ void Comp2D::Timelines::TimelinesController::setCurrentTimeline( int timelineInd
 
 	m_currentTimeline = static_cast<Comp2D::Resources::GenericResource<Comp2D::Timelines::Timeline>*>
 	(
-		Comp2D::Game::resourcesManager->getResource( m_timelinesResourcesNames[m_currentTimelineIndex] )
+		Comp2D::Game::getResourcesManager()->getResource( m_timelinesResourcesNames[m_currentTimelineIndex] )
 	)->getGenericResource();
 }
 
@@ -105,10 +105,10 @@ void Comp2D::Timelines::TimelinesController::setCurrentTimeline( const Comp2D::T
 	setCurrentTimeline( timeline.getName() );
 }
 
-void Comp2D::Timelines::TimelinesController::update( Uint32 currentTime, Comp2D::Objects::GameObject* timelinesControllerComponentGameObject )
+void Comp2D::Timelines::TimelinesController::update( Uint64 currentTime, Comp2D::Objects::GameObject* timelinesControllerComponentGameObject )
 {
 	#ifdef DEBUG
-		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimelinesController update: currentTime = %u\n", currentTime );
+		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "TimelinesController update: currentTime = %" SDL_PRIu64 "\n", currentTime );
 	#endif
 
 	m_currentTimeline->update( currentTime, timelinesControllerComponentGameObject );
@@ -142,7 +142,7 @@ std::list<Comp2D::Timelines::Timeline> Comp2D::Timelines::TimelinesController::g
 		(
 			*static_cast<Comp2D::Resources::GenericResource<Comp2D::Timelines::Timeline>*>
 			(
-				Comp2D::Game::resourcesManager->getResource( *timelineResourceNameIt )
+				Comp2D::Game::getResourcesManager()->getResource( *timelineResourceNameIt )
 			)->getGenericResource()
 		);
 	}
@@ -32,8 +32,7 @@
 #ifdef LOG_TO_TEXT_FILE
 	#include <chrono>
 	#include <iomanip>
-	#include <iostream>
-	#include <fstream>
+	#include <sstream>
 #endif
 
 #include <SDL.h>
@@ -41,95 +40,7 @@
 #include "Comp2D/Headers/Game.h"
 
 #ifdef LOG_TO_TEXT_FILE
-	std::string g_logFileName;
-
-	SDL_RWops* g_logTextFile;
-
-	void logOutputToConsoleAndFileFunction
-	(
-		void* userdata,
-		int category,
-		SDL_LogPriority priority,
-		const char* message
-	)
-	{
-		std::stringstream completeMessageStringStream;
-		completeMessageStringStream.str( "" );
-
-		switch( priority )
-		{
-			case SDL_LOG_PRIORITY_CRITICAL:
-				completeMessageStringStream << "CRITICAL (";
-				break;
-			case SDL_LOG_PRIORITY_DEBUG:
-				completeMessageStringStream << "DEBUG (";
-				break;
-			case SDL_LOG_PRIORITY_ERROR:
-				completeMessageStringStream << "ERROR (";
-				break;
-			case SDL_LOG_PRIORITY_INFO:
-				completeMessageStringStream << "INFO (";
-				break;
-			case SDL_LOG_PRIORITY_VERBOSE:
-				completeMessageStringStream << "VERBOSE (";
-				break;
-			case SDL_LOG_PRIORITY_WARN:
-				completeMessageStringStream << "WARN (";
-				break;
-			default:
-				completeMessageStringStream << "UNKNOWN PRIORITY (";
-				break;
-		}
-
-		switch( category )
-		{
-			case SDL_LOG_CATEGORY_APPLICATION:
-				completeMessageStringStream << "APPLICATION): ";
-				break;
-			case SDL_LOG_CATEGORY_ASSERT:
-				completeMessageStringStream << "ASSERT): ";
-				break;
-			case SDL_LOG_CATEGORY_AUDIO:
-				completeMessageStringStream << "AUDIO): ";
-				break;
-			case SDL_LOG_CATEGORY_CUSTOM:
-				completeMessageStringStream << "CUSTOM): ";
-				break;
-			case SDL_LOG_CATEGORY_ERROR:
-				completeMessageStringStream << "ERROR): ";
-				break;
-			case SDL_LOG_CATEGORY_INPUT:
-				completeMessageStringStream << "INPUT): ";
-				break;
-			case SDL_LOG_CATEGORY_RENDER:
-				completeMessageStringStream << "RENDER): ";
-				break;
-			case SDL_LOG_CATEGORY_SYSTEM:
-				completeMessageStringStream << "SYSTEM): ";
-				break;
-			case SDL_LOG_CATEGORY_TEST:
-				completeMessageStringStream << "TEST): ";
-				break;
-			case SDL_LOG_CATEGORY_VIDEO:
-				completeMessageStringStream << "VIDEO): ";
-				break;
-			default:
-				completeMessageStringStream << "UNKNOWN CATEGORY): ";
-				break;
-		}
-
-		completeMessageStringStream << message << '\n';
-
-	    std::ofstream myfile;
-
-		myfile.open( g_logFileName.c_str(), std::ios::out | std::ios::app );
-
-		myfile << completeMessageStringStream.str().c_str();
-
-		myfile.close();
-
-	    std::cout << completeMessageStringStream.str().c_str();
-	}
+	#include "Comp2D/Headers/Logging/Logger.h"
 #endif
 
 int main( int argc, char* argv[] )
@@ -151,13 +62,12 @@ int main( int argc, char* argv[] )
 
 		logFileNameStringStream << "Logs/log_" << std::put_time( &timeinfo, "%Y_%m_%d_%H_%M_%S" ) << ".txt";
 
-		g_logFileName = logFileNameStringStream.str();
-
-		//void (*defaultLogOutputFunction)(void*, int, SDL_LogPriority, const char*);
-		//void* defaultLogOutputFunctionUserData;
-		//SDL_LogGetOutputFunction( &defaultLogOutputFunction, &defaultLogOutputFunctionUserData );
-
-		SDL_LogSetOutputFunction( logOutputToConsoleAndFileFunction, nullptr );
+		// Messages are written by a background thread to the console and to
+		// the log file, which stays open until the Logger is finalized
+		if( !Comp2D::Logging::Logger::initialize( logFileNameStringStream.str() ) )
+		{
+			SDL_LogError( SDL_LOG_CATEGORY_APPLICATION, "Failed to open the log file %s, logging to the console only\n", logFileNameStringStream.str().c_str() );
+		}
 	#endif
 
 	#ifdef DEBUG
@@ -182,15 +92,15 @@ int main( int argc, char* argv[] )
 		}
 	#endif
 
-	Comp2D::Game::start();
-
-	#ifdef LOG_TO_TEXT_FILE
-		//SDL_LogSetOutputFunction( defaultLogOutputFunction, defaultLogOutputFunctionUserData );
-	#endif
+	Comp2D::Game::start( argc, argv );
 
 	#ifdef DEBUG
 		SDL_LogDebug( SDL_LOG_CATEGORY_TEST, "main body end\n" );
 	#endif
 
+	#ifdef LOG_TO_TEXT_FILE
+		Comp2D::Logging::Logger::finalize();
+	#endif
+
 	return 0;
 }